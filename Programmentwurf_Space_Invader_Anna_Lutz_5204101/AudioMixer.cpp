@@ -0,0 +1,366 @@
+#include "AudioMixer.h"
+#include "MemoryTracker.h"
+#include "Tracer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // Limiter: sofort leiser, danach pro Block ein Stueck zurueck Richtung 1
+        const float LIMITER_CEILING = 0.95f;
+        const float LIMITER_RELEASE = 0.05f;
+
+        // === Ersatzklaenge, falls eine Datei der Sound-Bank fehlt ===
+        enum FallbackWaveform {
+            FALLBACK_SINE,
+            FALLBACK_SQUARE,
+            FALLBACK_SAW
+        };
+
+        struct FallbackTone {
+            float duration;
+            FallbackWaveform waveform;
+            float startFrequency;
+            float endFrequency;
+            float noise;      // Anteil Rauschen (0..1)
+            float smoothing;  // Tiefpass fuer das Rauschen, nahe 1 = dumpf
+            int steps;        // > 1: Frequenz springt in Stufen statt zu gleiten
+        };
+
+        // Index = SoundId
+        const FallbackTone FALLBACK_TONES[] = {
+            { 0.08f, FALLBACK_SQUARE, 1400.0f,  500.0f, 0.0f, 0.0f,  1 },  // PLAYER_SHOT
+            { 0.18f, FALLBACK_SAW,    2200.0f,  900.0f, 0.0f, 0.0f,  1 },  // LASER_SHOT
+            { 0.45f, FALLBACK_SQUARE,  120.0f,   40.0f, 0.8f, 0.6f,  1 },  // ENEMY_EXPLOSION
+            { 0.30f, FALLBACK_SQUARE,  180.0f,   60.0f, 0.4f, 0.3f,  1 },  // PLAYER_HIT
+            { 0.20f, FALLBACK_SINE,    700.0f, 1100.0f, 0.0f, 0.0f,  1 },  // SHIELD_HIT
+            { 0.30f, FALLBACK_SINE,    660.0f, 1320.0f, 0.0f, 0.0f,  3 },  // POWERUP_PICKUP
+            { 0.15f, FALLBACK_SQUARE,  220.0f,  150.0f, 0.5f, 0.4f,  1 },  // BOSS_HIT
+            { 1.60f, FALLBACK_SQUARE,   80.0f,   25.0f, 0.9f, 0.85f, 1 }   // BOSS_EXPLOSION
+        };
+
+        static_assert(sizeof(FALLBACK_TONES) / sizeof(FALLBACK_TONES[0]) == SOUND_COUNT,
+            "FALLBACK_TONES braucht einen Eintrag pro SoundId");
+
+    } // namespace
+
+    // === Singleton ===
+    AudioMixer& AudioMixer::GetInstance() {
+        static AudioMixer instance;
+        return instance;
+    }
+
+    AudioMixer::AudioMixer()
+        : sounds{}
+        , voices{}
+        , musicBlock(GameConfig::AUDIO_BUFFER_FRAMES * CHANNELS, 0.0f)
+        , nextStartOrder(0)
+        , limiterGain(1.0f)
+        , stream{}
+        , deviceOpen(false)
+        , running(false)
+        , activeVoices(0)
+        , stolenVoices(0)
+        , rejectedTriggers(0)
+    {
+    }
+
+    AudioMixer::~AudioMixer() {
+        Shutdown();
+    }
+
+    // === Start & Stop ===
+    bool AudioMixer::Initialize() {
+        TraceScope trace("AudioMixer::Initialize");
+        if (running.load()) return deviceOpen;
+
+        {
+            MemoryTagScope memoryTag(MEMORY_AUDIO);
+            LoadSoundBank();
+            music.Start(GameConfig::AUDIO_MUSIC_FILE);
+        }
+
+        if (GameConfig::AUDIO_ENABLED) {
+            InitAudioDevice();
+        }
+
+        if (IsAudioDeviceReady()) {
+            SetAudioStreamBufferSizeDefault(GameConfig::AUDIO_BUFFER_FRAMES);
+            stream = LoadAudioStream(GameConfig::AUDIO_SAMPLE_RATE, 32, CHANNELS);
+            deviceOpen = IsAudioStreamValid(stream);
+            if (!deviceOpen) {
+                CloseAudioDevice();
+            }
+        }
+
+        running.store(true);
+        if (deviceOpen) {
+            SetAudioStreamCallback(stream, &AudioMixer::DeviceCallback);
+            PlayAudioStream(stream);
+            Logger::Info("Audio: %d Hz, %d Frames pro Puffer, %d Stimmen",
+                GameConfig::AUDIO_SAMPLE_RATE, GameConfig::AUDIO_BUFFER_FRAMES, GameConfig::AUDIO_VOICE_COUNT);
+        }
+        else {
+            nullDevice = std::thread(&AudioMixer::RunNullDevice, this);
+            Logger::Info("Audio: kein Ausgabegeraet, Null-Device aktiv");
+        }
+        return deviceOpen;
+    }
+
+    void AudioMixer::Shutdown() {
+        if (!running.exchange(false)) return;
+
+        if (deviceOpen) {
+            StopAudioStream(stream);
+            UnloadAudioStream(stream);
+            CloseAudioDevice();
+            deviceOpen = false;
+        }
+        if (nullDevice.joinable()) {
+            nullDevice.join();
+        }
+        music.Stop();
+
+        Logger::Info("Audio: %zu Stimmen verdraengt, %zu Trigger verworfen, %zu Musik-Unterlaeufe",
+            stolenVoices.load(), rejectedTriggers.load() + triggers.GetDroppedCount(), music.GetUnderrunCount());
+    }
+
+    bool AudioMixer::IsNullDevice() const {
+        return !deviceOpen;
+    }
+
+    // === Ausloesen ===
+    void AudioMixer::Play(SoundId sound, float pan) {
+        if (sound >= SOUND_COUNT || !running.load(std::memory_order_relaxed)) return;
+
+        // Voller Kanal: Trigger verfallen, der Simulations-Thread wartet nie
+        triggers.TryPush({ sound, pan });
+    }
+
+    // === Statistik ===
+    size_t AudioMixer::GetActiveVoiceCount() const {
+        return activeVoices.load(std::memory_order_relaxed);
+    }
+
+    // === Private Hilfsfunktionen ===
+    void AudioMixer::LoadSoundBank() {
+        TraceScope trace("AudioMixer::LoadSoundBank");
+
+        samplePool.clear();
+        std::vector<float> decoded;
+        int synthesized = 0;
+
+        for (int id = 0; id < SOUND_COUNT; id++) {
+            std::string path = std::string(GameConfig::AUDIO_FOLDER) + SOUND_BANK[id].filename;
+            decoded.clear();
+
+            // Einmal ins Mischformat bringen, beim Abspielen wird nichts mehr dekodiert
+            if (FileExists(path.c_str())) {
+                Wave wave = LoadWave(path.c_str());
+                if (IsWaveValid(wave)) {
+                    WaveFormat(&wave, GameConfig::AUDIO_SAMPLE_RATE, 32, 1);
+                    float* samples = LoadWaveSamples(wave);
+                    decoded.assign(samples, samples + wave.frameCount);
+                    UnloadWaveSamples(samples);
+                }
+                UnloadWave(wave);
+            }
+
+            if (decoded.empty()) {
+                SynthesizeFallback((SoundId)id, decoded);
+                synthesized++;
+            }
+
+            sounds[id] = { samplePool.size(), decoded.size() };
+            samplePool.insert(samplePool.end(), decoded.begin(), decoded.end());
+        }
+
+        Logger::Info("Audio: %d Sounds dekodiert (%d davon synthetisiert), %zu KB",
+            (int)SOUND_COUNT, synthesized, samplePool.size() * sizeof(float) / 1024);
+    }
+
+    void AudioMixer::Mix(float* out, size_t frames) {
+        // In festen Bloecken, damit der Musikpuffer nie waechst
+        const size_t blockFrames = GameConfig::AUDIO_BUFFER_FRAMES;
+        for (size_t done = 0; done < frames; done += blockFrames) {
+            MixBlock(out + done * CHANNELS, std::min(blockFrames, frames - done));
+        }
+    }
+
+    void AudioMixer::MixBlock(float* out, size_t frames) {
+        SoundTrigger trigger;
+        while (triggers.TryPop(trigger)) {
+            StartVoice(trigger);
+        }
+
+        std::fill(out, out + frames * CHANNELS, 0.0f);
+
+        // Musik (bei Unterlauf bleibt der Rest still)
+        if (music.IsRunning()) {
+            size_t musicFrames = music.Read(musicBlock.data(), frames);
+            for (size_t i = 0; i < musicFrames * CHANNELS; i++) {
+                out[i] = musicBlock[i] * GameConfig::AUDIO_MUSIC_VOLUME;
+            }
+        }
+
+        // Stimmen (Mono-Samples, Panorama steckt in den Gains)
+        size_t active = 0;
+        for (Voice& voice : voices) {
+            if (!voice.active) continue;
+
+            const SoundRange& range = sounds[voice.sound];
+            const float* source = &samplePool[range.offset + voice.position];
+            size_t count = std::min(frames, range.length - voice.position);
+            for (size_t i = 0; i < count; i++) {
+                out[i * 2] += source[i] * voice.gainLeft;
+                out[i * 2 + 1] += source[i] * voice.gainRight;
+            }
+
+            voice.position += count;
+            voice.active = voice.position < range.length;
+            if (voice.active) active++;
+        }
+        activeVoices.store(active, std::memory_order_relaxed);
+
+        // Limiter: Gain ueber den Block rampen, damit es nicht knackt
+        float peak = 0.0f;
+        for (size_t i = 0; i < frames * CHANNELS; i++) {
+            peak = std::max(peak, std::fabs(out[i]));
+        }
+        peak *= GameConfig::AUDIO_MASTER_VOLUME;
+
+        float targetGain = peak > LIMITER_CEILING ? LIMITER_CEILING / peak : 1.0f;
+        float startGain = std::min(limiterGain, targetGain);
+        float endGain = std::min(targetGain, limiterGain + (1.0f - limiterGain) * LIMITER_RELEASE);
+        float gainStep = (endGain - startGain) / (float)frames;
+
+        for (size_t i = 0; i < frames; i++) {
+            float gain = (startGain + gainStep * (float)i) * GameConfig::AUDIO_MASTER_VOLUME;
+            out[i * 2] = std::clamp(out[i * 2] * gain, -1.0f, 1.0f);
+            out[i * 2 + 1] = std::clamp(out[i * 2 + 1] * gain, -1.0f, 1.0f);
+        }
+        limiterGain = endGain;
+    }
+
+    void AudioMixer::StartVoice(const SoundTrigger& trigger) {
+        const SoundBankEntry& entry = SOUND_BANK[trigger.sound];
+        if (sounds[trigger.sound].length == 0) return;
+
+        // Ein Durchlauf: freie Stimme, aelteste gleiche Instanz, schwaechstes Opfer
+        Voice* freeVoice = nullptr;
+        Voice* oldestInstance = nullptr;
+        Voice* victim = nullptr;
+        int instances = 0;
+
+        for (Voice& voice : voices) {
+            if (!voice.active) {
+                if (!freeVoice) freeVoice = &voice;
+                continue;
+            }
+
+            if (voice.sound == trigger.sound) {
+                instances++;
+                if (!oldestInstance || voice.startOrder < oldestInstance->startOrder) oldestInstance = &voice;
+            }
+
+            uint8_t priority = SOUND_BANK[voice.sound].priority;
+            if (!victim || priority < SOUND_BANK[victim->sound].priority ||
+                (priority == SOUND_BANK[victim->sound].priority && voice.startOrder < victim->startOrder)) {
+                victim = &voice;
+            }
+        }
+
+        Voice* target = nullptr;
+        if (instances >= entry.maxInstances) {
+            target = oldestInstance;
+        }
+        else if (freeVoice) {
+            target = freeVoice;
+        }
+        else if (victim && SOUND_BANK[victim->sound].priority <= entry.priority) {
+            target = victim;
+        }
+
+        if (!target) {
+            rejectedTriggers.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (target->active) {
+            stolenVoices.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Gleiche Lautheit ueber das ganze Panorama
+        float angle = (std::clamp(trigger.pan, -1.0f, 1.0f) + 1.0f) * PI * 0.25f;
+        target->position = 0;
+        target->gainLeft = std::cos(angle) * entry.volume;
+        target->gainRight = std::sin(angle) * entry.volume;
+        target->startOrder = nextStartOrder++;
+        target->sound = trigger.sound;
+        target->active = true;
+    }
+
+    void AudioMixer::RunNullDevice() {
+        Tracer::GetInstance().SetThreadName("AudioNullDevice");
+
+        std::vector<float> block(GameConfig::AUDIO_BUFFER_FRAMES * CHANNELS);
+        auto period = std::chrono::microseconds(
+            1000000LL * GameConfig::AUDIO_BUFFER_FRAMES / GameConfig::AUDIO_SAMPLE_RATE);
+        auto next = std::chrono::steady_clock::now();
+
+        // Gleicher Takt wie ein echtes Geraet, das Ergebnis wird verworfen
+        while (running.load(std::memory_order_relaxed)) {
+            Mix(block.data(), GameConfig::AUDIO_BUFFER_FRAMES);
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    }
+
+    void AudioMixer::DeviceCallback(void* buffer, unsigned int frames) {
+        GetInstance().Mix((float*)buffer, frames);
+    }
+
+    void AudioMixer::SynthesizeFallback(SoundId sound, std::vector<float>& out) {
+        const FallbackTone& tone = FALLBACK_TONES[sound];
+        const float sampleRate = (float)GameConfig::AUDIO_SAMPLE_RATE;
+        size_t length = (size_t)(tone.duration * sampleRate);
+
+        out.resize(length);
+        float phase = 0.0f;
+        float filtered = 0.0f;
+        uint32_t noiseState = 0x2545F491u + sound;
+
+        for (size_t i = 0; i < length; i++) {
+            float t = (float)i / (float)length;
+
+            // Gleiten oder in Stufen springen (Arpeggio)
+            float progress = tone.steps > 1 ? std::floor(t * tone.steps) / (tone.steps - 1) : t;
+            float frequency = tone.startFrequency + (tone.endFrequency - tone.startFrequency) * progress;
+            phase += frequency / sampleRate;
+            phase -= std::floor(phase);
+
+            float wave = 0.0f;
+            switch (tone.waveform) {
+            case FALLBACK_SINE:   wave = std::sin(phase * 2.0f * PI); break;
+            case FALLBACK_SQUARE: wave = phase < 0.5f ? 1.0f : -1.0f; break;
+            case FALLBACK_SAW:    wave = phase * 2.0f - 1.0f; break;
+            }
+
+            noiseState ^= noiseState << 13;
+            noiseState ^= noiseState >> 17;
+            noiseState ^= noiseState << 5;
+            float noise = (float)(noiseState >> 8) * (2.0f / 16777216.0f) - 1.0f;
+            filtered += (noise - filtered) * (1.0f - tone.smoothing);
+
+            // 5 ms Einschwingen, danach quadratisch ausklingen
+            float attack = std::min(1.0f, (float)i / (0.005f * sampleRate));
+            float decay = (1.0f - t) * (1.0f - t);
+            out[i] = (wave * (1.0f - tone.noise) + filtered * tone.noise) * attack * decay * 0.8f;
+        }
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
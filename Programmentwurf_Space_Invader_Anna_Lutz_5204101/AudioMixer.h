@@ -0,0 +1,156 @@
+#pragma once
+
+#include "raylib.h"
+#include "GameConfig.h"
+#include "EventBus.h"
+#include "MusicStreamer.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    // === Soundeffekte (Index in SOUND_BANK) ===
+    enum SoundId : uint8_t {
+        SOUND_PLAYER_SHOT,
+        SOUND_LASER_SHOT,
+        SOUND_ENEMY_EXPLOSION,
+        SOUND_PLAYER_HIT,
+        SOUND_SHIELD_HIT,
+        SOUND_POWERUP_PICKUP,
+        SOUND_BOSS_HIT,
+        SOUND_BOSS_EXPLOSION,
+        SOUND_COUNT
+    };
+
+    /**
+     * @brief Eintrag der Sound-Bank
+     *
+     * Bei vollem Voice-Pool verdraengt ein Sound die Stimme mit der
+     * niedrigsten Prioritaet (bei Gleichstand die aelteste), aber nie eine
+     * hoeher priorisierte. Laufen schon maxInstances Instanzen desselben
+     * Sounds, wird die aelteste davon neu gestartet.
+     */
+    struct SoundBankEntry {
+        const char* filename;   // in AUDIO_FOLDER
+        uint8_t priority;
+        uint8_t maxInstances;
+        float volume;
+    };
+
+    inline constexpr SoundBankEntry SOUND_BANK[] = {
+        { "shot.wav",           1, 4, 0.35f },
+        { "laser.wav",          2, 2, 0.45f },
+        { "explosion.wav",      3, 6, 0.55f },
+        { "player_hit.wav",     6, 2, 0.8f },
+        { "shield_hit.wav",     5, 2, 0.6f },
+        { "pickup.wav",         5, 2, 0.7f },
+        { "boss_hit.wav",       4, 3, 0.5f },
+        { "boss_explosion.wav", 7, 1, 1.0f }
+    };
+
+    static_assert(sizeof(SOUND_BANK) / sizeof(SOUND_BANK[0]) == SOUND_COUNT,
+        "SOUND_BANK braucht einen Eintrag pro SoundId");
+
+    /**
+     * @brief Software-Mischer mit vorab dekodierten Sound-Banks und festem Voice-Pool
+     *
+     * Initialize dekodiert alle Sounds einmal nach Mono-float mit
+     * AUDIO_SAMPLE_RATE in einen gemeinsamen Puffer; fehlt eine Datei, wird
+     * ein einfacher Ersatzklang synthetisiert. Danach wird nichts mehr
+     * geladen oder allokiert.
+     *
+     * Play schreibt nur einen Trigger in einen SPSC-Kanal und kehrt sofort
+     * zurueck (lock-frei, Simulations-Thread). Gemischt wird im Callback des
+     * Audio-Geraets in Bloecken von AUDIO_BUFFER_FRAMES: Trigger abholen,
+     * Stimmen zuweisen oder verdraengen, Stimmen und Musik addieren, zum
+     * Schluss ein Limiter, damit viele gleichzeitige Explosionen nicht
+     * uebersteuern. Voices gehoeren ausschliesslich dem Audio-Thread.
+     *
+     * Ohne Audio-Geraet (oder mit AUDIO_ENABLED = false) laeuft derselbe
+     * Mischer auf einem Null-Device-Thread im Echtzeit-Takt und verwirft
+     * das Ergebnis.
+     */
+    class AudioMixer {
+    public:
+        // === Singleton Pattern ===
+        static AudioMixer& GetInstance();
+        ~AudioMixer();
+
+        // === Start & Stop (Haupt-Thread) ===
+        bool Initialize();  // false = Null-Device
+        void Shutdown();
+        bool IsNullDevice() const;
+
+        // === Ausloesen (Simulations-Thread, lock-frei) ===
+        void Play(SoundId sound, float pan = 0.0f);  // pan: -1 links, 0 Mitte, 1 rechts
+
+        // === Statistik ===
+        size_t GetActiveVoiceCount() const;
+
+        // === Constants ===
+        static const int CHANNELS = 2;
+        static const size_t TRIGGER_CAPACITY = 256;
+
+    private:
+        // === Singleton - Private Konstruktor ===
+        AudioMixer();
+        AudioMixer(const AudioMixer&) = delete;
+        AudioMixer& operator=(const AudioMixer&) = delete;
+
+        struct SoundTrigger {
+            SoundId sound;
+            float pan;
+        };
+
+        struct SoundRange {
+            size_t offset;  // in samplePool
+            size_t length;
+        };
+
+        struct Voice {
+            size_t position;  // naechstes Sample relativ zum Sound
+            float gainLeft;
+            float gainRight;
+            uint32_t startOrder;
+            SoundId sound;
+            bool active;
+        };
+
+        // === Sound-Banks (nach Initialize nur noch gelesen) ===
+        std::vector<float> samplePool;
+        std::array<SoundRange, SOUND_COUNT> sounds;
+
+        // === Mischer (Audio-Thread) ===
+        SpscChannel<SoundTrigger, TRIGGER_CAPACITY> triggers;
+        std::array<Voice, GameConfig::AUDIO_VOICE_COUNT> voices;
+        std::vector<float> musicBlock;
+        uint32_t nextStartOrder;
+        float limiterGain;
+        MusicStreamer music;
+
+        // === Ausgabe ===
+        AudioStream stream;
+        bool deviceOpen;
+        std::thread nullDevice;
+        std::atomic<bool> running;
+
+        // === Statistik ===
+        std::atomic<size_t> activeVoices;
+        std::atomic<size_t> stolenVoices;
+        std::atomic<size_t> rejectedTriggers;
+
+        // === Private Hilfsfunktionen ===
+        void LoadSoundBank();
+        void Mix(float* out, size_t frames);
+        void MixBlock(float* out, size_t frames);
+        void StartVoice(const SoundTrigger& trigger);
+        void RunNullDevice();
+        static void DeviceCallback(void* buffer, unsigned int frames);
+        static void SynthesizeFallback(SoundId sound, std::vector<float>& out);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -1,13 +1,26 @@
 #include "AvatarManager.h"
-#include "TextureManager.h"
-#include <fstream>
-#include <iostream>
 
 namespace SpaceInvaders {
 
+    namespace {
+
+        // Reihenfolge = AvatarType
+        constexpr CatalogEntry AVATAR_TABLE[] = {
+            { "Blauer Avatar",  "Standard Avatar - Keine besonderen Boni", "avatar_blue",   0 },
+            { "Gruener Avatar", "+10% Lebenspunkte (+1 Leben)",            "avatar_green",  GameConfig::AVATAR_COST },
+            { "Roter Avatar",   "+10% Projektilgeschwindigkeit",           "avatar_red",    GameConfig::AVATAR_COST },
+            { "Gelber Avatar",  "+10% Bewegungsgeschwindigkeit",           "avatar_yellow", GameConfig::AVATAR_COST },
+            { "Lila Avatar",    "+10% Schussfrequenz",                     "avatar_purple", GameConfig::AVATAR_COST },
+        };
+
+        constexpr CatalogLayout AVATAR_LAYOUT = { 120.0f, 160.0f, 150.0f, 16, 20, false };
+
+    } // namespace
+
     // === Konstruktor ===
     AvatarManager::AvatarManager()
-        : spCurrentSelection(0)
+        : catalog(AVATAR_TABLE, SaveContainer::SECTION_AVATAR_UNLOCKS, AVATAR_LAYOUT)
+        , spCurrentSelection(0)
         , spSelectedAvatar(AVATAR_BLUE)
         , spAvatarConfirmed(false)
         , spNotEnoughCoinsTimer(0.0f)
@@ -17,51 +30,26 @@ namespace SpaceInvaders {
         , mpPlayer2Avatar(AVATAR_GREEN)
         , mpPlayer1Confirmed(false)
         , mpPlayer2Confirmed(false)
+        , inputManager(nullptr)
     {
     }
 
     // === Initialisierung ===
     bool AvatarManager::Initialize() {
-        InitializeAvatarData();
-        LoadAvatarUnlocks();
+        catalog.LoadUnlocks();
         return true;
     }
 
-    void AvatarManager::LoadAvatarUnlocks() {
-        std::ifstream file(GameConfig::AVATAR_UNLOCKS_FILE);
-
-        // Standardmig alle gesperrt auer dem blauen Avatar
-        for (auto& avatar : avatars) {
-            avatar.isUnlocked = (avatar.type == AVATAR_BLUE);
-        }
-
-        if (file.is_open()) {
-            int avatarType;
-            while (file >> avatarType) {
-                if (avatarType >= 0 && avatarType < AVATAR_COUNT) {
-                    avatars[avatarType].isUnlocked = true;
-                }
-            }
-            file.close();
-        }
+    void AvatarManager::SetSaveSystem(SaveSystem* system) {
+        catalog.SetSaveSystem(system);
     }
 
-    void AvatarManager::SaveAvatarUnlocks() {
-        std::ofstream file(GameConfig::AVATAR_UNLOCKS_FILE);
-        if (file.is_open()) {
-            for (const auto& avatar : avatars) {
-                if (avatar.isUnlocked) {
-                    file << (int)avatar.type << "\n";
-                }
-            }
-            file.close();
-        }
+    void AvatarManager::SetInputManager(const InputManager* input) {
+        inputManager = input;
     }
 
     // === SinglePlayer Avatar-Auswahl ===
     AvatarManager::SinglePlayerResult AvatarManager::UpdateSinglePlayerSelection(float deltaTime, int& coins) {
-        UpdateButtonAnimations(deltaTime);
-
         if (spNotEnoughCoinsTimer > 0) {
             spNotEnoughCoinsTimer -= deltaTime;
         }
@@ -73,7 +61,7 @@ namespace SpaceInvaders {
         }
 
         // Prfen auf Zurck-Input
-        if (inputManager.GetNavigationInput() == InputManager::NAV_BACK) {
+        if (inputManager->GetNavigationInput() == InputManager::NAV_BACK) {
             return SP_BACK_PRESSED;
         }
 
@@ -89,11 +77,9 @@ namespace SpaceInvaders {
         int titleWidth = MeasureText(title, 40);
         DrawText(title, (GameConfig::SCREEN_WIDTH - titleWidth) / 2, 50, 40, WHITE);
 
-        // Avatar-Grid rendern
-        RenderAvatarGrid(false);
-
-        // Beschreibung des aktuell ausgewhlten Avatars
-        RenderAvatarDescription(avatars[spCurrentSelection].type);
+        // Avatar-Grid und Beschreibung des aktuell ausgewhlten Avatars
+        catalog.RenderGrid(spCurrentSelection, catalog.GetHoveredIndex(*inputManager), YELLOW);
+        catalog.RenderDescription(spCurrentSelection);
 
         // Anweisungen
         DrawText("Pfeiltasten: Navigieren | ENTER: Auswaehlen",
@@ -122,15 +108,14 @@ namespace SpaceInvaders {
     }
 
     // === MultiPlayer Avatar-Auswahl ===
-    AvatarManager::MultiPlayerResult AvatarManager::UpdateMultiPlayerSelection(float deltaTime) {
-        UpdateButtonAnimations(deltaTime);
+    AvatarManager::MultiPlayerResult AvatarManager::UpdateMultiPlayerSelection() {
         HandleMultiPlayerInput();
 
         if (mpPlayer1Confirmed && mpPlayer2Confirmed) {
             return MP_BOTH_CHOSEN;
         }
 
-        if (inputManager.GetNavigationInput() == InputManager::NAV_BACK) {
+        if (inputManager->GetNavigationInput() == InputManager::NAV_BACK) {
             return MP_BACK_PRESSED;
         }
 
@@ -153,8 +138,10 @@ namespace SpaceInvaders {
         int titleWidth = MeasureText(title, 40);
         DrawText(title, (GameConfig::SCREEN_WIDTH - titleWidth) / 2, 50, 40, WHITE);
 
-        // Avatar-Grid rendern
-        RenderAvatarGrid(true);
+        // Avatar-Grid in der Farbe des Spielers, der gerade whlt
+        int selectedIndex = mpPlayer1Confirmed ? mpPlayer2Selection : mpPlayer1Selection;
+        catalog.RenderGrid(selectedIndex, catalog.GetHoveredIndex(*inputManager),
+            mpPlayer1Confirmed ? SKYBLUE : YELLOW);
 
         // Auswahl-Indikatoren
         RenderSelectionIndicators();
@@ -187,299 +174,79 @@ namespace SpaceInvaders {
         mpPlayer2Confirmed = false;
     }
 
-    // === Avatar-Informationen ===
-    const AvatarInfo& AvatarManager::GetAvatarInfo(AvatarType type) const {
-        return avatars[(int)type];
-    }
-
-    std::string AvatarManager::GetAvatarDescription(AvatarType type) const {
-        return avatars[(int)type].description;
-    }
-
-    bool AvatarManager::IsAvatarUnlocked(AvatarType type) const {
-        return avatars[(int)type].isUnlocked;
-    }
-
-    bool AvatarManager::CanAfford(AvatarType type, int coins) const {
-        return coins >= avatars[(int)type].cost;
-    }
-
-    // === Avatar kaufen ===
-    bool AvatarManager::PurchaseAvatar(AvatarType type, int& coins) {
-        if (IsAvatarUnlocked(type)) return true;
-
-        if (CanAfford(type, coins)) {
-            coins -= avatars[(int)type].cost;
-            avatars[(int)type].isUnlocked = true;
-            SaveAvatarUnlocks();
-            return true;
-        }
-
-        return false;
+    // === Katalog ===
+    const AvatarManager::AvatarCatalog& AvatarManager::GetCatalog() const {
+        return catalog;
     }
 
     // === Private Hilfsfunktionen ===
-    void AvatarManager::InitializeAvatarData() {
-        avatars.resize(AVATAR_COUNT);
-
-        // Blauer Avatar (kostenlos)
-        avatars[AVATAR_BLUE] = {
-            AVATAR_BLUE,
-            "Blauer Avatar",
-            "Standard Avatar - Keine besonderen Boni",
-            0,
-            true, // Immer freigeschaltet
-            {}
-        };
-
-        // Grner Avatar
-        avatars[AVATAR_GREEN] = {
-            AVATAR_GREEN,
-            "Gruener Avatar",
-            "+10% Lebenspunkte (+1 Leben)",
-            GameConfig::AVATAR_COST,
-            false,
-            {}
-        };
-
-        // Roter Avatar
-        avatars[AVATAR_RED] = {
-            AVATAR_RED,
-            "Roter Avatar",
-            "+10% Projektilgeschwindigkeit",
-            GameConfig::AVATAR_COST,
-            false,
-            {}
-        };
-
-        // Gelber Avatar
-        avatars[AVATAR_YELLOW] = {
-            AVATAR_YELLOW,
-            "Gelber Avatar",
-            "+10% Bewegungsgeschwindigkeit",
-            GameConfig::AVATAR_COST,
-            false,
-            {}
-        };
-
-        // Lila Avatar
-        avatars[AVATAR_PURPLE] = {
-            AVATAR_PURPLE,
-            "Lila Avatar",
-            "+10% Schussfrequenz",
-            GameConfig::AVATAR_COST,
-            false,
-            {}
-        };
-    }
-
     void AvatarManager::HandleSinglePlayerInput(int& coins) {
-        auto navInput = inputManager.GetNavigationInput();
-
-        switch (navInput) {
-        case InputManager::NAV_LEFT:
-            spCurrentSelection = (spCurrentSelection - 1 + AVATAR_COUNT) % AVATAR_COUNT;
-            break;
-
-        case InputManager::NAV_RIGHT:
-            spCurrentSelection = (spCurrentSelection + 1) % AVATAR_COUNT;
+        switch (catalog.HandleShopInput(*inputManager, spCurrentSelection, coins)) {
+        case AvatarCatalog::CHOOSE_CONFIRMED:
+            spSelectedAvatar = AvatarCatalog::GetType(spCurrentSelection);
+            spAvatarConfirmed = true;
             break;
-
-        case InputManager::NAV_CONFIRM: {
-            AvatarType selectedType = avatars[spCurrentSelection].type;
-
-            if (IsAvatarUnlocked(selectedType)) {
-                spSelectedAvatar = selectedType;
-                spAvatarConfirmed = true;
-            }
-            else if (PurchaseAvatar(selectedType, coins)) {
-                spSelectedAvatar = selectedType;
-                spAvatarConfirmed = true;
-            }
-            else {
-                spNotEnoughCoinsTimer = 2.0f;
-            }
+        case AvatarCatalog::CHOOSE_NOT_ENOUGH_COINS:
+            spNotEnoughCoinsTimer = 2.0f;
             break;
-        }
-
         default:
             break;
         }
-
-        // Maus-Input fr Avatar-Karten
-        for (int i = 0; i < AVATAR_COUNT; i++) {
-            Rectangle avatarRect = GetAvatarRect(i, false);
-            if (UpdateAnimatedButton(avatarRect, avatars[i].buttonState, WHITE, YELLOW, ORANGE, GetFrameTime())) {
-                spCurrentSelection = i;
-                AvatarType selectedType = avatars[i].type;
-
-                if (IsAvatarUnlocked(selectedType)) {
-                    spSelectedAvatar = selectedType;
-                    spAvatarConfirmed = true;
-                }
-                else if (PurchaseAvatar(selectedType, coins)) {
-                    spSelectedAvatar = selectedType;
-                    spAvatarConfirmed = true;
-                }
-                else {
-                    spNotEnoughCoinsTimer = 2.0f;
-                }
-            }
-        }
     }
 
     void AvatarManager::HandleMultiPlayerInput() {
+        // Im Multiplayer sind alle Avatare ohne Kauf whlbar, die Spieler drfen nur nicht denselben nehmen
         if (!mpPlayer1Confirmed) {
             // Player 1 Input (A/D/W)
-            if (IsKeyPressed(KEY_A)) {
-                mpPlayer1Selection = (mpPlayer1Selection - 1 + AVATAR_COUNT) % AVATAR_COUNT;
-                // Sicherstellen dass Player 1 nicht den gleichen Avatar wie Player 2 whlt
-                if (mpPlayer1Selection == mpPlayer2Selection) {
-                    mpPlayer1Selection = (mpPlayer1Selection - 1 + AVATAR_COUNT) % AVATAR_COUNT;
-                }
+            if (inputManager->IsKeyPressed(KEY_A)) {
+                mpPlayer1Selection = StepSelection(mpPlayer1Selection, -1, mpPlayer2Selection);
             }
-            if (IsKeyPressed(KEY_D)) {
-                mpPlayer1Selection = (mpPlayer1Selection + 1) % AVATAR_COUNT;
-                if (mpPlayer1Selection == mpPlayer2Selection) {
-                    mpPlayer1Selection = (mpPlayer1Selection + 1) % AVATAR_COUNT;
-                }
+            if (inputManager->IsKeyPressed(KEY_D)) {
+                mpPlayer1Selection = StepSelection(mpPlayer1Selection, 1, mpPlayer2Selection);
             }
-            if (IsKeyPressed(KEY_W)) {
-                mpPlayer1Avatar = avatars[mpPlayer1Selection].type;
+            if (inputManager->IsKeyPressed(KEY_W)) {
+                mpPlayer1Avatar = AvatarCatalog::GetType(mpPlayer1Selection);
                 mpPlayer1Confirmed = true;
             }
         }
         else {
             // Player 2 Input (Pfeiltasten)
-            if (IsKeyPressed(KEY_LEFT)) {
-                mpPlayer2Selection = (mpPlayer2Selection - 1 + AVATAR_COUNT) % AVATAR_COUNT;
-                if (mpPlayer2Selection == mpPlayer1Selection) {
-                    mpPlayer2Selection = (mpPlayer2Selection - 1 + AVATAR_COUNT) % AVATAR_COUNT;
-                }
+            if (inputManager->IsKeyPressed(KEY_LEFT)) {
+                mpPlayer2Selection = StepSelection(mpPlayer2Selection, -1, mpPlayer1Selection);
             }
-            if (IsKeyPressed(KEY_RIGHT)) {
-                mpPlayer2Selection = (mpPlayer2Selection + 1) % AVATAR_COUNT;
-                if (mpPlayer2Selection == mpPlayer1Selection) {
-                    mpPlayer2Selection = (mpPlayer2Selection + 1) % AVATAR_COUNT;
-                }
+            if (inputManager->IsKeyPressed(KEY_RIGHT)) {
+                mpPlayer2Selection = StepSelection(mpPlayer2Selection, 1, mpPlayer1Selection);
             }
-            if (IsKeyPressed(KEY_UP)) {
-                mpPlayer2Avatar = avatars[mpPlayer2Selection].type;
+            if (inputManager->IsKeyPressed(KEY_UP)) {
+                mpPlayer2Avatar = AvatarCatalog::GetType(mpPlayer2Selection);
                 mpPlayer2Confirmed = true;
             }
         }
     }
 
-    void AvatarManager::RenderAvatarGrid(bool isMultiPlayer) {
-        const float avatarSize = 120.0f;
-        const float spacing = 160.0f;
-        const float startX = (GameConfig::SCREEN_WIDTH - (AVATAR_COUNT * spacing - (spacing - avatarSize))) / 2;
-        const float startY = 150.0f;
-
-        auto& textureManager = TextureManager::GetInstance();
-
-        for (int i = 0; i < AVATAR_COUNT; i++) {
-            Rectangle avatarRect = {
-                startX + i * spacing,
-                startY,
-                avatarSize,
-                avatarSize
-            };
-
-            bool isSelected = isMultiPlayer ?
-                ((!mpPlayer1Confirmed && i == mpPlayer1Selection) ||
-                    (mpPlayer1Confirmed && i == mpPlayer2Selection)) :
-                (i == spCurrentSelection);
-
-            bool isHovered = inputManager.IsMouseOverRectangle(avatarRect);
-
-            RenderAvatarCard(avatars[i], avatarRect, isSelected, isHovered, !mpPlayer1Confirmed);
-        }
-    }
-
-    void AvatarManager::RenderAvatarCard(const AvatarInfo& avatar, Rectangle rect, bool isSelected, bool isHovered, bool isPlayer1) {
-        auto& textureManager = TextureManager::GetInstance();
-
-        // Rahmen-Farbe bestimmen
-        Color frameColor = WHITE;
-        float frameThickness = 2.0f;
-
-        if (avatar.isUnlocked) {
-            if (isSelected) {
-                frameColor = isPlayer1 ? YELLOW : SKYBLUE;
-                frameThickness = 4.0f;
-            }
-            else if (isHovered) {
-                frameColor = LIGHTGRAY;
-                frameThickness = 3.0f;
-            }
-        }
-        else {
-            frameColor = DARKGRAY;
-        }
-
-        // Hintergrund
-        DrawRectangleRec(rect, Fade(BLACK, 0.8f));
-
-        // Avatar-Textur
-        Texture2D avatarTexture = textureManager.GetAvatarTexture(avatar.type);
-        Color tint = avatar.isUnlocked ? WHITE : Fade(GRAY, 0.5f);
-        TextureManager::DrawTextureScaled(avatarTexture, rect.x + 10, rect.y + 10, rect.width - 20, rect.height - 20, tint);
-
-        // Rahmen
-        DrawRectangleLinesEx(rect, frameThickness, frameColor);
-
-        // Schloss-Symbol fr gesperrte Avatare
-        if (!avatar.isUnlocked) {
-            DrawText("LOCKED", rect.x + 25, rect.y + rect.height - 30, 20, RED);
-
-            // Kosten anzeigen
-            auto& coinTexture = textureManager.GetCoinTexture();
-            TextureManager::DrawTextureScaled(coinTexture, rect.x + 5, rect.y + 5, 20, 20);
-            DrawText(TextFormat("%d", avatar.cost), rect.x + 30, rect.y + 5, 20, YELLOW);
-        }
-
-        // Name unter dem Avatar
-        const char* name = avatar.name.c_str();
-        int nameWidth = MeasureText(name, 16);
-        DrawText(name, rect.x + (rect.width - nameWidth) / 2, rect.y + rect.height + 5, 16, WHITE);
-    }
-
     void AvatarManager::RenderSelectionIndicators() {
         if (mpPlayer1Confirmed) {
             // Player 1 Auswahl anzeigen
-            Rectangle p1Rect = GetAvatarRect(mpPlayer1Selection, true);
+            Rectangle p1Rect = catalog.GetCardRect(mpPlayer1Selection);
             DrawRectangleLinesEx(p1Rect, 4, YELLOW);
             DrawText("P1", p1Rect.x + p1Rect.width - 30, p1Rect.y + 5, 20, YELLOW);
         }
 
         if (mpPlayer2Confirmed) {
             // Player 2 Auswahl anzeigen
-            Rectangle p2Rect = GetAvatarRect(mpPlayer2Selection, true);
+            Rectangle p2Rect = catalog.GetCardRect(mpPlayer2Selection);
             DrawRectangleLinesEx(p2Rect, 4, SKYBLUE);
             DrawText("P2", p2Rect.x + p2Rect.width - 30, p2Rect.y + 25, 20, SKYBLUE);
         }
     }
 
-    Rectangle AvatarManager::GetAvatarRect(int index, bool isMultiPlayer) {
-        const float avatarSize = 120.0f;
-        const float spacing = 160.0f;
-        const float startX = (GameConfig::SCREEN_WIDTH - (AVATAR_COUNT * spacing - (spacing - avatarSize))) / 2;
-        const float startY = 150.0f;
-
-        return {
-            startX + index * spacing,
-            startY,
-            avatarSize,
-            avatarSize
-        };
-    }
-
-    void AvatarManager::UpdateButtonAnimations(float deltaTime) {
-        for (auto& avatar : avatars) {
-            // Animation fr Hover-Effekte wird automatisch in UpdateAnimatedButton behandelt
-            // Hier knnten zustzliche Animationen hinzugefgt werden
+    int AvatarManager::StepSelection(int selection, int direction, int blocked) {
+        int next = (selection + direction + AVATAR_COUNT) % AVATAR_COUNT;
+        // Avatar des anderen Spielers berspringen
+        if (next == blocked) {
+            next = (next + direction + AVATAR_COUNT) % AVATAR_COUNT;
         }
+        return next;
     }
 
 } // namespace SpaceInvaders
\ No newline at end of file
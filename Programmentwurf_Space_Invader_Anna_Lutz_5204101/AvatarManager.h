@@ -3,42 +3,34 @@
 #include "raylib.h"
 #include "GameConfig.h"
 #include "InputManager.h"
-#include <vector>
-#include <string>
+#include "SaveSystem.h"
+#include "UnlockCatalog.h"
 
 namespace SpaceInvaders {
 
-    /**
-     * @brief Avatar-Informations-Struktur
-     */
-    struct AvatarInfo {
-        AvatarType type;
-        std::string name;
-        std::string description;
-        int cost;
-        bool isUnlocked;
-        ButtonState buttonState;
-    };
-
     /**
      * @brief AvatarManager - Verwaltet Avatar-Auswahl und -Freischaltung
      *
      * Zustndig fr:
-     * - Avatar-Freischaltung mit Coins
      * - Auswahl-Interface (SinglePlayer & MultiPlayer)
-     * - Avatar-Informationen und Beschreibungen
-     * - Speichern/Laden der freigeschalteten Avatare
+     * - Kauf, Freischaltung und Grid ber den Avatar-Katalog
+     *   (Tabelle in AvatarManager.cpp)
      */
     class AvatarManager {
     public:
+        // === Constants ===
+        static const int AVATAR_COUNT = 5;
+
+        using AvatarCatalog = UnlockCatalog<AvatarType, AVATAR_COUNT>;
+
         // === Konstruktor & Destruktor ===
         AvatarManager();
         ~AvatarManager() = default;
 
         // === Initialisierung ===
         bool Initialize();
-        void LoadAvatarUnlocks();
-        void SaveAvatarUnlocks();
+        void SetSaveSystem(SaveSystem* system);
+        void SetInputManager(const InputManager* input);
 
         // === SinglePlayer Avatar-Auswahl ===
         enum SinglePlayerResult {
@@ -60,27 +52,18 @@ namespace SpaceInvaders {
             MP_BACK_PRESSED
         };
 
-        MultiPlayerResult UpdateMultiPlayerSelection(float deltaTime);
+        MultiPlayerResult UpdateMultiPlayerSelection();
         void RenderMultiPlayerSelection();
         AvatarType GetPlayer1Avatar() const;
         AvatarType GetPlayer2Avatar() const;
         void ResetMultiPlayerSelection();
 
-        // === Avatar-Informationen ===
-        const AvatarInfo& GetAvatarInfo(AvatarType type) const;
-        std::string GetAvatarDescription(AvatarType type) const;
-        bool IsAvatarUnlocked(AvatarType type) const;
-        bool CanAfford(AvatarType type, int coins) const;
-
-        // === Avatar kaufen ===
-        bool PurchaseAvatar(AvatarType type, int& coins);
-
-        // === Constants ===
-        static const int AVATAR_COUNT = 5;
+        // === Katalog (Namen, Kosten, Freischaltung) ===
+        const AvatarCatalog& GetCatalog() const;
 
     private:
-        // === Avatar-Daten ===
-        std::vector<AvatarInfo> avatars;
+        // === Avatar-Katalog ===
+        AvatarCatalog catalog;
 
         // === SinglePlayer State ===
         int spCurrentSelection;
@@ -97,21 +80,13 @@ namespace SpaceInvaders {
         bool mpPlayer2Confirmed;
 
         // === Input ===
-        InputManager inputManager;
+        const InputManager* inputManager;  // gehrt Game, Snapshot des aktuellen Frames
 
         // === Private Hilfsfunktionen ===
-        void InitializeAvatarData();
         void HandleSinglePlayerInput(int& coins);
         void HandleMultiPlayerInput();
-        void RenderAvatarGrid(bool isMultiPlayer = false);
-        void RenderAvatarCard(const AvatarInfo& avatar, Rectangle rect, bool isSelected, bool isHovered, bool isPlayer1 = true);
-        void RenderAvatarDescription(AvatarType type);
-        void RenderCoinDisplay(int coins);
         void RenderSelectionIndicators();
-        Rectangle GetAvatarRect(int index, bool isMultiPlayer = false);
-
-        // === Animation ===
-        void UpdateButtonAnimations(float deltaTime);
+        static int StepSelection(int selection, int direction, int blocked);
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
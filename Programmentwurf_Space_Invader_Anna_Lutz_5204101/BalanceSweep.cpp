@@ -0,0 +1,237 @@
+#include "BalanceSweep.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        const char* const difficultyNames[] = { "Leicht", "Mittel", "Schwer" };
+        const char* const avatarNames[] = { "Blau", "Gruen", "Rot", "Gelb", "Lila" };
+        const char* const modNames[] = { "Kein Mod", "Schnellfeuer", "Schild", "Triple-Shot", "Zeitlupe" };
+
+        // Perzentil nach Nearest-Rank auf bereits sortierten Werten
+        template <typename T>
+        T Percentile(const std::vector<T>& sorted, float fraction) {
+            if (sorted.empty()) return T();
+            size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5f);
+            return sorted[std::min(index, sorted.size() - 1)];
+        }
+
+        template <typename T>
+        double Mean(const std::vector<T>& values) {
+            if (values.empty()) return 0.0;
+            double sum = 0.0;
+            for (T value : values) sum += value;
+            return sum / values.size();
+        }
+
+    } // namespace
+
+    // === Konstruktor ===
+    BalanceSweep::BalanceSweep(const SweepOptions& options)
+        : options(options)
+        , nextJob(0)
+        , finishedJobs(0)
+    {
+    }
+
+    // === Ausfuehrung ===
+    bool BalanceSweep::Run() {
+        BuildConfigurations();
+
+        size_t jobCount = configurations.size() * options.gamesPerConfiguration;
+        results.assign(jobCount, MatchResult());
+        nextJob = 0;
+        finishedJobs = 0;
+
+        unsigned int threadCount = options.threadCount;
+        if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        Logger::Info("Balance-Sweep: %zu Konfigurationen x %d Partien auf %d Threads",
+            configurations.size(), options.gamesPerConfiguration, (int)threadCount);
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        for (unsigned int i = 0; i < threadCount; i++) {
+            workers.emplace_back(&BalanceSweep::RunWorker, this);
+        }
+
+        // Fortschritt in 10%-Schritten melden
+        size_t reported = 0;
+        while (finishedJobs.load() < jobCount) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            size_t done = finishedJobs.load();
+            if (done * 10 / jobCount > reported) {
+                reported = done * 10 / jobCount;
+                Logger::Info("Balance-Sweep: %zu / %zu Partien", done, jobCount);
+            }
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+        Logger::Info("Balance-Sweep fertig nach %.2f s", seconds);
+
+        bool ok = WriteSummary(options.outputFile);
+        ok = WriteRuns(GetRunsPath(options.outputFile)) && ok;
+        return ok;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void BalanceSweep::BuildConfigurations() {
+        configurations.clear();
+
+        for (int diff = 0; diff < DIFFICULTY_COUNT; diff++) {
+            GameConfig::BalanceParameters defaults = GameConfig::GetDefaultBalance((Difficulty)diff);
+
+            for (int avatar = 0; avatar < AVATAR_COUNT; avatar++) {
+                for (int mod = 0; mod < MOD_COUNT; mod++) {
+                    for (float spawnFactor : options.spawnIntervalFactors) {
+                        for (float cooldownFactor : options.shootCooldownFactors) {
+                            for (float dropFactor : options.dropChanceFactors) {
+                                Configuration config;
+                                config.difficulty = (Difficulty)diff;
+                                config.avatar = (AvatarType)avatar;
+                                config.mod = (ModType)mod;
+                                config.balance.enemySpawnInterval = defaults.enemySpawnInterval * spawnFactor;
+                                config.balance.enemyShootCooldown = defaults.enemyShootCooldown * cooldownFactor;
+                                config.balance.powerUpDropChance = std::min(1.0f, defaults.powerUpDropChance * dropFactor);
+                                configurations.push_back(config);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void BalanceSweep::RunWorker() {
+        size_t jobCount = results.size();
+        size_t games = (size_t)options.gamesPerConfiguration;
+
+        // Jeder Job schreibt nur in seinen eigenen Ergebnis-Slot
+        for (size_t job = nextJob.fetch_add(1); job < jobCount; job = nextJob.fetch_add(1)) {
+            const Configuration& config = configurations[job / games];
+
+            MatchSettings settings;
+            settings.avatar = config.avatar;
+            settings.mod = config.mod;
+            settings.difficulty = config.difficulty;
+            settings.balance = config.balance;
+            settings.seed = options.baseSeed + (unsigned int)job;
+            settings.maxDuration = options.maxMatchDuration;
+
+            HeadlessMatch match(settings);
+            results[job] = match.Run();
+
+            finishedJobs.fetch_add(1);
+        }
+    }
+
+    bool BalanceSweep::WriteSummary(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            Logger::Error("Konnte %s nicht schreiben!", path.c_str());
+            return false;
+        }
+
+        file << "difficulty,avatar,mod,enemy_spawn_interval,enemy_shoot_cooldown,powerup_drop_chance,"
+            << "games,timeouts,"
+            << "survival_mean,survival_p10,survival_p50,survival_p90,"
+            << "score_mean,score_p10,score_p50,score_p90,"
+            << "boss_kills_mean,boss_kills_0,boss_kills_1,boss_kills_2,boss_kills_3plus\n";
+
+        size_t games = (size_t)options.gamesPerConfiguration;
+        std::vector<float> survival;
+        std::vector<int> scores;
+        std::vector<int> bossKills;
+
+        for (size_t c = 0; c < configurations.size(); c++) {
+            const Configuration& config = configurations[c];
+
+            survival.clear();
+            scores.clear();
+            bossKills.clear();
+            int timeouts = 0;
+            int bossHistogram[4] = { 0, 0, 0, 0 };
+
+            for (size_t g = 0; g < games; g++) {
+                const MatchResult& result = results[c * games + g];
+                survival.push_back(result.survivalTime);
+                scores.push_back(result.score);
+                bossKills.push_back(result.bossesDefeated);
+                bossHistogram[std::min(result.bossesDefeated, 3)]++;
+                if (result.timedOut) timeouts++;
+            }
+
+            std::sort(survival.begin(), survival.end());
+            std::sort(scores.begin(), scores.end());
+
+            file << difficultyNames[config.difficulty] << ','
+                << avatarNames[config.avatar] << ','
+                << modNames[config.mod] << ','
+                << config.balance.enemySpawnInterval << ','
+                << config.balance.enemyShootCooldown << ','
+                << config.balance.powerUpDropChance << ','
+                << games << ',' << timeouts << ','
+                << Mean(survival) << ',' << Percentile(survival, 0.1f) << ','
+                << Percentile(survival, 0.5f) << ',' << Percentile(survival, 0.9f) << ','
+                << Mean(scores) << ',' << Percentile(scores, 0.1f) << ','
+                << Percentile(scores, 0.5f) << ',' << Percentile(scores, 0.9f) << ','
+                << Mean(bossKills) << ',' << bossHistogram[0] << ',' << bossHistogram[1] << ','
+                << bossHistogram[2] << ',' << bossHistogram[3] << '\n';
+        }
+
+        Logger::Info("Balance-Zusammenfassung gespeichert: %s", path.c_str());
+        return true;
+    }
+
+    bool BalanceSweep::WriteRuns(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            Logger::Error("Konnte %s nicht schreiben!", path.c_str());
+            return false;
+        }
+
+        file << "configuration,difficulty,avatar,mod,enemy_spawn_interval,enemy_shoot_cooldown,powerup_drop_chance,"
+            << "seed,survival_time,score,enemies_killed,bosses_defeated,timed_out\n";
+
+        size_t games = (size_t)options.gamesPerConfiguration;
+        for (size_t job = 0; job < results.size(); job++) {
+            const Configuration& config = configurations[job / games];
+            const MatchResult& result = results[job];
+
+            file << job / games << ','
+                << difficultyNames[config.difficulty] << ','
+                << avatarNames[config.avatar] << ','
+                << modNames[config.mod] << ','
+                << config.balance.enemySpawnInterval << ','
+                << config.balance.enemyShootCooldown << ','
+                << config.balance.powerUpDropChance << ','
+                << options.baseSeed + (unsigned int)job << ','
+                << result.survivalTime << ',' << result.score << ','
+                << result.enemiesKilled << ',' << result.bossesDefeated << ','
+                << (result.timedOut ? 1 : 0) << '\n';
+        }
+
+        Logger::Info("Einzelpartien gespeichert: %s", path.c_str());
+        return true;
+    }
+
+    std::string BalanceSweep::GetRunsPath(const std::string& summaryPath) {
+        size_t dot = summaryPath.find_last_of('.');
+        size_t slash = summaryPath.find_last_of("/\\");
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+            return summaryPath + "_runs";
+        }
+        return summaryPath.substr(0, dot) + "_runs" + summaryPath.substr(dot);
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "GameConfig.h"
+#include "HeadlessMatch.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Optionen fuer einen Balance-Sweep
+     *
+     * Die Faktoren werden auf die Standardwerte des jeweiligen
+     * Schwierigkeitsgrads angewendet (1.0 = aktuelle Konstanten).
+     */
+    struct SweepOptions {
+        int gamesPerConfiguration = 20;
+        unsigned int threadCount = 0;      // 0 = alle Kerne
+        unsigned int baseSeed = 12345;
+        float maxMatchDuration = 600.0f;
+        std::string outputFile = "balance_sweep.csv";
+        std::vector<float> spawnIntervalFactors = { 0.75f, 1.0f, 1.25f };
+        std::vector<float> shootCooldownFactors = { 0.75f, 1.0f, 1.25f };
+        std::vector<float> dropChanceFactors = { 0.5f, 1.0f, 1.5f };
+    };
+
+    /**
+     * @brief Stapel-Werkzeug fuer Balancing-Tests mit Bot-Spielern
+     *
+     * Spielt fuer jede Kombination aus Schwierigkeitsgrad, Avatar, Start-Mod
+     * und Balancing-Parametern mehrere kopflose Partien auf allen Kernen und
+     * schreibt die Verteilungen von Ueberlebenszeit, Score und Boss-Siegen
+     * als CSV (eine Zeile pro Konfiguration, plus alle Einzelpartien in
+     * <Datei>_runs.csv).
+     */
+    class BalanceSweep {
+    public:
+        // === Konstruktor ===
+        explicit BalanceSweep(const SweepOptions& options);
+
+        // === Ausfuehrung ===
+        bool Run();
+
+    private:
+        /**
+         * @brief Eine Kombination der gesweepten Parameter
+         */
+        struct Configuration {
+            Difficulty difficulty;
+            AvatarType avatar;
+            ModType mod;
+            GameConfig::BalanceParameters balance;
+        };
+
+        // === Private Hilfsfunktionen ===
+        void BuildConfigurations();
+        void RunWorker();
+        bool WriteSummary(const std::string& path) const;
+        bool WriteRuns(const std::string& path) const;
+        static std::string GetRunsPath(const std::string& summaryPath);
+
+        // === Daten ===
+        SweepOptions options;
+        std::vector<Configuration> configurations;
+        std::vector<MatchResult> results;   // configurations.size() * gamesPerConfiguration
+        std::atomic<size_t> nextJob;
+        std::atomic<size_t> finishedJobs;
+
+        // === Constants ===
+        static const int AVATAR_COUNT = 5;
+        static const int MOD_COUNT = 5;
+        static const int DIFFICULTY_COUNT = 3;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Boss.h"
 #include "TextureManager.h"
 #include "EnemyBullet.h"
+#include <algorithm>
 #include <cmath>
 
 namespace SpaceInvaders {
@@ -11,25 +12,41 @@ namespace SpaceInvaders {
     const int Boss::DEFAULT_HEALTH = 20;
 
     // === Konstruktor ===
-    Boss::Boss(Vector2 startPosition, Difficulty difficulty)
+    Boss::Boss(SimVector2 startPosition, Difficulty difficulty)
         : position(startPosition)
         , startPosition(startPosition)
-        , width(DEFAULT_WIDTH)
-        , height(DEFAULT_HEIGHT)
+        , width(SimScalar(DEFAULT_WIDTH))
+        , height(SimScalar(DEFAULT_HEIGHT))
         , difficulty(difficulty)
         , active(true)
-        , movementTimer(0.0f)
-        , shootTimer(0.0f)
+        , movementTimer(0)
+        , lastShotTick(TimerWheel::GetWorldTimers().GetCurrentTick())
     {
         InitializeBossProperties();
     }
 
+    Boss::Boss(const State& state)
+        : Boss(state.startPosition, (Difficulty)state.difficulty)
+    {
+        position = state.position;
+        movementTimer = state.movementTimer;
+        currentHealth = state.currentHealth;
+        lastShotTick = TimerWheel::GetWorldTimers().GetCurrentTick() - state.ticksSinceShot;
+        active = state.active;
+    }
+
+    // === Snapshot ===
+    Boss::State Boss::CaptureState() const {
+        uint64_t sinceShot = TimerWheel::GetWorldTimers().GetTicksSince(lastShotTick);
+        return { position, startPosition, movementTimer, currentHealth,
+            (uint32_t)std::min<uint64_t>(sinceShot, UINT32_MAX), (uint8_t)difficulty, active, {} };
+    }
+
     // === Update ===
     void Boss::Update(float deltaTime) {
         if (!active) return;
 
         UpdateMovement(deltaTime);
-        UpdateShooting(deltaTime);
     }
 
     // === Render ===
@@ -40,7 +57,9 @@ namespace SpaceInvaders {
         Texture2D bossTexture = textureManager.GetBossTexture();
 
         // Boss mit leichtem Schttel-Effekt bei niedrigem Leben
-        Vector2 renderPos = position;
+        Vector2 renderPos = ToVector2(position);
+        float renderWidth = ToFloat(width);
+        float renderHeight = ToFloat(height);
         if (GetHealthPercentage() < 0.3f) {
             // Schttel-Effekt wenn Boss fast tot ist
             float shakeIntensity = 3.0f;
@@ -51,12 +70,12 @@ namespace SpaceInvaders {
         // Boss-Textur rendern
         TextureManager::DrawTextureScaled(bossTexture,
             renderPos.x, renderPos.y,
-            width, height);
+            renderWidth, renderHeight);
 
         // Schatten-Effekt
         TextureManager::DrawTextureScaled(bossTexture,
             renderPos.x + 5, renderPos.y + 5,
-            width, height, Fade(BLACK, 0.3f));
+            renderWidth, renderHeight, Fade(BLACK, 0.3f));
     }
 
     void Boss::RenderHealthBar() const {
@@ -88,11 +107,11 @@ namespace SpaceInvaders {
     }
 
     // === Getters ===
-    Vector2 Boss::GetPosition() const {
+    SimVector2 Boss::GetPosition() const {
         return position;
     }
 
-    Rectangle Boss::GetBounds() const {
+    SimRect Boss::GetBounds() const {
         return { position.x, position.y, width, height };
     }
 
@@ -109,45 +128,45 @@ namespace SpaceInvaders {
     }
 
     // === Shooting System ===
-    std::vector<std::unique_ptr<EnemyBullet>> Boss::Shoot() {
-        std::vector<std::unique_ptr<EnemyBullet>> bullets;
-
-        if (!WantsToShoot()) return bullets;
+    void Boss::Shoot(std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets) {
+        // Schuesse direkt an die Ziel-Liste anhaengen (kein temporaerer Vektor)
+        if (!WantsToShoot()) return;
 
         ResetShootTimer();
 
         // Mehrere Schsse basierend auf Schwierigkeit
-        float bulletSpeed = GetBulletSpeed();
-        Vector2 leftShoot = { position.x + width * 0.25f, position.y + height };
-        Vector2 rightShoot = { position.x + width * 0.75f, position.y + height };
+        SimScalar bulletSpeed = GetBulletSpeed();
+        SimScalar muzzleY = position.y + height;
+        SimVector2 leftShoot = { position.x + width / 4, muzzleY };
+        SimVector2 rightShoot = { position.x + width * 3 / 4, muzzleY };
 
         // Basis-Schsse (immer)
-        bullets.push_back(std::make_unique<EnemyBullet>(leftShoot, bulletSpeed, BLUE));
-        bullets.push_back(std::make_unique<EnemyBullet>(rightShoot, bulletSpeed, BLUE));
+        enemyBullets.push_back(std::make_unique<EnemyBullet>(leftShoot, bulletSpeed, BLUE));
+        enemyBullets.push_back(std::make_unique<EnemyBullet>(rightShoot, bulletSpeed, BLUE));
 
         // Zustzliche Schsse bei hherer Schwierigkeit
         if (difficulty >= DIFF_MEDIUM) {
-            Vector2 centerShoot = { position.x + width * 0.5f, position.y + height };
-            bullets.push_back(std::make_unique<EnemyBullet>(centerShoot, bulletSpeed, DARKBLUE));
+            SimVector2 centerShoot = { position.x + width / 2, muzzleY };
+            enemyBullets.push_back(std::make_unique<EnemyBullet>(centerShoot, bulletSpeed, DARKBLUE));
         }
 
         if (difficulty >= DIFF_HARD) {
             // Diagonal-Schsse
-            Vector2 leftDiag = { position.x + width * 0.15f, position.y + height };
-            Vector2 rightDiag = { position.x + width * 0.85f, position.y + height };
-            bullets.push_back(std::make_unique<EnemyBullet>(leftDiag, bulletSpeed * 0.8f, PURPLE));
-            bullets.push_back(std::make_unique<EnemyBullet>(rightDiag, bulletSpeed * 0.8f, PURPLE));
+            SimVector2 leftDiag = { position.x + width * 15 / 100, muzzleY };
+            SimVector2 rightDiag = { position.x + width * 85 / 100, muzzleY };
+            SimScalar diagonalSpeed = bulletSpeed * 4 / 5;
+            enemyBullets.push_back(std::make_unique<EnemyBullet>(leftDiag, diagonalSpeed, PURPLE));
+            enemyBullets.push_back(std::make_unique<EnemyBullet>(rightDiag, diagonalSpeed, PURPLE));
         }
-
-        return bullets;
     }
 
     bool Boss::WantsToShoot() const {
-        return shootTimer >= shootCooldown;
+        uint64_t elapsed = TimerWheel::GetWorldTimers().GetTicksSince(lastShotTick);
+        return elapsed >= TimerWheel::SecondsToTicks(shootCooldown);
     }
 
     void Boss::ResetShootTimer() {
-        shootTimer = 0.0f;
+        lastShotTick = TimerWheel::GetWorldTimers().GetCurrentTick();
     }
 
     // === Combat ===
@@ -183,15 +202,15 @@ namespace SpaceInvaders {
 
         // Bewegungsparameter
         horizontalSpeed = GetMovementSpeed();
-        verticalSpeed = horizontalSpeed * 0.5f;
-        movementAmplitude = 100.0f + 40.0f * GetDifficultyMultiplier();
+        verticalSpeed = horizontalSpeed / 2;
+        movementAmplitude = SimScalar(100) + SimScalar(40) * GetDifficultyMultiplier();
 
         // Schuss-Cooldown
         shootCooldown = GetShootCooldown();
     }
 
     void Boss::UpdateMovement(float deltaTime) {
-        movementTimer += deltaTime;
+        movementTimer += SimScalar(deltaTime);
         position = CalculateMovementPattern(movementTimer);
 
         // Grenzen einhalten
@@ -203,43 +222,40 @@ namespace SpaceInvaders {
         if (position.y > 150) position.y = 150;
     }
 
-    void Boss::UpdateShooting(float deltaTime) {
-        shootTimer += deltaTime;
-    }
-
-    Vector2 Boss::CalculateMovementPattern(float time) const {
+    SimVector2 Boss::CalculateMovementPattern(SimScalar time) const {
         // Komplexes Bewegungsmuster: Horizontal-Sinus + Vertikal-Cosinus
-        float centerX = startPosition.x;
-        float centerY = startPosition.y;
+        SimScalar centerX = startPosition.x;
+        SimScalar centerY = startPosition.y;
 
-        float x = centerX + movementAmplitude * sinf(time * horizontalSpeed);
-        float y = centerY + 20.0f * sinf(time * verticalSpeed * 2.0f);
+        SimScalar x = centerX + movementAmplitude * SimMath::Sin(time * horizontalSpeed);
+        SimScalar y = centerY + SimScalar(20) * SimMath::Sin(time * verticalSpeed * 2);
 
         return { x, y };
     }
 
     // === Schwierigkeitsabhngige Werte ===
-    float Boss::GetDifficultyMultiplier() const {
+    SimScalar Boss::GetDifficultyMultiplier() const {
         switch (difficulty) {
-        case DIFF_EASY:   return 0.8f;
-        case DIFF_MEDIUM: return 1.0f;
-        case DIFF_HARD:   return 1.5f;
-        default:          return 1.0f;
+        case DIFF_EASY:   return SimScalar(0.8f);
+        case DIFF_MEDIUM: return SimScalar(1);
+        case DIFF_HARD:   return SimScalar(1.5f);
+        default:          return SimScalar(1);
         }
     }
 
-    float Boss::GetMovementSpeed() const {
-        return 1.0f + 0.3f * GetDifficultyMultiplier();
+    SimScalar Boss::GetMovementSpeed() const {
+        return SimScalar(1) + SimScalar(0.3f) * GetDifficultyMultiplier();
     }
 
     float Boss::GetShootCooldown() const {
+        // Wird nur in Ticks umgerechnet, der Teiler kommt schon aus der Simulation
         float baseCooldown = 2.0f;
-        return baseCooldown / (1.0f + 0.5f * GetDifficultyMultiplier());
+        return baseCooldown / ToFloat(SimScalar(1) + SimScalar(0.5f) * GetDifficultyMultiplier());
     }
 
-    float Boss::GetBulletSpeed() const {
-        float baseSpeed = 320.0f;
-        return baseSpeed + 60.0f * GetDifficultyMultiplier();
+    SimScalar Boss::GetBulletSpeed() const {
+        SimScalar baseSpeed = SimScalar(320);
+        return baseSpeed + SimScalar(60) * GetDifficultyMultiplier();
     }
 
 } // namespace SpaceInvaders
\ No newline at end of file
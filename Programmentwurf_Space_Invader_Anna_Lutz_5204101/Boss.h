@@ -2,8 +2,11 @@
 
 #include "raylib.h"
 #include "GameConfig.h"
+#include "TimerWheel.h"
+#include "SimMath.h"
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 namespace SpaceInvaders {
 
@@ -22,23 +25,38 @@ namespace SpaceInvaders {
     class Boss {
     public:
         // === Konstruktor & Destruktor ===
-        Boss(Vector2 startPosition, Difficulty difficulty);
+        Boss(SimVector2 startPosition, Difficulty difficulty);
         ~Boss() = default;
 
+        // === Snapshot (POD, abgeleitete Werte kommen aus dem Schwierigkeitsgrad) ===
+        struct State {
+            SimVector2 position;
+            SimVector2 startPosition;
+            SimScalar movementTimer;
+            int32_t currentHealth;
+            uint32_t ticksSinceShot;
+            uint8_t difficulty;
+            bool active;
+            uint8_t reserved[2];  // kein implizites Padding
+        };
+
+        explicit Boss(const State& state);
+        State CaptureState() const;
+
         // === Update & Render ===
         void Update(float deltaTime);
         void Render() const;
         void RenderHealthBar() const;
 
         // === Getters ===
-        Vector2 GetPosition() const;
-        Rectangle GetBounds() const;
+        SimVector2 GetPosition() const;
+        SimRect GetBounds() const;
         int GetCurrentHealth() const;
         int GetMaxHealth() const;
         float GetHealthPercentage() const;
 
         // === Shooting System ===
-        std::vector<std::unique_ptr<EnemyBullet>> Shoot();
+        void Shoot(std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets);
         bool WantsToShoot() const;
         void ResetShootTimer();
 
@@ -55,35 +73,34 @@ namespace SpaceInvaders {
 
     private:
         // === Eigenschaften ===
-        Vector2 position;
-        Vector2 startPosition;
-        float width, height;
+        SimVector2 position;
+        SimVector2 startPosition;
+        SimScalar width, height;
         int currentHealth;
         int maxHealth;
         bool active;
         Difficulty difficulty;
 
         // === Bewegung ===
-        float movementTimer;
-        float horizontalSpeed;
-        float verticalSpeed;
-        float movementAmplitude;
+        SimScalar movementTimer;
+        SimScalar horizontalSpeed;  // Kreisfrequenz (rad/s)
+        SimScalar verticalSpeed;
+        SimScalar movementAmplitude;
 
-        // === Shooting ===
-        float shootTimer;
+        // === Shooting (Cooldown gegen die Tick-Uhr der Spielwelt) ===
+        uint64_t lastShotTick;
         float shootCooldown;
 
         // === Private Hilfsfunktionen ===
         void InitializeBossProperties();
         void UpdateMovement(float deltaTime);
-        void UpdateShooting(float deltaTime);
-        Vector2 CalculateMovementPattern(float time) const;
+        SimVector2 CalculateMovementPattern(SimScalar time) const;
 
         // === Schwierigkeitsabhngige Werte ===
-        float GetDifficultyMultiplier() const;
-        float GetMovementSpeed() const;
+        SimScalar GetDifficultyMultiplier() const;
+        SimScalar GetMovementSpeed() const;
         float GetShootCooldown() const;
-        float GetBulletSpeed() const;
+        SimScalar GetBulletSpeed() const;
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
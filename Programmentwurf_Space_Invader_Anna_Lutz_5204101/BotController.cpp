@@ -0,0 +1,114 @@
+#include "BotController.h"
+#include <cmath>
+
+namespace SpaceInvaders {
+
+    // === Constants ===
+    const float BotController::LOOKAHEAD_DISTANCE = 260.0f;
+    const float BotController::DODGE_MARGIN = 12.0f;
+    const float BotController::REACTION_TIME = 0.25f;
+    const float BotController::TARGET_TOLERANCE = 8.0f;
+
+    // === Entscheidung pro Frame ===
+    BotInput BotController::DecideInput(const Player& player,
+        const std::vector<std::unique_ptr<Enemy>>& enemies,
+        const std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+        const Boss* boss,
+        float baseMovementSpeed,
+        float deltaTime) const {
+
+        BotInput input;
+        input.shoot = player.CanShoot();
+
+        float currentX = ToFloat(player.GetPosition().x);
+        float speed = baseMovementSpeed * player.GetMovementSpeedMultiplier();
+        float step = speed * REACTION_TIME;
+        float maxX = GameConfig::SCREEN_WIDTH - Player::AVATAR_WIDTH;
+
+        // Drei Kandidaten: stehen bleiben, nach links oder nach rechts ausweichen
+        float leftX = std::fmax(0.0f, currentX - step);
+        float rightX = std::fmin(maxX, currentX + step);
+
+        float dangerHere = EvaluateDanger(currentX, player, enemies, enemyBullets);
+        if (dangerHere > 0.0f) {
+            float dangerLeft = EvaluateDanger(leftX, player, enemies, enemyBullets);
+            float dangerRight = EvaluateDanger(rightX, player, enemies, enemyBullets);
+
+            if (dangerLeft < dangerHere || dangerRight < dangerHere) {
+                input.left = dangerLeft <= dangerRight;
+                input.right = !input.left;
+                return input;
+            }
+        }
+
+        // Keine Gefahr: unter das Ziel fahren, aber nicht in eine Gefahr hinein
+        float targetX = FindTargetX(player, enemies, boss);
+        float offset = targetX - currentX;
+        if (std::fabs(offset) <= TARGET_TOLERANCE) return input;
+
+        float nextX = currentX + (offset < 0.0f ? -1.0f : 1.0f) * std::fmin(std::fabs(offset), speed * deltaTime);
+        if (EvaluateDanger(nextX, player, enemies, enemyBullets) <= dangerHere) {
+            input.left = offset < 0.0f;
+            input.right = offset > 0.0f;
+        }
+
+        return input;
+    }
+
+    // === Private Hilfsfunktionen ===
+    float BotController::EvaluateDanger(float playerX, const Player& player,
+        const std::vector<std::unique_ptr<Enemy>>& enemies,
+        const std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets) const {
+
+        Rectangle bounds = ToRectangle(player.GetBounds());
+        float left = playerX - DODGE_MARGIN;
+        float right = playerX + Player::AVATAR_WIDTH + DODGE_MARGIN;
+        float danger = 0.0f;
+
+        // Naehere Gefahren zaehlen staerker
+        auto addThreat = [&](Rectangle threat) {
+            float bottom = threat.y + threat.height;
+            float distance = bounds.y - bottom;
+            if (bottom < bounds.y - LOOKAHEAD_DISTANCE || threat.y > bounds.y + bounds.height) return;
+            if (threat.x + threat.width < left || threat.x > right) return;
+
+            danger += 1.0f / (std::fmax(distance, 0.0f) + 10.0f);
+        };
+
+        for (const auto& bullet : enemyBullets) {
+            if (bullet->IsActive()) addThreat(ToRectangle(bullet->GetBounds()));
+        }
+        for (const auto& enemy : enemies) {
+            if (enemy->IsActive()) addThreat(ToRectangle(enemy->GetBounds()));
+        }
+
+        return danger;
+    }
+
+    float BotController::FindTargetX(const Player& player,
+        const std::vector<std::unique_ptr<Enemy>>& enemies,
+        const Boss* boss) const {
+
+        float centerOffset = Player::AVATAR_WIDTH / 2.0f;
+
+        if (boss && boss->IsActive()) {
+            Rectangle bossBounds = ToRectangle(boss->GetBounds());
+            return bossBounds.x + bossBounds.width / 2.0f - centerOffset;
+        }
+
+        // Tiefster sichtbarer Gegner = dringlichstes Ziel
+        const Enemy* target = nullptr;
+        for (const auto& enemy : enemies) {
+            if (!enemy->IsActive() || enemy->GetPosition().y < 0) continue;
+            if (!target || enemy->GetPosition().y > target->GetPosition().y) {
+                target = enemy.get();
+            }
+        }
+
+        if (!target) return ToFloat(player.GetPosition().x);
+
+        Rectangle targetBounds = ToRectangle(target->GetBounds());
+        return targetBounds.x + targetBounds.width / 2.0f - centerOffset;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "raylib.h"
+#include "GameConfig.h"
+#include "Player.h"
+#include "Enemy.h"
+#include "Boss.h"
+#include "EnemyBullet.h"
+#include <vector>
+#include <memory>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Eingaben eines Bots fuer einen Frame (wie Tastatur bei Player::HandleInput)
+     */
+    struct BotInput {
+        bool left = false;
+        bool right = false;
+        bool shoot = false;
+    };
+
+    /**
+     * @brief Heuristischer Bot-Spieler fuer kopflose Simulationen
+     *
+     * Weicht zuerst fallenden EnemyBullets und Gegnern in der eigenen Spur aus
+     * und richtet sich sonst unter dem naechsten Gegner (bzw. dem Boss) aus.
+     * Geschossen wird, sobald der Cooldown es erlaubt.
+     */
+    class BotController {
+    public:
+        // === Entscheidung pro Frame ===
+        BotInput DecideInput(const Player& player,
+            const std::vector<std::unique_ptr<Enemy>>& enemies,
+            const std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+            const Boss* boss,
+            float baseMovementSpeed,
+            float deltaTime) const;
+
+    private:
+        // === Private Hilfsfunktionen ===
+        float EvaluateDanger(float playerX, const Player& player,
+            const std::vector<std::unique_ptr<Enemy>>& enemies,
+            const std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets) const;
+        float FindTargetX(const Player& player,
+            const std::vector<std::unique_ptr<Enemy>>& enemies,
+            const Boss* boss) const;
+
+        // === Constants ===
+        static const float LOOKAHEAD_DISTANCE;  // So weit ueber dem Spieler werden Gefahren beachtet
+        static const float DODGE_MARGIN;        // Sicherheitsabstand links/rechts
+        static const float REACTION_TIME;       // Ausweich-Schritt in Sekunden Bewegung
+        static const float TARGET_TOLERANCE;    // Ab dieser Abweichung wird nachgefuehrt
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -1,21 +1,42 @@
 #include "Bullet.h"
+#include <algorithm>
 
 namespace SpaceInvaders {
 
     // === Konstanten ===
     const float Bullet::DEFAULT_RADIUS = 6.0f;
     const float Bullet::DEFAULT_SPEED = 500.0f;
+    const float Bullet::HOMING_STEER_SPEED = 260.0f;
+    const float Bullet::LASER_SPEED = 1800.0f;
+    const float Bullet::LASER_LENGTH = 40.0f;
+
+    static_assert(BULLET_ARCHETYPE_COUNT == Bullet::LASER + 1, "BULLET_ARCHETYPES braucht einen Eintrag pro BulletType");
+    static_assert(sizeof(Bullet) <= 16, "Bullet soll in 16 Byte passen");
 
     // === Konstruktor ===
-    Bullet::Bullet(int playerId, Vector2 startPosition, float speed, BulletType type)
-        : playerId(playerId)
-        , position(startPosition)
+    Bullet::Bullet(int playerId, SimVector2 startPosition, SimScalar speed, BulletType type)
+        : position(startPosition)
         , speed(speed)
-        , bulletType(type)
+        , playerId((uint8_t)(playerId == 0 ? 0 : 1))
+        , bulletType((uint8_t)type)
         , active(true)
-        , radius(DEFAULT_RADIUS)
+        , piercesLeft(type == LASER ? LASER_PIERCE_COUNT : 0)
     {
-        UpdateColor();
+    }
+
+    Bullet::Bullet(const State& state)
+        : position(state.position)
+        , speed(state.speed)
+        , playerId((uint8_t)(state.playerId == 0 ? 0 : 1))
+        , bulletType((uint8_t)(state.bulletType % BULLET_ARCHETYPE_COUNT))
+        , active(state.active)
+        , piercesLeft(std::min(state.piercesLeft, LASER_PIERCE_COUNT))
+    {
+    }
+
+    // === Snapshot ===
+    Bullet::State Bullet::CaptureState() const {
+        return { position, speed, playerId, bulletType, active, piercesLeft };
     }
 
     // === Update ===
@@ -23,7 +44,7 @@ namespace SpaceInvaders {
         if (!active) return;
 
         // Bullet fliegt nach oben
-        position.y -= speed * deltaTime;
+        position.y -= speed * SimScalar(deltaTime);
 
         // Prfen ob auerhalb des Bildschirms
         if (IsOffScreen()) {
@@ -31,114 +52,92 @@ namespace SpaceInvaders {
         }
     }
 
+    void Bullet::SteerTowards(SimScalar targetX, float deltaTime) {
+        if (!active || bulletType != HOMING) return;
+
+        // Begrenzte Seitwaerts-Bewegung statt Geschwindigkeitsvektor: kein Zusatzfeld noetig
+        SimScalar maxStep = SimScalar(HOMING_STEER_SPEED * deltaTime);
+        SimScalar offset = targetX - position.x;
+        if (offset > maxStep) offset = maxStep;
+        if (offset < -maxStep) offset = -maxStep;
+        position.x += offset;
+    }
+
     // === Render ===
     void Bullet::Render() const {
         if (!active) return;
 
-        DrawCircleV(position, radius, bulletColor);
+        Color bulletColor = GetBulletColor();
+        Vector2 center = ToVector2(position);
 
-        // Zustzlicher Glow-Effekt fr spezielle Bullets
-        if (bulletType != NORMAL) {
-            DrawCircleV(position, radius + 2.0f, Fade(bulletColor, 0.3f));
-        }
-    }#include "Bullet.h"
-
-        namespace SpaceInvaders {
-
-        // === Konstanten ===
-        const float Bullet::DEFAULT_RADIUS = 6.0f;
-        const float Bullet::DEFAULT_SPEED = 500.0f;
-
-        // === Konstruktor ===
-        Bullet::Bullet(int playerId, Vector2 startPosition, float speed, BulletType type)
-            : playerId(playerId)
-            , position(startPosition)
-            , speed(speed)
-            , bulletType(type)
-            , active(true)
-            , radius(DEFAULT_RADIUS)
-        {
-            UpdateColor();
+        // Laser als Strahl hinter der Spitze
+        if (bulletType == LASER) {
+            Vector2 tail = { center.x, center.y + LASER_LENGTH };
+            DrawLineEx(center, tail, DEFAULT_RADIUS * 1.5f, Fade(bulletColor, 0.3f));
+            DrawLineEx(center, tail, DEFAULT_RADIUS * 0.5f, bulletColor);
+            return;
         }
 
-        // === Update ===
-        void Bullet::Update(float deltaTime) {
-            if (!active) return;
+        DrawCircleV(center, DEFAULT_RADIUS, bulletColor);
 
-            // Bullet fliegt nach oben
-            position.y -= speed * deltaTime;
-
-            // Prfen ob auerhalb des Bildschirms
-            if (IsOffScreen()) {
-                active = false;
-            }
+        // Zustzlicher Glow-Effekt
+        if (BULLET_ARCHETYPES[bulletType].glow) {
+            DrawCircleV(center, DEFAULT_RADIUS + 2.0f, Fade(bulletColor, 0.3f));
         }
+    }
 
-        // === Render ===
-        void Bullet::Render() const {
-            if (!active) return;
-
-            DrawCircleV(position, radius, bulletColor);
-
-            // Zustzlicher Glow-Effekt fr spezielle Bullets
-            if (bulletType != NORMAL) {
-                DrawCircleV(position, radius + 2.0f, Fade(bulletColor, 0.3f));
-            }
-        }
+    // === Getters ===
+    SimVector2 Bullet::GetPosition() const {
+        return position;
+    }
 
-        // === Getters ===
-        Vector2 Bullet::GetPosition() const {
-            return position;
-        }
+    SimScalar Bullet::GetSpeed() const {
+        return speed;
+    }
 
-        float Bullet::GetRadius() const {
-            return radius;
-        }
+    float Bullet::GetRadius() const {
+        return DEFAULT_RADIUS;
+    }
 
-        int Bullet::GetPlayerId() const {
-            return playerId;
-        }
+    int Bullet::GetPlayerId() const {
+        return playerId;
+    }
 
-        Bullet::BulletType Bullet::GetType() const {
-            return bulletType;
-        }
+    Bullet::BulletType Bullet::GetType() const {
+        return (BulletType)bulletType;
+    }
 
-        Rectangle Bullet::GetBounds() const {
-            return {
-                position.x - radius,
-                position.y - radius,
-                radius * 2,
-                radius * 2
-            };
-        }
+    SimRect Bullet::GetBounds() const {
+        SimScalar radius = SimScalar(DEFAULT_RADIUS);
+        return {
+            position.x - radius,
+            position.y - radius,
+            radius * 2,
+            radius * 2
+        };
+    }
 
-        // === State ===
-        bool Bullet::IsOffScreen() const {
-            return position.y + radius < 0;
-        }
+    // === State ===
+    bool Bullet::IsOffScreen() const {
+        return position.y + SimScalar(DEFAULT_RADIUS) < 0;
+    }
 
-        bool Bullet::IsActive() const {
-            return active;
-        }
+    bool Bullet::IsActive() const {
+        return active;
+    }
 
-        void Bullet::Deactivate() {
-            active = false;
-        }
+    void Bullet::Deactivate() {
+        active = false;
+    }
 
-        // === Private Hilfsfunktionen ===
-        Color Bullet::GetBulletColor() const {
-            switch (bulletType) {
-            case FAST_FIRE:
-                return YELLOW;
-            case TRIPLE_SHOT:
-                return ORANGE;
-            default:
-                return playerId == 0 ? WHITE : LIGHTBLUE;
-            }
-        }
+    void Bullet::Pierce() {
+        if (piercesLeft > 0) piercesLeft--;
+        if (piercesLeft == 0) active = false;
+    }
 
-        void Bullet::UpdateColor() {
-            bulletColor = GetBulletColor();
-        }
+    // === Private Hilfsfunktionen ===
+    Color Bullet::GetBulletColor() const {
+        return BULLET_ARCHETYPES[bulletType].playerColors[playerId];
+    }
 
-    } // namespace SpaceInvaders
\ No newline at end of file
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "raylib.h"
 #include "GameConfig.h"
+#include "EntityArchetypes.h"
+#include "SimMath.h"
+#include <cstdint>
 
 namespace SpaceInvaders {
 
@@ -9,7 +12,13 @@ namespace SpaceInvaders {
      * @brief Spieler-Bullet Klasse
      *
      * Reprsentiert Projektile, die von Spielern abgefeuert werden.
-     * Untersttzt verschiedene Bullet-Typen (normal, FastFire, TripleShot).
+     * Untersttzt verschiedene Bullet-Typen (normal, FastFire, TripleShot,
+     * Homing, Laser). Farbe und Glow kommen aus BULLET_ARCHETYPES.
+     *
+     * Homing-Raketen werden vom GameplayManager seitlich auf das naechste
+     * Ziel gelenkt (SteerTowards). Laser fliegen so schnell, dass sie pro
+     * Tick ueber Gegner hinwegspringen wuerden: ihre Treffer ermittelt der
+     * GameplayManager per Strahlabfrage, jeder Treffer kostet einen Durchschuss.
      */
     class Bullet {
     public:
@@ -17,48 +26,66 @@ namespace SpaceInvaders {
         enum BulletType {
             NORMAL,
             FAST_FIRE,
-            TRIPLE_SHOT
+            TRIPLE_SHOT,
+            HOMING,
+            LASER
         };
 
         // === Konstruktor & Destruktor ===
-        Bullet(int playerId, Vector2 startPosition, float speed, BulletType type = NORMAL);
+        Bullet(int playerId, SimVector2 startPosition, SimScalar speed, BulletType type = NORMAL);
         ~Bullet() = default;
 
+        // === Snapshot (POD) ===
+        struct State {
+            SimVector2 position;
+            SimScalar speed;
+            uint8_t playerId;
+            uint8_t bulletType;
+            bool active;
+            uint8_t piercesLeft;
+        };
+
+        explicit Bullet(const State& state);
+        State CaptureState() const;
+
         // === Update & Render ===
         void Update(float deltaTime);
+        void SteerTowards(SimScalar targetX, float deltaTime);  // nur HOMING
         void Render() const;
 
         // === Getters ===
-        Vector2 GetPosition() const;
+        SimVector2 GetPosition() const;
+        SimScalar GetSpeed() const;
         float GetRadius() const;
         int GetPlayerId() const;
         BulletType GetType() const;
-        Rectangle GetBounds() const;
+        SimRect GetBounds() const;
 
         // === Collision & Cleanup ===
         bool IsOffScreen() const;
         bool IsActive() const;
         void Deactivate();
+        void Pierce();  // Laser-Treffer, deaktiviert nach dem letzten Durchschuss
 
         // === Constants ===
         static const float DEFAULT_RADIUS;
         static const float DEFAULT_SPEED;
+        static const float HOMING_STEER_SPEED;  // maximale Seitwaerts-Geschwindigkeit
+        static const float LASER_SPEED;
+        static const float LASER_LENGTH;        // nur Darstellung
+        static constexpr uint8_t LASER_PIERCE_COUNT = 3;
 
     private:
         // === Eigenschaften ===
-        int playerId;           // 0 = Player1, 1 = Player2
-        Vector2 position;
-        float speed;
-        float radius;
-        BulletType bulletType;
+        SimVector2 position;
+        SimScalar speed;
+        uint8_t playerId;       // 0 = Player1, 1 = Player2
+        uint8_t bulletType;     // Index in BULLET_ARCHETYPES
         bool active;
-
-        // === Visuelle Eigenschaften ===
-        Color bulletColor;
+        uint8_t piercesLeft;    // nur LASER
 
         // === Private Hilfsfunktionen ===
         Color GetBulletColor() const;
-        void UpdateColor();
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
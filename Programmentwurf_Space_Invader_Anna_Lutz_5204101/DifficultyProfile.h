@@ -0,0 +1,99 @@
+#pragma once
+
+#include "GameConfig.h"
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Alle schwierigkeitsabhaengigen Werte eines Schwierigkeitsgrads
+     */
+    struct DifficultyValues {
+        float enemySpawnInterval;
+        float enemySpeed;
+        float enemyShootCooldown;
+        float enemyBulletSpeed;
+        float backgroundScrollSpeed;
+        float playerShootCooldown;
+        float playerMovementSpeed;
+        float powerUpDropChance;
+        float bossSpawnTime;
+        bool bulletCancellation;
+    };
+
+    // Index = Difficulty
+    inline constexpr DifficultyValues DIFFICULTY_VALUES[] = {
+        {
+            GameConfig::ENEMY_SPAWN_INTERVAL_EASY, GameConfig::ENEMY_SPEED_EASY,
+            GameConfig::ENEMY_SHOOT_COOLDOWN_EASY, GameConfig::ENEMY_BULLET_SPEED_EASY,
+            GameConfig::BACKGROUND_SCROLL_SPEED_EASY, GameConfig::PLAYER_SHOOT_COOLDOWN_EASY,
+            GameConfig::PLAYER_MOVEMENT_SPEED_EASY, GameConfig::POWERUP_DROP_CHANCE_EASY,
+            GameConfig::BOSS_SPAWN_TIME_EASY, GameConfig::BULLET_CANCELLATION_EASY
+        },
+        {
+            GameConfig::ENEMY_SPAWN_INTERVAL_MEDIUM, GameConfig::ENEMY_SPEED_MEDIUM,
+            GameConfig::ENEMY_SHOOT_COOLDOWN_MEDIUM, GameConfig::ENEMY_BULLET_SPEED_MEDIUM,
+            GameConfig::BACKGROUND_SCROLL_SPEED_MEDIUM, GameConfig::PLAYER_SHOOT_COOLDOWN_MEDIUM,
+            GameConfig::PLAYER_MOVEMENT_SPEED_MEDIUM, GameConfig::POWERUP_DROP_CHANCE_MEDIUM,
+            GameConfig::BOSS_SPAWN_TIME_MEDIUM, GameConfig::BULLET_CANCELLATION_MEDIUM
+        },
+        {
+            GameConfig::ENEMY_SPAWN_INTERVAL_HARD, GameConfig::ENEMY_SPEED_HARD,
+            GameConfig::ENEMY_SHOOT_COOLDOWN_HARD, GameConfig::ENEMY_BULLET_SPEED_HARD,
+            GameConfig::BACKGROUND_SCROLL_SPEED_HARD, GameConfig::PLAYER_SHOOT_COOLDOWN_HARD,
+            GameConfig::PLAYER_MOVEMENT_SPEED_HARD, GameConfig::POWERUP_DROP_CHANCE_HARD,
+            GameConfig::BOSS_SPAWN_TIME_HARD, GameConfig::BULLET_CANCELLATION_HARD
+        }
+    };
+
+    /**
+     * @brief Schwierigkeitsgrad als Typ, alle Werte sind Compile-Zeit-Konstanten
+     *
+     * Die Gameplay-Pipeline (Player::Update, GameplayManager::UpdateGameplay,
+     * Spawns) wird pro Profil instanziiert, der Schwierigkeitsgrad wird nur
+     * einmal beim Partiestart per DispatchDifficulty ausgewertet.
+     *
+     * Ausnahme sind die drei Werte, die der Balance-Sweep pro Thread
+     * ueberschreibt: sie pruefen weiterhin GameConfig::GetBalanceOverride().
+     */
+    template <Difficulty D>
+    struct DifficultyProfile {
+        static constexpr Difficulty DIFFICULTY = D;
+        static constexpr DifficultyValues VALUES = DIFFICULTY_VALUES[D];
+
+        // === Vom Balance-Sweep ueberschreibbare Werte ===
+        static float EnemySpawnInterval() {
+            const GameConfig::BalanceParameters* balance = GameConfig::GetBalanceOverride();
+            return balance ? balance->enemySpawnInterval : VALUES.enemySpawnInterval;
+        }
+
+        static float EnemyShootCooldown() {
+            const GameConfig::BalanceParameters* balance = GameConfig::GetBalanceOverride();
+            return balance ? balance->enemyShootCooldown : VALUES.enemyShootCooldown;
+        }
+
+        static float PowerUpDropChance() {
+            const GameConfig::BalanceParameters* balance = GameConfig::GetBalanceOverride();
+            return balance ? balance->powerUpDropChance : VALUES.powerUpDropChance;
+        }
+    };
+
+    using EasyProfile = DifficultyProfile<DIFF_EASY>;
+    using MediumProfile = DifficultyProfile<DIFF_MEDIUM>;
+    using HardProfile = DifficultyProfile<DIFF_HARD>;
+
+    /**
+     * @brief Einziger Laufzeit-Switch: ruft function mit dem passenden Profil-Objekt auf
+     *
+     * Aufruf z.B. mit [&](auto profile) { using Profile = decltype(profile); ... }
+     */
+    template <typename Function>
+    void DispatchDifficulty(Difficulty difficulty, Function&& function) {
+        switch (difficulty) {
+        case DIFF_EASY:   function(EasyProfile{});   break;
+        case DIFF_HARD:   function(HardProfile{});   break;
+        case DIFF_MEDIUM:
+        default:          function(MediumProfile{}); break;
+        }
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
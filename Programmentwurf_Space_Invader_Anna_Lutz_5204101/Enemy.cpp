@@ -1,5 +1,7 @@
 #include "Enemy.h"
 #include "TextureManager.h"
+#include "GameRandom.h"
+#include <algorithm>
 #include <cstdlib>
 
 namespace SpaceInvaders {
@@ -8,15 +10,36 @@ namespace SpaceInvaders {
     const float Enemy::DEFAULT_SIZE = 64.0f;
     const int Enemy::MAX_ENEMY_TYPES = 5;
 
+    static_assert(ENEMY_ARCHETYPE_COUNT == Enemy::MAX_ENEMY_TYPES, "ENEMY_ARCHETYPES braucht einen Eintrag pro Enemy-Typ");
+    static_assert(sizeof(Enemy) <= 32, "Enemy soll in einen halben Cache-Line passen");
+
     // === Konstruktor ===
-    Enemy::Enemy(int enemyType, Vector2 startPosition, Difficulty difficulty)
-        : enemyType(enemyType% MAX_ENEMY_TYPES) // Sicherstellen dass Type gltig ist
-        , position(startPosition)
-        , difficulty(difficulty)
+    Enemy::Enemy(int enemyType, SimVector2 startPosition, SimScalar baseSpeed, float baseShootCooldown)
+        : position(startPosition)
+        , lastShotTick(TimerWheel::GetWorldTimers().GetCurrentTick())
+        , shootCooldownTicks(0)
+        , enemyType((uint8_t)(enemyType % MAX_ENEMY_TYPES)) // Sicherstellen dass Type gltig ist
         , active(true)
-        , shootTimer(0.0f)
     {
-        InitializeEnemyProperties();
+        InitializeEnemyProperties(baseSpeed, baseShootCooldown);
+    }
+
+    Enemy::Enemy(const State& state)
+        : position(state.position)
+        , speed(state.speed)
+        , size(state.size)
+        , lastShotTick(TimerWheel::GetWorldTimers().GetCurrentTick() - state.ticksSinceShot)
+        , shootCooldownTicks(state.shootCooldownTicks)
+        , enemyType((uint8_t)(state.enemyType % MAX_ENEMY_TYPES))
+        , active(state.active)
+    {
+    }
+
+    // === Snapshot ===
+    Enemy::State Enemy::CaptureState() const {
+        uint64_t sinceShot = TimerWheel::GetWorldTimers().GetTicksSince(lastShotTick);
+        return { position, speed, size, (uint32_t)std::min<uint64_t>(sinceShot, UINT32_MAX),
+            shootCooldownTicks, enemyType, active, {} };
     }
 
     // === Update ===
@@ -24,10 +47,7 @@ namespace SpaceInvaders {
         if (!active) return;
 
         // Nach unten bewegen
-        position.y += speed * deltaTime;
-
-        // Schuss-Timer aktualisieren
-        shootTimer += deltaTime;
+        position.y += speed * SimScalar(deltaTime);
 
         // Prfen ob auerhalb des Bildschirms
         if (IsOffScreen()) {
@@ -43,49 +63,49 @@ namespace SpaceInvaders {
         Texture2D enemyTexture = textureManager.GetEnemyTexture(enemyType + 1); // +1 weil Texturen bei 1 beginnen
 
         TextureManager::DrawTextureScaled(enemyTexture,
-            position.x, position.y,
-            width, height);
+            ToFloat(position.x), ToFloat(position.y),
+            ToFloat(size), ToFloat(size));
     }
 
     // === Getters ===
-    Vector2 Enemy::GetPosition() const {
+    SimVector2 Enemy::GetPosition() const {
         return position;
     }
 
-    Rectangle Enemy::GetBounds() const {
-        return { position.x, position.y, width, height };
+    SimRect Enemy::GetBounds() const {
+        return { position.x, position.y, size, size };
     }
 
     int Enemy::GetScoreValue() const {
-        return scoreValue;
+        return GetArchetype().scoreValue;
     }
 
     int Enemy::GetEnemyType() const {
         return enemyType;
     }
 
-    float Enemy::GetSpeed() const {
+    SimScalar Enemy::GetSpeed() const {
         return speed;
     }
 
     // === Shooting System ===
     bool Enemy::WantsToShoot() const {
-        return shootTimer >= shootCooldown;
+        return TimerWheel::GetWorldTimers().GetTicksSince(lastShotTick) >= shootCooldownTicks;
     }
 
     void Enemy::ResetShootTimer() {
-        shootTimer = 0.0f;
+        lastShotTick = TimerWheel::GetWorldTimers().GetCurrentTick();
     }
 
-    Vector2 Enemy::GetShootPosition() const {
+    SimVector2 Enemy::GetShootPosition() const {
         return {
-            position.x + width / 2,
-            position.y + height
+            position.x + size / 2,
+            position.y + size
         };
     }
 
     Color Enemy::GetBulletColor() const {
-        return bulletColor;
+        return GetArchetype().bulletColor;
     }
 
     // === State ===
@@ -102,60 +122,36 @@ namespace SpaceInvaders {
     }
 
     // === Private Hilfsfunktionen ===
-    void Enemy::InitializeEnemyProperties() {
+    void Enemy::InitializeEnemyProperties(SimScalar baseSpeed, float baseShootCooldown) {
         // Basis-Geschwindigkeit nach Schwierigkeit
-        speed = GameConfig::GetEnemySpeed(difficulty);
+        speed = baseSpeed;
 
-        // Schuss-Cooldown nach Schwierigkeit
-        shootCooldown = GameConfig::GetEnemyShootCooldown(difficulty);
+        // Schuss-Cooldown nach Schwierigkeit (wird nur als Tick-Anzahl gespeichert)
+        float shootCooldown = baseShootCooldown;
 
         // Grenvariation hinzufgen
-        float sizeVariation = GetEnemySizeVariation();
-        width = DEFAULT_SIZE + sizeVariation;
-        height = DEFAULT_SIZE + sizeVariation;
+        SimScalar sizeVariation = GetEnemySizeVariation();
+        size = SimScalar(DEFAULT_SIZE) + sizeVariation;
 
         // Geschwindigkeitsvariation (-25% bis +50%)
-        float speedVariation = (rand() % 76 - 25) / 100.0f; // -0.25 bis +0.50
-        speed += speed * speedVariation;
+        SimScalar speedPercent = SimScalar(GameRandom::NextInt(76) - 25); // -25 bis +50
+        speed += speed * speedPercent / 100;
 
-        // Score-Wert nach Enemy-Typ
-        scoreValue = GetEnemyScoreValue(enemyType);
-
-        // Bullet-Farbe nach Enemy-Typ
-        bulletColor = GetEnemyBulletColor(enemyType);
-
-        // Schuss-Cooldown-Variation (20%)
-        float cooldownVariation = (rand() % 41 - 20) / 100.0f; // -0.2 bis +0.2
-        shootCooldown += shootCooldown * cooldownVariation;
+        // Schuss-Cooldown-Variation (20%), als ein Faktor ohne Multiply-Add
+        float cooldownScale = (GameRandom::NextInt(41) + 80) / 100.0f; // 0.8 bis 1.2
+        shootCooldown *= cooldownScale;
         if (shootCooldown < 0.2f) shootCooldown = 0.2f; // Minimum
+        shootCooldownTicks = TimerWheel::SecondsToTicks(shootCooldown);
     }
 
-    Color Enemy::GetEnemyBulletColor(int type) const {
-        switch (type) {
-        case 0: return PURPLE;
-        case 1: return DARKGREEN;
-        case 2: return ORANGE;
-        case 3: return PINK;
-        case 4: return SKYBLUE;
-        default: return RED;
-        }
-    }
-
-    int Enemy::GetEnemyScoreValue(int type) const {
-        // Verschiedene Enemy-Typen geben unterschiedliche Punkte
-        switch (type) {
-        case 0: return 10;  // Enemy1
-        case 1: return 15;  // Enemy2
-        case 2: return 20;  // Enemy3
-        case 3: return 25;  // Enemy4
-        case 4: return 30;  // Enemy5
-        default: return 10;
-        }
+    const EnemyArchetype& Enemy::GetArchetype() const {
+        // enemyType wurde im Konstruktor auf MAX_ENEMY_TYPES begrenzt
+        return ENEMY_ARCHETYPES[enemyType];
     }
 
-    float Enemy::GetEnemySizeVariation() const {
+    SimScalar Enemy::GetEnemySizeVariation() const {
         // Grenvariation: -15 bis +15 Pixel
-        return (rand() % 31) - 15;
+        return SimScalar(GameRandom::NextInt(31) - 15);
     }
 
 } // namespace SpaceInvaders
\ No newline at end of file
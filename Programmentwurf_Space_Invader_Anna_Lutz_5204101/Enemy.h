@@ -2,6 +2,9 @@
 
 #include "raylib.h"
 #include "GameConfig.h"
+#include "TimerWheel.h"
+#include "EntityArchetypes.h"
+#include "SimMath.h"
 
 namespace SpaceInvaders {
 
@@ -13,28 +16,47 @@ namespace SpaceInvaders {
      * - Schieverhalten (schwierigkeitsabhngig)
      * - Verschiedene Typen mit unterschiedlichen Eigenschaften
      * - Score-Werte
+     *
+     * Score-Wert und Bullet-Farbe kommen aus ENEMY_ARCHETYPES, die Instanz
+     * hlt nur ihren Typ-Index und den wirklich individuellen Zustand.
      */
     class Enemy {
     public:
         // === Konstruktor & Destruktor ===
-        Enemy(int enemyType, Vector2 startPosition, Difficulty difficulty);
+        // baseSpeed/baseShootCooldown kommen aus dem DifficultyProfile des Spawners
+        Enemy(int enemyType, SimVector2 startPosition, SimScalar baseSpeed, float baseShootCooldown);
         ~Enemy() = default;
 
+        // === Snapshot (POD, Cooldown relativ zur Tick-Uhr) ===
+        struct State {
+            SimVector2 position;
+            SimScalar speed;
+            SimScalar size;
+            uint32_t ticksSinceShot;
+            uint32_t shootCooldownTicks;
+            uint8_t enemyType;
+            bool active;
+            uint8_t reserved[2];  // kein implizites Padding
+        };
+
+        explicit Enemy(const State& state);
+        State CaptureState() const;
+
         // === Update & Render ===
         void Update(float deltaTime);
         void Render() const;
 
         // === Getters ===
-        Vector2 GetPosition() const;
-        Rectangle GetBounds() const;
+        SimVector2 GetPosition() const;
+        SimRect GetBounds() const;
         int GetScoreValue() const;
         int GetEnemyType() const;
-        float GetSpeed() const;
+        SimScalar GetSpeed() const;
 
         // === Shooting System ===
         bool WantsToShoot() const;
         void ResetShootTimer();
-        Vector2 GetShootPosition() const;
+        SimVector2 GetShootPosition() const;
         Color GetBulletColor() const;
 
         // === Collision & Cleanup ===
@@ -48,26 +70,21 @@ namespace SpaceInvaders {
 
     private:
         // === Eigenschaften ===
-        int enemyType;          // 0-4 fr verschiedene Enemy-Typen
-        Vector2 position;
-        float speed;
-        float width, height;
-        int scoreValue;
-        bool active;
+        SimVector2 position;
+        SimScalar speed;
+        SimScalar size;         // Breite = Hhe
 
-        // === Shooting ===
-        float shootTimer;
-        float shootCooldown;
-        Color bulletColor;
+        // === Shooting (Cooldown gegen die Tick-Uhr der Spielwelt) ===
+        uint64_t lastShotTick;
+        uint32_t shootCooldownTicks;
 
-        // === Schwierigkeit ===
-        Difficulty difficulty;
+        uint8_t enemyType;      // Index in ENEMY_ARCHETYPES
+        bool active;
 
         // === Private Hilfsfunktionen ===
-        void InitializeEnemyProperties();
-        Color GetEnemyBulletColor(int type) const;
-        int GetEnemyScoreValue(int type) const;
-        float GetEnemySizeVariation() const;
+        void InitializeEnemyProperties(SimScalar baseSpeed, float baseShootCooldown);
+        const EnemyArchetype& GetArchetype() const;
+        SimScalar GetEnemySizeVariation() const;
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
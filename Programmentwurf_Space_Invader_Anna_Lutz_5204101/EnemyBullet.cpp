@@ -8,21 +8,35 @@ namespace SpaceInvaders {
     const float EnemyBullet::DEFAULT_SPEED = 280.0f;
 
     // === Konstruktor ===
-    EnemyBullet::EnemyBullet(Vector2 startPosition, float speed, Color color)
+    EnemyBullet::EnemyBullet(SimVector2 startPosition, SimScalar speed, Color color)
         : position(startPosition)
         , speed(speed)
-        , radius(DEFAULT_RADIUS)
+        , radius(SimScalar(DEFAULT_RADIUS))
         , bulletColor(color)
         , active(true)
     {
     }
 
+    EnemyBullet::EnemyBullet(const State& state)
+        : position(state.position)
+        , speed(state.speed)
+        , radius(state.radius)
+        , bulletColor(state.bulletColor)
+        , active(state.active)
+    {
+    }
+
+    // === Snapshot ===
+    EnemyBullet::State EnemyBullet::CaptureState() const {
+        return { position, speed, radius, bulletColor, active, {} };
+    }
+
     // === Update ===
     void EnemyBullet::Update(float deltaTime) {
         if (!active) return;
 
         // Bullet fliegt nach unten
-        position.y += speed * deltaTime;
+        position.y += speed * SimScalar(deltaTime);
 
         // Prfen ob auerhalb des Bildschirms
         if (IsOffScreen()) {
@@ -34,22 +48,25 @@ namespace SpaceInvaders {
     void EnemyBullet::Render() const {
         if (!active) return;
 
+        Vector2 center = ToVector2(position);
+        float renderRadius = ToFloat(radius);
+
         // Hauptbullet
-        DrawCircleV(position, radius, bulletColor);
+        DrawCircleV(center, renderRadius, bulletColor);
 
         // Innerer Kern fr bessere Sichtbarkeit
-        DrawCircleV(position, radius * 0.6f, Fade(WHITE, 0.8f));
+        DrawCircleV(center, renderRadius * 0.6f, Fade(WHITE, 0.8f));
 
         // uerer Glow
-        DrawCircleV(position, radius + 3.0f, Fade(bulletColor, 0.2f));
+        DrawCircleV(center, renderRadius + 3.0f, Fade(bulletColor, 0.2f));
     }
 
     // === Getters ===
-    Vector2 EnemyBullet::GetPosition() const {
+    SimVector2 EnemyBullet::GetPosition() const {
         return position;
     }
 
-    float EnemyBullet::GetRadius() const {
+    SimScalar EnemyBullet::GetRadius() const {
         return radius;
     }
 
@@ -57,7 +74,7 @@ namespace SpaceInvaders {
         return bulletColor;
     }
 
-    Rectangle EnemyBullet::GetBounds() const {
+    SimRect EnemyBullet::GetBounds() const {
         return {
             position.x - radius,
             position.y - radius,
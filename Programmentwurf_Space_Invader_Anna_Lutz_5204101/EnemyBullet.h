@@ -1,6 +1,8 @@
 #pragma once
 
 #include "raylib.h"
+#include "SimMath.h"
+#include <cstdint>
 
 namespace SpaceInvaders {
 
@@ -13,18 +15,31 @@ namespace SpaceInvaders {
     class EnemyBullet {
     public:
         // === Konstruktor & Destruktor ===
-        EnemyBullet(Vector2 startPosition, float speed, Color color = RED);
+        EnemyBullet(SimVector2 startPosition, SimScalar speed, Color color = RED);
         ~EnemyBullet() = default;
 
+        // === Snapshot (POD) ===
+        struct State {
+            SimVector2 position;
+            SimScalar speed;
+            SimScalar radius;
+            Color bulletColor;
+            bool active;
+            uint8_t reserved[3];  // kein implizites Padding
+        };
+
+        explicit EnemyBullet(const State& state);
+        State CaptureState() const;
+
         // === Update & Render ===
         void Update(float deltaTime);
         void Render() const;
 
         // === Getters ===
-        Vector2 GetPosition() const;
-        float GetRadius() const;
+        SimVector2 GetPosition() const;
+        SimScalar GetRadius() const;
         Color GetColor() const;
-        Rectangle GetBounds() const;
+        SimRect GetBounds() const;
 
         // === Collision & Cleanup ===
         bool IsOffScreen() const;
@@ -40,9 +55,9 @@ namespace SpaceInvaders {
 
     private:
         // === Eigenschaften ===
-        Vector2 position;
-        float speed;
-        float radius;
+        SimVector2 position;
+        SimScalar speed;
+        SimScalar radius;
         Color bulletColor;
         bool active;
     };
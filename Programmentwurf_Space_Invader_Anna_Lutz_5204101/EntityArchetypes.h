@@ -0,0 +1,50 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstddef>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Gemeinsame Typ-Daten eines Gegner-Typs (Flyweight)
+     *
+     * Jede Enemy-Instanz speichert nur noch ihren Typ-Index, alles was
+     * fuer alle Gegner eines Typs gleich ist, steht einmal in dieser Tabelle.
+     */
+    struct EnemyArchetype {
+        int scoreValue;
+        Color bulletColor;
+    };
+
+    inline constexpr EnemyArchetype ENEMY_ARCHETYPES[] = {
+        { 10, PURPLE },     // Enemy1
+        { 15, DARKGREEN },  // Enemy2
+        { 20, ORANGE },     // Enemy3
+        { 25, PINK },       // Enemy4
+        { 30, SKYBLUE }     // Enemy5
+    };
+
+    inline constexpr size_t ENEMY_ARCHETYPE_COUNT = sizeof(ENEMY_ARCHETYPES) / sizeof(ENEMY_ARCHETYPES[0]);
+
+    /**
+     * @brief Gemeinsame Typ-Daten eines Spieler-Bullet-Typs (Flyweight)
+     *
+     * Normale Schuesse sind je Spieler eingefaerbt, PowerUp-Schuesse
+     * haben fuer beide Spieler dieselbe Farbe und einen Glow.
+     */
+    struct BulletArchetype {
+        Color playerColors[2];  // Player1, Player2
+        bool glow;
+    };
+
+    inline constexpr BulletArchetype BULLET_ARCHETYPES[] = {
+        { { WHITE, Color{ 173, 216, 230, 255 } }, false },  // NORMAL (Player2 hellblau)
+        { { YELLOW, YELLOW }, true },                       // FAST_FIRE
+        { { ORANGE, ORANGE }, true },                       // TRIPLE_SHOT
+        { { LIME, LIME }, true },                           // HOMING
+        { { RED, RED }, true }                              // LASER
+    };
+
+    inline constexpr size_t BULLET_ARCHETYPE_COUNT = sizeof(BULLET_ARCHETYPES) / sizeof(BULLET_ARCHETYPES[0]);
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "EventBus.h"
+
+namespace SpaceInvaders {
+
+    // === Konstruktor ===
+    EventBus::EventBus()
+        : eventCount(0)
+        , droppedCount(0)
+        , resimulating(false)
+    {
+        channels.fill(nullptr);
+    }
+
+    // === Veroeffentlichen & Abarbeiten ===
+    void EventBus::Publish(const GameEvent& event) {
+        if (eventCount >= MAX_EVENTS_PER_FRAME) {
+            droppedCount++;
+            return;
+        }
+        frameEvents[eventCount++] = event;
+    }
+
+    void EventBus::Dispatch() {
+        // Abonnenten duerfen waehrend des Abarbeitens neue Ereignisse veroeffentlichen
+        for (size_t i = 0; i < eventCount; i++) {
+            const GameEvent event = frameEvents[i];
+
+            for (const auto& handler : handlers[event.type]) {
+                handler(event);
+            }
+
+            // Wiederholte Frames wurden schon beim ersten Durchlauf weitergereicht
+            if (resimulating) continue;
+
+            for (GameEventChannel* channel : channels) {
+                if (channel) {
+                    channel->TryPush(event);
+                }
+            }
+        }
+
+        eventCount = 0;
+    }
+
+    // === Abonnenten ===
+    void EventBus::Subscribe(GameEventType type, Handler handler) {
+        handlers[type].push_back(std::move(handler));
+    }
+
+    bool EventBus::Connect(GameEventChannel* channel) {
+        for (auto& slot : channels) {
+            if (!slot) {
+                slot = channel;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void EventBus::Disconnect(GameEventChannel* channel) {
+        for (auto& slot : channels) {
+            if (slot == channel) {
+                slot = nullptr;
+            }
+        }
+    }
+
+    // === Rollback ===
+    void EventBus::SetResimulating(bool active) {
+        resimulating = active;
+    }
+
+    bool EventBus::IsResimulating() const {
+        return resimulating;
+    }
+
+    // === Statistiken ===
+    size_t EventBus::GetDroppedCount() const {
+        return droppedCount;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
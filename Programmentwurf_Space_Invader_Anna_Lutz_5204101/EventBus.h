@@ -0,0 +1,158 @@
+#pragma once
+
+#include "raylib.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    // === Gameplay-Ereignisse ===
+    enum GameEventType : uint8_t {
+        EVENT_RUN_STARTED,
+        EVENT_RUN_ENDED,
+        EVENT_ENEMY_KILLED,
+        EVENT_PLAYER_HIT,
+        EVENT_SHIELD_HIT,
+        EVENT_POWERUP_COLLECTED,
+        EVENT_BOSS_HIT,
+        EVENT_BOSS_DEFEATED,
+        EVENT_BULLET_CANCELLED,
+        EVENT_PLAYER_SHOT,
+        EVENT_COUNT
+    };
+
+    // === Ursache eines Lebensverlusts (subtype von EVENT_PLAYER_HIT) ===
+    enum HitCause : uint8_t {
+        HIT_NONE,             // kein Treffer, z.B. Runde ohne Lebensverlust beendet
+        HIT_ENEMY_BULLET,
+        HIT_ENEMY_COLLISION
+    };
+
+    /**
+     * @brief Ereignis mit fester Groesse (POD, ohne Heap)
+     *
+     * Bedeutung von value je nach Typ:
+     * - ENEMY_KILLED:      Punktwert des Gegners
+     * - POWERUP_COLLECTED: PowerUpType
+     * - BOSS_HIT:          verbleibende Lebenspunkte
+     * - PLAYER_HIT:        verbleibende Leben (subtype = HitCause)
+     * - PLAYER_SHOT:       Anzahl Projektile (subtype = Bullet::BulletType)
+     */
+    struct GameEvent {
+        GameEventType type;
+        int8_t playerId;     // -1 = kein Spieler beteiligt
+        int16_t subtype;     // z.B. Enemy-Typ
+        int32_t value;
+        Vector2 position;
+    };
+
+    /**
+     * @brief Lock-freier Ringpuffer fuer genau einen Produzenten und einen Konsumenten
+     *
+     * Der Simulations-Thread schreibt, ein Hintergrund-Thread liest. Capacity
+     * muss eine Zweierpotenz sein. Ist der Puffer voll, schlaegt TryPush fehl,
+     * der Produzent blockiert nie.
+     */
+    template <typename T, size_t Capacity>
+    class SpscChannel {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity muss eine Zweierpotenz sein");
+
+    public:
+        bool TryPush(const T& item) {
+            size_t head = writeIndex.load(std::memory_order_relaxed);
+            size_t tail = readIndex.load(std::memory_order_acquire);
+            if (head - tail >= Capacity) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            buffer[head & (Capacity - 1)] = item;
+            writeIndex.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(T& item) {
+            size_t tail = readIndex.load(std::memory_order_relaxed);
+            size_t head = writeIndex.load(std::memory_order_acquire);
+            if (tail == head) return false;
+
+            item = buffer[tail & (Capacity - 1)];
+            readIndex.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool IsEmpty() const {
+            return readIndex.load(std::memory_order_acquire) == writeIndex.load(std::memory_order_acquire);
+        }
+
+        size_t GetPushedCount() const {
+            return writeIndex.load(std::memory_order_acquire);
+        }
+
+        size_t GetDroppedCount() const {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<T, Capacity> buffer{};
+        alignas(64) std::atomic<size_t> writeIndex{ 0 };
+        alignas(64) std::atomic<size_t> readIndex{ 0 };
+        std::atomic<size_t> dropped{ 0 };
+    };
+
+    using GameEventChannel = SpscChannel<GameEvent, 1024>;
+
+    /**
+     * @brief Typisierter Event-Bus fuer Gameplay-Ereignisse
+     *
+     * Kollisionen und Spawns veroeffentlichen nur noch Ereignisse in einen
+     * festen Puffer pro Frame. Dispatch() arbeitet den Puffer am Frame-Ende
+     * gesammelt ab: zuerst die Abonnenten auf dem Simulations-Thread
+     * (Explosionen, Punkte, Drops), danach werden alle Ereignisse in die
+     * verbundenen SPSC-Kanaele fuer Hintergrund-Konsumenten kopiert.
+     *
+     * Waehrend eines Rollbacks (SetResimulating) laufen nur die Abonnenten,
+     * die Kanaele bekommen die wiederholten Frames nicht ein zweites Mal.
+     */
+    class EventBus {
+    public:
+        using Handler = std::function<void(const GameEvent&)>;
+
+        // === Konstruktor ===
+        EventBus();
+
+        // === Veroeffentlichen & Abarbeiten ===
+        void Publish(const GameEvent& event);
+        void Dispatch();
+
+        // === Abonnenten ===
+        void Subscribe(GameEventType type, Handler handler);
+        bool Connect(GameEventChannel* channel);
+        void Disconnect(GameEventChannel* channel);
+
+        // === Rollback ===
+        void SetResimulating(bool active);
+        bool IsResimulating() const;
+
+        // === Statistiken ===
+        size_t GetDroppedCount() const;
+
+        // === Constants ===
+        static const size_t MAX_EVENTS_PER_FRAME = 512;
+        static const size_t MAX_CHANNELS = 4;
+
+    private:
+        std::array<GameEvent, MAX_EVENTS_PER_FRAME> frameEvents;
+        size_t eventCount;
+        size_t droppedCount;
+        bool resimulating;
+
+        std::vector<Handler> handlers[EVENT_COUNT];
+        std::array<GameEventChannel*, MAX_CHANNELS> channels;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
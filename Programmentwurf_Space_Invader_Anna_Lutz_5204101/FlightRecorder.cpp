@@ -0,0 +1,333 @@
+#include "FlightRecorder.h"
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <ctime>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        const char* const stateNames[] = {
+            "MAINMENU", "SINGLEPLAYER_SETUP", "MULTIPLAYER_SETUP", "DIFFICULTY_SELECTION",
+            "STATISTICS", "RULES", "GAME", "GAMEOVER", "PAUSE"
+        };
+
+        const char* const eventNames[] = {
+            "RUN_STARTED", "RUN_ENDED", "ENEMY_KILLED", "PLAYER_HIT",
+            "SHIELD_HIT", "POWERUP_COLLECTED", "BOSS_HIT", "BOSS_DEFEATED", "BULLET_CANCELLED",
+            "PLAYER_SHOT"
+        };
+
+        const char* const saveOperationNames[] = { "OPEN", "COMMIT" };
+
+        template <size_t N>
+        const char* NameOf(const char* const (&names)[N], int index) {
+            return (index >= 0 && index < (int)N) ? names[index] : "?";
+        }
+
+        std::terminate_handler previousTerminateHandler = nullptr;
+
+        // Roh-Dateizugriffe: open/write/close sind auch im Signal-Handler erlaubt
+        int OpenDumpFile(const char* path) {
+#ifdef _WIN32
+            return _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC, _S_IREAD | _S_IWRITE);
+#else
+            return open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+        }
+
+        void WriteAll(int descriptor, const char* data, size_t length) {
+            while (length > 0) {
+#ifdef _WIN32
+                int written = _write(descriptor, data, (unsigned int)length);
+#else
+                ssize_t written = write(descriptor, data, length);
+#endif
+                if (written <= 0) return;
+                data += written;
+                length -= (size_t)written;
+            }
+        }
+
+        void WriteText(int descriptor, const char* text) {
+            WriteAll(descriptor, text, std::strlen(text));
+        }
+
+        void CloseDumpFile(int descriptor) {
+#ifdef _WIN32
+            _close(descriptor);
+#else
+            close(descriptor);
+#endif
+        }
+
+        /**
+         * @brief Zeile auf dem Stack zusammensetzen (printf ist im Signal-Handler nicht erlaubt)
+         *
+         * Kennt nur Text, Ganzzahlen und Festkomma; zu lange Zeilen werden abgeschnitten.
+         */
+        class DumpLine {
+        public:
+            DumpLine& Text(const char* text) {
+                while (*text && length < sizeof(buffer) - 1) {
+                    buffer[length++] = *text++;
+                }
+                return *this;
+            }
+
+            DumpLine& Int(long long value) {
+                char digits[24];
+                int count = 0;
+                unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+                do {
+                    digits[count++] = (char)('0' + magnitude % 10);
+                    magnitude /= 10;
+                } while (magnitude > 0);
+
+                if (value < 0) Text("-");
+                while (count > 0 && length < sizeof(buffer) - 1) {
+                    buffer[length++] = digits[--count];
+                }
+                return *this;
+            }
+
+            DumpLine& Fixed(float value, int decimals) {
+                if (value != value) return Text("nan");
+                if (value > 1e15f || value < -1e15f) return Text(value > 0 ? "inf" : "-inf");
+
+                long long scale = 1;
+                for (int i = 0; i < decimals; i++) scale *= 10;
+                double exact = (double)value * (double)scale;
+                long long scaled = (long long)(exact + (exact < 0 ? -0.5 : 0.5));
+                if (scaled < 0) {
+                    Text("-");
+                    scaled = -scaled;
+                }
+
+                Int(scaled / scale);
+                if (decimals > 0) {
+                    Text(".");
+                    long long fraction = scaled % scale;
+                    for (long long digit = scale / 10; digit > 1 && fraction < digit; digit /= 10) {
+                        Text("0");
+                    }
+                    Int(fraction);
+                }
+                return *this;
+            }
+
+            const char* Get() {
+                buffer[length] = '\0';
+                return buffer;
+            }
+
+            void WriteTo(int descriptor) {
+                WriteAll(descriptor, buffer, length);
+                length = 0;
+            }
+
+        private:
+            char buffer[192];
+            size_t length = 0;
+        };
+
+    } // namespace
+
+    // === Singleton ===
+    FlightRecorder& FlightRecorder::GetInstance() {
+        static FlightRecorder instance;
+        return instance;
+    }
+
+    FlightRecorder::FlightRecorder()
+        : records{}
+        , writeIndex(0)
+        , startTime(std::chrono::steady_clock::now())
+        , frameBudgetMs(GameConfig::FRAME_BUDGET_MS)
+        , lastDumpTime(-DUMP_COOLDOWN)
+        , dumpCount(0)
+        , dumping(false)
+        , crashPath{}
+    {
+    }
+
+    // === Aufzeichnung ===
+    void FlightRecorder::RecordFrame(float frameTimeMs, size_t objectCount, size_t allocations) {
+        float now = Now();
+        Push({ RECORD_FRAME, 0, (int16_t)std::min<size_t>(allocations, INT16_MAX),
+            (int32_t)objectCount, frameTimeMs, now });
+
+        // Spike: sofort sichern, aber nicht bei jedem Frame einer Ruckel-Serie
+        if (frameTimeMs > frameBudgetMs && now - lastDumpTime >= DUMP_COOLDOWN) {
+            char reason[96];
+            std::snprintf(reason, sizeof(reason), "Frame %.1f ms ueber Budget %.1f ms", frameTimeMs, frameBudgetMs);
+            Dump(reason);
+        }
+    }
+
+    void FlightRecorder::RecordStateChange(GameState from, GameState to) {
+        Push({ RECORD_STATE_CHANGE, (uint8_t)to, (int16_t)from, 0, 0.0f, Now() });
+    }
+
+    void FlightRecorder::RecordSaveIO(SaveOperation operation, bool success, float durationMs) {
+        Push({ RECORD_SAVE_IO, (uint8_t)operation, (int16_t)(success ? 1 : 0), 0, durationMs, Now() });
+    }
+
+    void FlightRecorder::RecordGameEvent(const GameEvent& event) {
+        Push({ RECORD_GAME_EVENT, (uint8_t)event.type, (int16_t)event.playerId, event.value, 0.0f, Now() });
+    }
+
+    // === Dumps ===
+    void FlightRecorder::SetFrameBudget(float milliseconds) {
+        frameBudgetMs = milliseconds;
+    }
+
+    float FlightRecorder::GetFrameBudget() const {
+        return frameBudgetMs;
+    }
+
+    bool FlightRecorder::Dump(const char* reason) {
+        std::error_code ec;
+        std::filesystem::create_directories(GameConfig::FLIGHT_RECORDER_FOLDER, ec);
+
+        char path[256];
+        std::snprintf(path, sizeof(path), "%sflight_%lld_%d.txt", GameConfig::FLIGHT_RECORDER_FOLDER,
+            (long long)std::time(nullptr), dumpCount + 1);
+
+        if (!WriteDump(path, reason)) {
+            std::cerr << "[FEHLER] Flight-Recorder-Dump konnte nicht geschrieben werden: " << path << std::endl;
+            return false;
+        }
+
+        std::cerr << "[WARNUNG] Flight Recorder gesichert (" << reason << "): " << path << std::endl;
+        return true;
+    }
+
+    void FlightRecorder::InstallCrashHandlers() {
+        // Ordner und Dateiname jetzt festlegen, im Signal-Handler ist dafuer kein Platz
+        std::error_code ec;
+        std::filesystem::create_directories(GameConfig::FLIGHT_RECORDER_FOLDER, ec);
+        std::snprintf(crashPath, sizeof(crashPath), "%sflight_%lld_absturz.txt", GameConfig::FLIGHT_RECORDER_FOLDER,
+            (long long)std::time(nullptr));
+
+        std::signal(SIGSEGV, &FlightRecorder::OnSignal);
+        std::signal(SIGABRT, &FlightRecorder::OnSignal);
+        std::signal(SIGFPE, &FlightRecorder::OnSignal);
+        std::signal(SIGILL, &FlightRecorder::OnSignal);
+        previousTerminateHandler = std::set_terminate(&FlightRecorder::OnTerminate);
+    }
+
+    // === Private Hilfsfunktionen ===
+    void FlightRecorder::Push(const FlightRecord& record) {
+        records[writeIndex & (CAPACITY - 1)] = record;
+        writeIndex++;
+    }
+
+    float FlightRecorder::Now() const {
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    bool FlightRecorder::WriteDump(const char* path, const char* reason) {
+        // Absturz waehrend eines Dumps: nicht erneut schreiben
+        if (dumping.exchange(true)) return false;
+
+        int descriptor = OpenDumpFile(path);
+        if (descriptor < 0) {
+            dumping.store(false);
+            return false;
+        }
+
+        float now = Now();
+        lastDumpTime = now;
+        dumpCount++;
+
+        // Zeilen auf dem Stack formatieren und direkt schreiben (kein FILE*, kein Heap, kein printf)
+        DumpLine line;
+        line.Text("# Flight Recorder Dump\n# Grund: ").Text(reason)
+            .Text("\n# Zeitpunkt: ").Fixed(now, 3).Text(" s, Budget: ").Fixed(frameBudgetMs, 1).Text(" ms\n")
+            .Text("zeit_s;typ;details\n")
+            .WriteTo(descriptor);
+
+        // Aeltester noch vorhandener Eintrag, aber nur das Zeitfenster
+        size_t first = writeIndex > CAPACITY ? writeIndex - CAPACITY : 0;
+        float windowStart = now - GameConfig::FLIGHT_RECORDER_SECONDS;
+
+        for (size_t i = first; i < writeIndex; i++) {
+            const FlightRecord& record = records[i & (CAPACITY - 1)];
+            if (record.time < windowStart) continue;
+
+            line.Fixed(record.time, 3);
+            switch (record.type) {
+            case RECORD_FRAME:
+                line.Text(";FRAME;").Fixed(record.value, 2).Text(" ms, ").Int(record.count).Text(" Objekte, ")
+                    .Int(record.extra).Text(" Allokationen").Text(record.value > frameBudgetMs ? " <-- SPIKE" : "");
+                break;
+            case RECORD_STATE_CHANGE:
+                line.Text(";STATE;").Text(NameOf(stateNames, record.extra)).Text(" -> ")
+                    .Text(NameOf(stateNames, record.kind));
+                break;
+            case RECORD_SAVE_IO:
+                line.Text(";SAVE;").Text(NameOf(saveOperationNames, record.kind)).Text(record.extra ? " ok" : " FEHLER")
+                    .Text(", ").Fixed(record.value, 2).Text(" ms");
+                break;
+            case RECORD_GAME_EVENT:
+                line.Text(";EVENT;").Text(NameOf(eventNames, record.kind)).Text(", Spieler ").Int(record.extra)
+                    .Text(", Wert ").Int(record.count);
+                break;
+            default:
+                line.Text(";?");
+                break;
+            }
+            line.Text("\n").WriteTo(descriptor);
+        }
+
+        CloseDumpFile(descriptor);
+        dumping.store(false);
+        return true;
+    }
+
+    void FlightRecorder::OnSignal(int signal) {
+        // Best effort: nach einem Absturz ist der Prozess ohnehin verloren
+        std::signal(signal, SIG_DFL);
+
+        // Nur signal-sichere Aufrufe: Pfad steht seit InstallCrashHandlers fest, Ausgabe per write
+        FlightRecorder& recorder = GetInstance();
+        DumpLine reason;
+        reason.Text("Absturz (Signal ").Int(signal).Text(")");
+
+        if (recorder.WriteDump(recorder.crashPath, reason.Get())) {
+            WriteText(2, "[FEHLER] Absturz, Flight Recorder gesichert: ");
+            WriteText(2, recorder.crashPath);
+            WriteText(2, "\n");
+        }
+
+        std::raise(signal);
+    }
+
+    void FlightRecorder::OnTerminate() {
+        GetInstance().Dump("Absturz (std::terminate)");
+
+        // Das folgende abort() soll keinen zweiten Dump ausloesen
+        std::signal(SIGABRT, SIG_DFL);
+
+        if (previousTerminateHandler) {
+            previousTerminateHandler();
+        }
+        std::abort();
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "GameConfig.h"
+#include "EventBus.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+    // === Art eines Flight-Recorder-Eintrags ===
+    enum FlightRecordType : uint8_t {
+        RECORD_FRAME,
+        RECORD_STATE_CHANGE,
+        RECORD_SAVE_IO,
+        RECORD_GAME_EVENT
+    };
+
+    /**
+     * @brief Ein Eintrag im Ringpuffer (16 Byte, ohne Heap)
+     *
+     * Bedeutung der Felder je nach Typ:
+     * - FRAME:        count = Objekte, extra = Heap-Allokationen, value = Frame-Zeit (ms)
+     * - STATE_CHANGE: kind = neuer GameState, extra = alter GameState
+     * - SAVE_IO:      kind = SaveOperation, extra = 1 bei Erfolg, value = Dauer (ms)
+     * - GAME_EVENT:   kind = GameEventType, extra = Spieler, count = Ereigniswert
+     */
+    struct FlightRecord {
+        FlightRecordType type;
+        uint8_t kind;
+        int16_t extra;
+        int32_t count;
+        float value;
+        float time;     // Sekunden seit Programmstart
+    };
+
+    /**
+     * @brief Immer aktiver Flight Recorder fuer Post-Mortem-Analysen
+     *
+     * Haelt die letzten Frames, GameState-Wechsel, Save-I/O und Gameplay-
+     * Ereignisse in einem festen Ringpuffer. Ueberschreitet ein Frame das
+     * Budget oder stuerzt das Spiel ab, wird der Puffer (die letzten
+     * FLIGHT_RECORDER_SECONDS) als Textdatei in FLIGHT_RECORDER_FOLDER
+     * geschrieben. Aufzeichnen kostet nur eine Kopie von 16 Byte.
+     *
+     * Aufgezeichnet wird nur vom Haupt-Thread.
+     */
+    class FlightRecorder {
+    public:
+        // === Save-Operationen ===
+        enum SaveOperation : uint8_t {
+            SAVE_OPEN,
+            SAVE_COMMIT
+        };
+
+        // === Singleton Pattern ===
+        static FlightRecorder& GetInstance();
+
+        // === Aufzeichnung ===
+        void RecordFrame(float frameTimeMs, size_t objectCount, size_t allocations);
+        void RecordStateChange(GameState from, GameState to);
+        void RecordSaveIO(SaveOperation operation, bool success, float durationMs);
+        void RecordGameEvent(const GameEvent& event);
+
+        // === Dumps ===
+        void SetFrameBudget(float milliseconds);
+        float GetFrameBudget() const;
+        bool Dump(const char* reason);
+        void InstallCrashHandlers();
+
+        // === Constants ===
+        static const size_t CAPACITY = 8192;            // Zweierpotenz
+        static inline const float DUMP_COOLDOWN = 10.0f; // Sekunden zwischen zwei Spike-Dumps
+
+    private:
+        // === Singleton - Private Konstruktor ===
+        FlightRecorder();
+        FlightRecorder(const FlightRecorder&) = delete;
+        FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+        // === Private Hilfsfunktionen ===
+        void Push(const FlightRecord& record);
+        float Now() const;
+        bool WriteDump(const char* path, const char* reason);
+        static void OnSignal(int signal);
+        static void OnTerminate();
+
+        // === Ringpuffer ===
+        std::array<FlightRecord, CAPACITY> records;
+        size_t writeIndex;
+
+        // === Zustand ===
+        std::chrono::steady_clock::time_point startTime;
+        float frameBudgetMs;
+        float lastDumpTime;
+        int dumpCount;
+        std::atomic<bool> dumping;
+        char crashPath[256];  // beim Installieren der Handler festgelegt
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "FrameArena.h"
+#include "MemoryTracker.h"
+
+namespace SpaceInvaders {
+
+    // === Singleton Instance ===
+    FrameArena& FrameArena::GetInstance() {
+        static FrameArena instance;
+        return instance;
+    }
+
+    // === Konstruktor ===
+    FrameArena::FrameArena()
+        : monotonic(buffer, ARENA_SIZE, std::pmr::new_delete_resource())
+        , counting(&monotonic)
+        , peakBytesUsed(0)
+    {
+    }
+
+    // === Frame-Verwaltung ===
+    void FrameArena::Reset() {
+        if (counting.bytesUsed > peakBytesUsed) {
+            peakBytesUsed = counting.bytesUsed;
+        }
+        monotonic.release();
+        counting.bytesUsed = 0;
+    }
+
+    std::pmr::memory_resource* FrameArena::GetResource() {
+        return &counting;
+    }
+
+    // === Statistiken ===
+    size_t FrameArena::GetBytesUsed() const {
+        return counting.bytesUsed;
+    }
+
+    size_t FrameArena::GetPeakBytesUsed() const {
+        return peakBytesUsed > counting.bytesUsed ? peakBytesUsed : counting.bytesUsed;
+    }
+
+    size_t FrameArena::GetAllocationCount() {
+        return MemoryTracker::GetAllocationCount();
+    }
+
+    // === CountingResource ===
+    FrameArena::CountingResource::CountingResource(std::pmr::memory_resource* upstream)
+        : bytesUsed(0)
+        , upstream(upstream)
+    {
+    }
+
+    void* FrameArena::CountingResource::do_allocate(size_t bytes, size_t alignment) {
+        bytesUsed += bytes;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void FrameArena::CountingResource::do_deallocate(void*, size_t, size_t) {
+        // Monotoner Puffer: Freigabe erfolgt gesammelt in Reset()
+    }
+
+    bool FrameArena::CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    // === AllocationScope ===
+    AllocationScope::AllocationScope()
+        : startCount(FrameArena::GetAllocationCount())
+    {
+    }
+
+    size_t AllocationScope::GetAllocationCount() const {
+        return FrameArena::GetAllocationCount() - startCount;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
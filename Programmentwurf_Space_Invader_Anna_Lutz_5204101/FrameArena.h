@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Per-Frame Scratch-Arena fuer kurzlebige Allokationen
+     *
+     * Monotoner Speicherbereich, der zu Beginn jedes Game::Update
+     * zurueckgesetzt wird. Container mit PMR-Allocator (FrameVector,
+     * FrameString) holen ihren Speicher hier statt ueber globales new.
+     * Reicht der Puffer nicht aus, wird auf den Heap ausgewichen
+     * (wird im Allokations-Zaehler sichtbar).
+     *
+     * GetAllocationCount() liefert den Zaehler des MemoryTracker, damit
+     * allokationsfreie Gameplay-Frames ueberprueft werden koennen.
+     */
+    class FrameArena {
+    public:
+        // === Singleton Pattern ===
+        static FrameArena& GetInstance();
+
+        // === Frame-Verwaltung ===
+        void Reset();
+        std::pmr::memory_resource* GetResource();
+
+        // === Statistiken ===
+        size_t GetBytesUsed() const;
+        size_t GetPeakBytesUsed() const;
+
+        // === Globaler Allokations-Zaehler ===
+        static size_t GetAllocationCount();
+
+        // === Constants ===
+        static const size_t ARENA_SIZE = 64 * 1024;
+
+    private:
+        // === Singleton - Private Konstruktor ===
+        FrameArena();
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // === Zaehlende Zwischenschicht ueber dem monotonen Puffer ===
+        class CountingResource : public std::pmr::memory_resource {
+        public:
+            explicit CountingResource(std::pmr::memory_resource* upstream);
+            size_t bytesUsed;
+
+        private:
+            std::pmr::memory_resource* upstream;
+            void* do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+        };
+
+        alignas(std::max_align_t) unsigned char buffer[ARENA_SIZE];
+        std::pmr::monotonic_buffer_resource monotonic;
+        CountingResource counting;
+        size_t peakBytesUsed;
+    };
+
+    /**
+     * @brief Zaehlt globale Allokationen innerhalb eines Bereichs
+     */
+    class AllocationScope {
+    public:
+        AllocationScope();
+        size_t GetAllocationCount() const;
+
+    private:
+        size_t startCount;
+    };
+
+    // === Container auf der Frame-Arena (nur innerhalb eines Frames gueltig) ===
+    template <typename T>
+    using FrameVector = std::pmr::vector<T>;
+    using FrameString = std::pmr::string;
+
+} // namespace SpaceInvaders
\ No newline at end of file
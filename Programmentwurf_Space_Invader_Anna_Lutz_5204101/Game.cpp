@@ -1,25 +1,45 @@
 #include "Game.h"
-#include <iostream>
+#include "DifficultyProfile.h"
+#include "GameRandom.h"
+#include "InitGraph.h"
 #include <cstdlib>
 #include <ctime>
+#include <chrono>
+#include <algorithm>
 
 namespace SpaceInvaders {
 
+    namespace {
+
+        // Bildschirmposition -> Stereo-Panorama (-1 links, 1 rechts)
+        float StereoPan(Vector2 position) {
+            return position.x / GameConfig::SCREEN_WIDTH * 2.0f - 1.0f;
+        }
+
+    } // namespace
+
     // === Konstruktor ===
     Game::Game()
         : textureManager(TextureManager::GetInstance())
         , currentState(STATE_MAINMENU)
         , previousState(STATE_MAINMENU)
         , currentDifficulty(DIFF_MEDIUM)
+        , gameplayStep(&Game::StepGameplay<MediumProfile>)
         , isMultiPlayer(false)
         , gameInitialized(false)
+        , playerInputs{ InputManager::PLAYER_NONE, InputManager::PLAYER_NONE }
         , gameTime(0.0f)
-        , enemySpawnTimer(0.0f)
+        , enemySpawnTimer(TimerWheel::INVALID_HANDLE)
         , backgroundScroll(0.0f)
-        , bossSpawnTimer(0.0f)
+        , bossSpawnTimer(TimerWheel::INVALID_HANDLE)
+        , autosaveTimer(TimerWheel::INVALID_HANDLE)
+        , rewindHistory(GameConfig::REWIND_HISTORY_FRAMES, GameConfig::REWIND_KEYFRAME_INTERVAL)
+        , runRewound(false)
+        , snapshotRestores(0)
+        , netGameOverFrame(0)
         , bossActive(false)
         , slowMotionActive(false)
-        , slowMotionTimer(0.0f)
+        , slowMotionTimer(TimerWheel::INVALID_HANDLE)
         , timeScale(1.0f)
         , spSetupState(SP_NAME_INPUT)
         , selectedAvatar(AVATAR_BLUE)
@@ -30,7 +50,7 @@ namespace SpaceInvaders {
         , finalScore(0)
         , newHighscore(false)
     {
-        srand((unsigned int)time(nullptr));
+        GameRandom::Seed((uint64_t)time(nullptr));
     }
 
     // === Destruktor ===
@@ -40,67 +60,231 @@ namespace SpaceInvaders {
 
     // === Initialisierung ===
     bool Game::Initialize() {
-        InitWindow(GameConfig::SCREEN_WIDTH, GameConfig::SCREEN_HEIGHT, "Space Invaders");
-        SetTargetFPS(GameConfig::TARGET_FPS);
+        startupBegin = std::chrono::steady_clock::now();
+
+        // Bei Abstrzen die letzten Sekunden sichern
+        FlightRecorder::GetInstance().InstallCrashHandlers();
+
+        // Unabhaengige Schritte laufen parallel, alles mit OpenGL-Kontext bleibt auf dem Haupt-Thread.
+        // Avatar- und Mod-Auswahl werden erst beim ersten Besuch aufgebaut (EnsureSelectionScreens).
+        InitGraph graph;
+
+        int window = graph.AddStep("Fenster", INIT_MAIN_THREAD, {}, []() {
+            InitWindow(GameConfig::SCREEN_WIDTH, GameConfig::SCREEN_HEIGHT, "Space Invaders");
+            SetTargetFPS(GameConfig::TARGET_FPS);
+            return IsWindowReady();
+        });
+
+        int decodeTextures = graph.AddStep("Texturen dekodieren", INIT_WORKER_THREAD, {}, [this]() {
+            return textureManager.DecodeAllTextures();
+        });
+
+        int saves = graph.AddStep("Spielstand", INIT_WORKER_THREAD, {}, [this]() {
+            saveSystem = std::make_unique<SaveSystem>();
+            return saveSystem->Initialize();
+        });
+
+        graph.AddStep("Audio", INIT_WORKER_THREAD, {}, []() {
+            // Ohne Audio-Geraet laeuft das Spiel mit dem Null-Device weiter
+            AudioMixer::GetInstance().Initialize();
+            return true;
+        });
+
+        graph.AddStep("Texturen hochladen", INIT_MAIN_THREAD, { window, decodeTextures }, [this]() {
+            return textureManager.UploadDecodedTextures();
+        });
+
+        graph.AddStep("Gameplay", INIT_MAIN_THREAD, {}, [this]() {
+            gameRenderer = std::make_unique<GameRenderer>();
+            gameplayManager = std::make_unique<GameplayManager>();
+            return true;
+        });
+
+        // MenuSystem misst Texte mit dem Standard-Font, braucht also das Fenster
+        graph.AddStep("Hauptmenue", INIT_MAIN_THREAD, { window, saves }, [this]() {
+            menuSystem = std::make_unique<MenuSystem>();
+            menuSystem->SetSaveSystem(saveSystem.get());
+            menuSystem->SetInputManager(&inputManager);  // abgetastet wird nur in Run
+            return menuSystem->Initialize();
+        });
+
+        bool initialized = graph.Run();
+        graph.LogTimeline();
+
+        // Save-I/O der Worker erst jetzt auf dem Haupt-Thread aufzeichnen
+        if (saveSystem) {
+            saveSystem->ReportPendingIO();
+        }
 
-        if (!textureManager.LoadAllTextures()) {
-            std::cerr << "[FEHLER] Texturen konnten nicht geladen werden!" << std::endl;
+        if (!initialized) {
+            Logger::Error("Ein Subsystem konnte nicht initialisiert werden!");
             return false;
         }
 
-        // Subsysteme erstellen
-        saveSystem = std::make_unique<SaveSystem>();
-        menuSystem = std::make_unique<MenuSystem>();
-        avatarManager = std::make_unique<AvatarManager>();
-        modManager = std::make_unique<ModManager>();
-        gameRenderer = std::make_unique<GameRenderer>();
-        gameplayManager = std::make_unique<GameplayManager>();
+        ConnectEventConsumers();
 
-        // Subsysteme initialisieren
-        if (!saveSystem->Initialize() || !menuSystem->Initialize() ||
-            !avatarManager->Initialize() || !modManager->Initialize()) {
-            std::cerr << "[FEHLER] Ein Subsystem konnte nicht initialisiert werden!" << std::endl;
-            return false;
+        if (GameConfig::METRICS_ENABLED) {
+            MetricsServer::GetInstance().Start((uint16_t)GameConfig::METRICS_PORT);
         }
 
         gameInitialized = true;
-        std::cout << "[INFO] Spiel erfolgreich initialisiert!" << std::endl;
+        Logger::Info("Spiel erfolgreich initialisiert!");
+        return true;
+    }
+
+    // === Erst beim ersten Besuch aufgebaute Screens ===
+    bool Game::EnsureSelectionScreens() {
+        if (avatarManager && modManager) return true;
+
+        TraceScope trace("Game::EnsureSelectionScreens");
+        auto buildStart = std::chrono::steady_clock::now();
+
+        auto avatars = std::make_unique<AvatarManager>();
+        auto mods = std::make_unique<ModManager>();
+
+        // Gemeinsamer Save-Container und derselbe Eingabe-Snapshot wie das Hauptmenue
+        avatars->SetSaveSystem(saveSystem.get());
+        mods->SetSaveSystem(saveSystem.get());
+        avatars->SetInputManager(&inputManager);
+        mods->SetInputManager(&inputManager);
+
+        if (!avatars->Initialize() || !mods->Initialize()) {
+            Logger::Error("Avatar- oder Mod-Auswahl konnte nicht initialisiert werden!");
+            return false;
+        }
+
+        avatarManager = std::move(avatars);
+        modManager = std::move(mods);
+        Logger::Info("Auswahl-Screens aufgebaut in %.1f ms", std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - buildStart).count());
         return true;
     }
 
     // === Hauptschleife ===
     void Game::Run() {
         if (!gameInitialized) {
-            std::cerr << "[FEHLER] Spiel wurde nicht korrekt initialisiert!" << std::endl;
+            Logger::Error("Spiel wurde nicht korrekt initialisiert!");
             return;
         }
 
+        FlightRecorder& flightRecorder = FlightRecorder::GetInstance();
+        MetricsServer& metrics = MetricsServer::GetInstance();
+        auto frameStart = std::chrono::steady_clock::now();
+        bool firstFrameLogged = false;
+
         while (!WindowShouldClose()) {
             float deltaTime = GetFrameTime();
-            Update(deltaTime);
-            Render();
+
+            // Allokationen pro Frame zaehlen (eingeschwungene Gameplay-Frames sollen 0 haben)
+#ifdef _DEBUG
+            bool wasInGame = (currentState == STATE_GAME);
+            size_t spawnsBefore = gameplayManager->GetSpawnCount();
+            size_t restoresBefore = snapshotRestores;
+#endif
+            GameState stateBefore = currentState;
+            AllocationScope frameAllocations;
+
+            auto updateStart = std::chrono::steady_clock::now();
+            std::chrono::steady_clock::time_point updateEnd;
+            {
+                TraceScope frameTrace("Frame");
+
+                // Einzige Abtastung der Eingaben pro Frame, alle Konsumenten lesen den Snapshot
+                inputManager.Sample(deltaTime);
+                Update(deltaTime);
+                updateEnd = std::chrono::steady_clock::now();
+                Render();
+            }
+
+            // Flight Recorder: komplette Frame-Zeit inkl. VSync-Wartezeit
+            auto frameEnd = std::chrono::steady_clock::now();
+            float frameTimeMs = std::chrono::duration<float, std::milli>(frameEnd - frameStart).count();
+            frameStart = frameEnd;
+
+            // Nach jedem Neustart die wichtigste Zahl: ab wann das Hauptmenue bedienbar ist
+            if (!firstFrameLogged) {
+                Logger::Info("Erster bedienbarer Frame nach %.1f ms",
+                    std::chrono::duration<float, std::milli>(frameEnd - startupBegin).count());
+                firstFrameLogged = true;
+            }
+
+            if (currentState != stateBefore) {
+                flightRecorder.RecordStateChange(stateBefore, currentState);
+            }
+            flightRecorder.RecordFrame(frameTimeMs, GetGameObjectCount(), frameAllocations.GetAllocationCount());
+            saveSystem->ReportPendingIO();
+            MemoryTracker::EndFrame();
+
+            // Metriken fuer den Flotten-Agenten (Render inkl. VSync-Wartezeit)
+            metrics.PublishFrame(frameTimeMs,
+                std::chrono::duration<float, std::milli>(updateEnd - updateStart).count(),
+                std::chrono::duration<float, std::milli>(frameEnd - updateEnd).count(),
+                frameAllocations.GetAllocationCount());
+            PublishMetrics();
+
+#ifdef _DEBUG
+            // Eingeschwungen: nichts erzeugt, nichts wiederhergestellt. Save-I/O und
+            // Hintergrund-Threads laufen unter eigenen Bereichen und zaehlen nicht mit.
+            bool steadyState = wasInGame && currentState == STATE_GAME && !rollbackSession &&
+                gameplayManager->GetSpawnCount() == spawnsBefore && snapshotRestores == restoresBefore;
+            size_t gameplayAllocations = MemoryTracker::GetStats(MEMORY_GAMEPLAY).frameAllocations;
+            if (steadyState && gameplayAllocations > 0) {
+                Logger::Error("%zu Heap-Allokationen in eingeschwungenem Gameplay-Frame!", gameplayAllocations);
+                Logger::GetInstance().Flush();
+                std::abort();
+            }
+#endif
         }
     }
 
     // === Aufrumen ===
     void Game::Shutdown() {
+        MetricsServer::GetInstance().Stop();
+        statisticsCollector.Stop();
+        EndNetworkMatch();
+
+        // Laufende Partie sichern, damit sie nach dem Neustart fortgesetzt werden kann
+        if (currentState == STATE_GAME || currentState == STATE_PAUSE) {
+            Autosave();
+        }
+        if (saveSystem) {
+            saveSystem->WaitForPendingWrites();
+        }
+
         gameplayManager->ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
         textureManager.UnloadAllTextures();
+        AudioMixer::GetInstance().Shutdown();
         CloseWindow();
-        std::cout << "[INFO] Spiel beendet." << std::endl;
+        Logger::Info("Heap beim Beenden: %zu Bytes live, Peak %zu Bytes",
+            MemoryTracker::GetLiveBytes(), MemoryTracker::GetPeakBytes());
+        Logger::Info("Spiel beendet.");
     }
 
     // === Update ===
     void Game::Update(float deltaTime) {
+        TraceScope trace("Game::Update");
+        MemoryTagScope memoryTag(currentState == STATE_GAME ? MEMORY_GAMEPLAY : MEMORY_MENUS);
+
+        // Scratch-Speicher des letzten Frames freigeben
+        FrameArena::GetInstance().Reset();
+
         if (inputManager.IsExitPressed()) {
             CloseWindow();
             return;
         }
 
+        // Speicher-Diagnose
+        if (inputManager.IsDebugOverlayPressed()) {
+            gameRenderer->ToggleMemoryOverlay();
+        }
+        if (inputManager.IsMemoryReportPressed()) {
+            MemoryTracker::WriteReport(GameConfig::MEMORY_REPORT_FILE, textureManager.GetTotalVideoMemory());
+        }
+
         switch (currentState) {
         case STATE_MAINMENU: UpdateMainMenu(deltaTime); break;
         case STATE_SINGLEPLAYER_SETUP: UpdateSinglePlayerSetup(deltaTime); break;
-        case STATE_MULTIPLAYER_SETUP: UpdateMultiPlayerSetup(deltaTime); break;
+        case STATE_MULTIPLAYER_SETUP: UpdateMultiPlayerSetup(); break;
         case STATE_DIFFICULTY_SELECTION: UpdateDifficultySelection(deltaTime); break;
         case STATE_STATISTICS: UpdateStatistics(deltaTime); break;
         case STATE_RULES: UpdateRules(deltaTime); break;
@@ -112,6 +296,9 @@ namespace SpaceInvaders {
 
     // === Render ===
     void Game::Render() {
+        TraceScope trace("Game::Render");
+        MemoryTagScope memoryTag(currentState == STATE_GAME ? MEMORY_GAMEPLAY : MEMORY_MENUS);
+
         switch (currentState) {
         case STATE_MAINMENU: RenderMainMenu(); break;
         case STATE_SINGLEPLAYER_SETUP: RenderSinglePlayerSetup(); break;
@@ -128,10 +315,16 @@ namespace SpaceInvaders {
     // === State Updates (stark vereinfacht) ===
     void Game::UpdateMainMenu(float deltaTime) {
         int currentCoins = saveSystem->LoadCoins();
+        // Gespeicherte Partie fortsetzen
+        if (inputManager.IsResumeRunPressed() && ResumeSavedRun()) {
+            return;
+        }
+
         auto result = menuSystem->UpdateMainMenu(deltaTime, currentCoins);
 
         switch (result) {
         case MenuSystem::MAIN_SINGLEPLAYER:
+            if (!EnsureSelectionScreens()) break;
             currentState = STATE_SINGLEPLAYER_SETUP;
             spSetupState = SP_NAME_INPUT;
             playerName.clear();
@@ -139,6 +332,7 @@ namespace SpaceInvaders {
             modManager->ResetSelection();
             break;
         case MenuSystem::MAIN_MULTIPLAYER:
+            if (!EnsureSelectionScreens()) break;
             currentState = STATE_MULTIPLAYER_SETUP;
             avatarManager->ResetMultiPlayerSelection();
             break;
@@ -194,8 +388,8 @@ namespace SpaceInvaders {
         }
     }
 
-    void Game::UpdateMultiPlayerSetup(float deltaTime) {
-        auto result = avatarManager->UpdateMultiPlayerSelection(deltaTime);
+    void Game::UpdateMultiPlayerSetup() {
+        auto result = avatarManager->UpdateMultiPlayerSelection();
 
         if (result == AvatarManager::MP_BOTH_CHOSEN) {
             player1Avatar = avatarManager->GetPlayer1Avatar();
@@ -233,98 +427,167 @@ namespace SpaceInvaders {
     }
 
     void Game::UpdateGameplay(float deltaTime) {
+        // Partikel sind reine Optik: einmal pro dargestelltem Frame, auch im Netzwerk-Modus
+        UpdateParticles(deltaTime);
+
+        // Netzwerk-Partie: keine Pause und kein Rewind, die Simulation gehrt der RollbackSession
+        if (rollbackSession) {
+            UpdateNetworkGameplay();
+            return;
+        }
+
         // Pause prfen
         if (inputManager.IsPausePressed()) {
             previousState = currentState;
             currentState = STATE_PAUSE;
+            Autosave();
             return;
         }
 
-        // Time Scale fr SlowMotion
-        timeScale = slowMotionActive ? 0.4f : 1.0f;
-        if (slowMotionActive) {
-            slowMotionTimer -= deltaTime;
-            if (slowMotionTimer <= 0.0f) {
-                slowMotionActive = false;
-                timeScale = 1.0f;
-            }
+        // Debug-Rewind: einige Sekunden zurckspringen
+        if (GameConfig::REWIND_ENABLED && inputManager.IsRewindPressed() &&
+            rewindHistory.Rewind(GameConfig::REWIND_FRAMES, snapshotBuffer)) {
+            particles.Clear();
+            RestoreSnapshot(snapshotBuffer);
+            runRewound = true;
+            return;
         }
 
-        float scaledDeltaTime = deltaTime * timeScale;
-        gameTime += deltaTime;
+        // Beim Partiestart gewhlte Instanz fr den Schwierigkeitsgrad
+        playerInputs[0] = inputManager.GetPlayer1Input();
+        playerInputs[1] = inputManager.GetPlayer2Input();
+        (this->*gameplayStep)(deltaTime);
 
-        // Hintergrund scrollen
-        float scrollSpeed = GameConfig::GetBackgroundScrollSpeed(currentDifficulty);
-        backgroundScroll += scrollSpeed * deltaTime;
-        if (backgroundScroll >= textureManager.GetBackgroundTexture().height) {
-            backgroundScroll = 0.0f;
+        if (GameConfig::REWIND_ENABLED) {
+            CaptureSnapshot(snapshotBuffer);
+            rewindHistory.Record(snapshotBuffer);
         }
 
-        // Player Input und Updates
-        HandlePlayerInput(deltaTime);
-
-        // Enemy Spawning
-        enemySpawnTimer += deltaTime;
-        if (enemySpawnTimer >= GameConfig::GetEnemySpawnInterval(currentDifficulty) && !bossActive) {
-            gameplayManager->SpawnEnemy(enemies, currentDifficulty);
-            enemySpawnTimer = 0.0f;
+        // Game Over prfen
+        bool gameOver = (!players.empty() && players[0] && players[0]->GetLives() <= 0);
+        if (gameOver) {
+            FinishRun();
         }
+    }
 
-        // Boss Spawning
-        bossSpawnTimer += deltaTime;
-        if (!bossActive && bossSpawnTimer >= GameConfig::GetBossSpawnTime(currentDifficulty)) {
-            gameplayManager->SpawnBoss(boss, bossActive, currentDifficulty);
-            bossSpawnTimer = 0.0f;
+    void Game::UpdateNetworkGameplay() {
+        // Gegenseite weg: Partie mit dem aktuellen Stand beenden
+        if (!netSession->IsConnected() || netSession->GetSecondsSinceReceive() > GameConfig::NET_DISCONNECT_TIMEOUT) {
+            Logger::Warning("Netzwerk: Verbindung verloren, Partie wird beendet.");
+            FinishRun();
+            return;
         }
 
-        // Gameplay Manager bernimmt komplette Update-Logik
-        gameplayManager->UpdateGameplay(players, enemies, bullets, enemyBullets, powerUps, explosions,
-            boss, bossActive, deltaTime, scaledDeltaTime, currentDifficulty, isMultiPlayer);
+        // Lokal steuern immer die Pfeiltasten, simuliert wird mit festem Zeitschritt
+        rollbackSession->Update((uint8_t)inputManager.GetPlayer1Input());
 
-        // Game Over prfen
+        // Game Over erst, wenn es auch mit den echten Eingaben der Gegenseite feststeht
         bool gameOver = (!players.empty() && players[0] && players[0]->GetLives() <= 0);
-        if (gameOver) {
-            finalScore = 0;
-            for (const auto& player : players) {
-                if (player) finalScore += player->GetScore();
+        if (!gameOver) {
+            netGameOverFrame = 0;
+            return;
+        }
+        if (netGameOverFrame == 0) {
+            netGameOverFrame = rollbackSession->GetFrame();
+        }
+        if (rollbackSession->GetConfirmedFrame() >= netGameOverFrame) {
+            FinishRun();
+        }
+    }
+
+    void Game::UpdateParticles(float deltaTime) {
+        TraceScope trace("Game::UpdateParticles");
+
+        // Schweif hinter jedem Spieler-Schuss
+        for (const auto& bullet : bullets) {
+            if (bullet->IsActive()) {
+                particles.Emit(PARTICLES_BULLET_TRAIL, ToVector2(bullet->GetPosition()));
             }
+        }
+        particles.Update(deltaTime);
+    }
 
-            if (!isMultiPlayer) {
-                // Singleplayer: Coins und Statistiken
-                int coinsEarned = finalScore / 2;
-                int currentCoins = saveSystem->LoadCoins();
-                saveSystem->SaveCoins(currentCoins + coinsEarned);
+    void Game::FinishRun() {
+        finalScore = 0;
+        for (const auto& player : players) {
+            if (player) finalScore += player->GetScore();
+        }
 
-                if (!players.empty() && players[0]) {
-                    saveSystem->SaveHighscore(players[0]->GetName(), finalScore,
-                        selectedAvatar, selectedMod, currentDifficulty);
-                }
+        // Rundenende sofort verteilen, damit alle Konsumenten vollstndig sind
+        EventBus& events = gameplayManager->GetEventBus();
+        events.Publish({ EVENT_RUN_ENDED, -1, 0, finalScore, { 0, 0 } });
+        events.Dispatch();
+
+        if (!isMultiPlayer) {
+            // Singleplayer: Coins und Statistiken (ein gemeinsamer Commit)
+            RunTotals totals = statisticsCollector.WaitForTotals();
+            if (totals.droppedEvents > 0) {
+                Logger::Warning("Statistik-Kanal voll: %d Ereignisse verworfen, Zaehler sind zu niedrig",
+                    totals.droppedEvents);
+            }
+            saveSystem->BeginTransaction();
 
-                saveSystem->UpdateGameStatistics(finalScore, coinsEarned, 0, false,
+            int coinsEarned = finalScore / 2;
+            int currentCoins = saveSystem->LoadCoins();
+            saveSystem->SaveCoins(currentCoins + coinsEarned);
+
+            if (!players.empty() && players[0]) {
+                saveSystem->SaveHighscore(players[0]->GetName(), finalScore,
+                    selectedAvatar, selectedMod, currentDifficulty);
+            }
+
+            // Nach einem Rewind zaehlen die Totals auch verworfene Abschuesse mit
+            if (!runRewound) {
+                saveSystem->UpdateGameStatistics(finalScore, coinsEarned, totals.enemiesKilled,
+                    totals.bossesDefeated > 0,
                     gameTime, selectedAvatar, currentDifficulty);
             }
             else {
-                // Multiplayer: Nur Bestscore
-                int currentBest = saveSystem->LoadBestMultiplayerScore();
-                if (finalScore > currentBest) {
-                    saveSystem->SaveBestMultiplayerScore(finalScore);
-                    newHighscore = true;
-                }
+                Logger::Info("Partie wurde zurueckgespult, Statistiken werden nicht gespeichert");
             }
 
-            currentState = STATE_GAMEOVER;
+            saveSystem->ClearRunSnapshot();
+            saveSystem->CommitTransaction();
+
+            // Einzelne Runde fuer die Auswertungen (eigene Spaltendateien, nicht im Container)
+            if (!runRewound) {
+                RunRecord record = {};
+                record.timestamp = (int64_t)time(nullptr);
+                record.score = finalScore;
+                record.duration = gameTime;
+                record.enemiesKilled = totals.enemiesKilled;
+                record.bossesDefeated = totals.bossesDefeated;
+                record.avatar = (uint8_t)selectedAvatar;
+                record.mod = (uint8_t)selectedMod;
+                record.difficulty = (uint8_t)currentDifficulty;
+                record.cause = (uint8_t)totals.lastHitCause;
+                saveSystem->AppendRunRecord(record);
+            }
         }
+        else {
+            // Multiplayer: Nur Bestscore
+            int currentBest = saveSystem->LoadBestMultiplayerScore();
+            if (finalScore > currentBest) {
+                saveSystem->SaveBestMultiplayerScore(finalScore);
+                newHighscore = true;
+            }
+            if (!netSession) {
+                saveSystem->ClearRunSnapshot();
+            }
+        }
+
+        currentState = STATE_GAMEOVER;
+        EndNetworkMatch();
     }
 
     void Game::UpdateGameOver(float deltaTime) {
         if (menuSystem->UpdateGameOver(deltaTime, finalScore, isMultiPlayer)) {
             // Reset
             gameplayManager->ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
+            particles.Clear();
             players.clear();
             gameTime = 0.0f;
-            enemySpawnTimer = 0.0f;
-            bossSpawnTimer = 0.0f;
-            slowMotionActive = false;
+            ResetGameplayTimers();
             coinsAwarded = false;
             newHighscore = false;
             currentState = STATE_MAINMENU;
@@ -339,13 +602,16 @@ namespace SpaceInvaders {
         }
         else if (result == MenuSystem::PAUSE_MAIN_MENU) {
             gameplayManager->ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
+            particles.Clear();
             players.clear();
+            ResetGameplayTimers();
             currentState = STATE_MAINMENU;
         }
     }
 
     // === Gameplay-Setup (vereinfacht) ===
     void Game::InitializeSinglePlayer() {
+        MemoryTagScope memoryTag(MEMORY_GAMEPLAY);
         isMultiPlayer = false;
 
         Vector2 startPos = {
@@ -354,24 +620,32 @@ namespace SpaceInvaders {
         };
 
         players.clear();
-        auto player = std::make_unique<Player>(selectedAvatar, startPos);
+        ResetGameplayTimers();
+
+        auto player = std::make_unique<Player>(selectedAvatar, ToSimVector2(startPos));
         player->SetName(playerName);
         player->ApplyStartMod(selectedMod);
 
         if (selectedMod == MOD_SLOWMO) {
-            slowMotionActive = true;
-            slowMotionTimer = GameConfig::POWERUP_DURATION;
+            StartSlowMotion(TimerWheel::SecondsToTicks(GameConfig::POWERUP_DURATION));
         }
 
         players.push_back(std::move(player));
 
         gameplayManager->ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
+        particles.Clear();
+        gameplayManager->GetEventBus().Publish({ EVENT_RUN_STARTED, -1, 0, 0, { 0, 0 } });
         gameTime = 0.0f;
-        enemySpawnTimer = 0.0f;
-        bossSpawnTimer = 0.0f;
+
+        // Neue Partie ersetzt eine gespeicherte
+        rewindHistory.Clear();
+        runRewound = false;
+        saveSystem->ClearRunSnapshot();
+        SelectDifficultyPipeline();
     }
 
     void Game::InitializeMultiPlayer() {
+        MemoryTagScope memoryTag(MEMORY_GAMEPLAY);
         isMultiPlayer = true;
 
         Vector2 p1StartPos = {
@@ -384,8 +658,10 @@ namespace SpaceInvaders {
         };
 
         players.clear();
-        auto player1 = std::make_unique<Player>(player1Avatar, p1StartPos);
-        auto player2 = std::make_unique<Player>(player2Avatar, p2StartPos);
+        ResetGameplayTimers();
+
+        auto player1 = std::make_unique<Player>(player1Avatar, ToSimVector2(p1StartPos));
+        auto player2 = std::make_unique<Player>(player2Avatar, ToSimVector2(p2StartPos));
 
         player1->SetName("Player 1");
         player2->SetName("Player 2");
@@ -394,67 +670,373 @@ namespace SpaceInvaders {
         players.push_back(std::move(player2));
 
         gameplayManager->ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
+        particles.Clear();
+        gameplayManager->GetEventBus().Publish({ EVENT_RUN_STARTED, -1, 0, 0, { 0, 0 } });
         gameTime = 0.0f;
-        enemySpawnTimer = 0.0f;
-        bossSpawnTimer = 0.0f;
+
+        // Neue Partie ersetzt eine gespeicherte (Netzwerk-Partien werden nie gespeichert)
+        rewindHistory.Clear();
+        runRewound = false;
+        if (!netSession) {
+            saveSystem->ClearRunSnapshot();
+        }
+        SelectDifficultyPipeline();
+    }
+
+    // === Netzwerk-Partie ===
+    void Game::StartNetworkMatch(std::unique_ptr<NetSession> session) {
+        netSession = std::move(session);
+        const NetMatchSettings& settings = netSession->GetSettings();
+
+        // Beide Prozesse starten mit identischem Zustand und Zufallsgenerator
+        GameRandom::Seed(settings.seed);
+        currentDifficulty = settings.difficulty;
+        player1Avatar = AVATAR_BLUE;
+        player2Avatar = AVATAR_GREEN;
+        backgroundScroll = 0.0f;
+        InitializeMultiPlayer();
+
+        RollbackSession::Callbacks callbacks;
+        callbacks.saveState = [this](std::vector<uint8_t>& out) {
+            CaptureSnapshot(out);
+        };
+        callbacks.loadState = [this](const std::vector<uint8_t>& state) {
+            RestoreSnapshot(state);
+        };
+        callbacks.advanceFrame = [this](const uint8_t inputs[2]) {
+            playerInputs[0] = (InputManager::PlayerInput)inputs[0];
+            playerInputs[1] = (InputManager::PlayerInput)inputs[1];
+
+            // Wiederholte Frames nicht noch einmal an die Hintergrund-Kanaele weiterreichen
+            EventBus& events = gameplayManager->GetEventBus();
+            events.SetResimulating(IsResimulating());
+            (this->*gameplayStep)(1.0f / GameConfig::SIMULATION_TICK_RATE);
+            events.SetResimulating(false);
+        };
+
+        rollbackSession = std::make_unique<RollbackSession>(*netSession, settings.inputDelay,
+            (uint8_t)InputManager::PLAYER_NONE, std::move(callbacks));
+        netGameOverFrame = 0;
+        netSession->ResetReceiveTimer();
+        currentState = STATE_GAME;
+
+        Logger::Info("Netzwerk-Partie gestartet, du steuerst Player %d mit den Pfeiltasten.",
+            netSession->GetLocalPlayer() + 1);
     }
 
+    void Game::EndNetworkMatch() {
+        if (!rollbackSession) return;
+
+        const RollbackSession::Statistics& statistics = rollbackSession->GetStatistics();
+        Logger::Info("Netzwerk: %u Frames, %u Rollbacks (%u Frames neu simuliert, max. %u), %u Frames gewartet, %u Desyncs",
+            rollbackSession->GetFrame(), statistics.rollbacks, statistics.resimulatedFrames,
+            statistics.longestRollback, statistics.stalledFrames, statistics.desyncs);
+
+        rollbackSession.reset();
+        netSession.reset();
+    }
+
+    // === Event-Bus ===
+    void Game::ConnectEventConsumers() {
+        EventBus& events = gameplayManager->GetEventBus();
+
+        // SlowMotion wirkt global und gehrt deshalb Game
+        events.Subscribe(EVENT_POWERUP_COLLECTED, [this](const GameEvent& event) {
+            if (event.value == POWERUP_SLOWMO) {
+                StartSlowMotion(TimerWheel::SecondsToTicks(GameConfig::POWERUP_DURATION));
+            }
+        });
+
+        // Partikel-Effekte (rein optisch, beeinflussen die Simulation nicht)
+        events.Subscribe(EVENT_ENEMY_KILLED, [this](const GameEvent& event) {
+            if (!IsResimulating()) particles.Emit(PARTICLES_ENEMY_DEATH, event.position);
+        });
+        events.Subscribe(EVENT_BOSS_DEFEATED, [this](const GameEvent& event) {
+            if (!IsResimulating()) particles.Emit(PARTICLES_BOSS_DEATH, event.position);
+        });
+        events.Subscribe(EVENT_POWERUP_COLLECTED, [this](const GameEvent& event) {
+            if (!IsResimulating()) particles.Emit(PARTICLES_POWERUP_PICKUP, event.position);
+        });
+
+        // Soundeffekte (Play legt nur einen Trigger in den Kanal des Mischers)
+        static const SoundId eventSounds[EVENT_COUNT] = {
+            SOUND_COUNT,            // RUN_STARTED
+            SOUND_COUNT,            // RUN_ENDED
+            SOUND_ENEMY_EXPLOSION,  // ENEMY_KILLED
+            SOUND_PLAYER_HIT,       // PLAYER_HIT
+            SOUND_SHIELD_HIT,       // SHIELD_HIT
+            SOUND_POWERUP_PICKUP,   // POWERUP_COLLECTED
+            SOUND_BOSS_HIT,         // BOSS_HIT
+            SOUND_BOSS_EXPLOSION,   // BOSS_DEFEATED
+            SOUND_COUNT,            // BULLET_CANCELLED
+            SOUND_PLAYER_SHOT       // PLAYER_SHOT
+        };
+        for (int type = 0; type < EVENT_COUNT; type++) {
+            if (eventSounds[type] == SOUND_COUNT) continue;
+
+            events.Subscribe((GameEventType)type, [this](const GameEvent& event) {
+                if (IsResimulating()) return;
+
+                SoundId sound = eventSounds[event.type];
+                if (event.type == EVENT_PLAYER_SHOT && event.subtype == Bullet::LASER) {
+                    sound = SOUND_LASER_SHOT;
+                }
+                AudioMixer::GetInstance().Play(sound, StereoPan(event.position));
+            });
+        }
+
+        // Alle Gameplay-Ereignisse landen auch im Flight Recorder
+        for (int type = 0; type < EVENT_COUNT; type++) {
+            events.Subscribe((GameEventType)type, [this](const GameEvent& event) {
+                if (IsResimulating()) return;
+                FlightRecorder::GetInstance().RecordGameEvent(event);
+            });
+        }
+
+        // Rundenstatistik luft auf eigenem Thread
+        events.Connect(&statisticsCollector.GetChannel());
+        statisticsCollector.Start();
+    }
+
+    bool Game::IsResimulating() const {
+        return rollbackSession && rollbackSession->IsResimulating();
+    }
+
+    // === Zeitgesteuerte Ablufe ===
+    void Game::ResetGameplayTimers() {
+        // Ausstehende Ablufe der letzten Runde verwerfen
+        TimerWheel::GetGameTimers().Clear();
+        TimerWheel::GetWorldTimers().Clear();
+
+        enemySpawnTimer = TimerWheel::INVALID_HANDLE;
+        bossSpawnTimer = TimerWheel::INVALID_HANDLE;
+        autosaveTimer = TimerWheel::INVALID_HANDLE;
+        slowMotionTimer = TimerWheel::INVALID_HANDLE;
+        slowMotionActive = false;
+    }
+
+    void Game::StartSlowMotion(uint32_t ticks) {
+        auto& timers = TimerWheel::GetGameTimers();
+        timers.Cancel(slowMotionTimer);
+
+        slowMotionActive = true;
+        slowMotionTimer = timers.ScheduleTicks(ticks, [this]() {
+            slowMotionActive = false;
+            slowMotionTimer = TimerWheel::INVALID_HANDLE;
+        });
+    }
+
+    // === Snapshots ===
+    SnapshotWorld Game::GetSnapshotWorld() {
+        return { players, enemies, bullets, enemyBullets, powerUps, explosions, boss };
+    }
+
+    void Game::CaptureSnapshot(std::vector<uint8_t>& out) {
+        const TimerWheel& timers = TimerWheel::GetGameTimers();
+
+        MatchState match = {};
+        match.randomState = GameRandom::GetState();
+        match.gameTime = gameTime;
+        match.backgroundScroll = backgroundScroll;
+        match.enemySpawnTicks = timers.IsPending(enemySpawnTimer) ? (int32_t)timers.GetRemainingTicks(enemySpawnTimer) : -1;
+        match.bossSpawnTicks = timers.IsPending(bossSpawnTimer) ? (int32_t)timers.GetRemainingTicks(bossSpawnTimer) : -1;
+        match.slowMotionTicks = slowMotionActive ? timers.GetRemainingTicks(slowMotionTimer) : 0;
+        match.gameTickAccumulator = timers.GetTickAccumulator();
+        match.worldTickAccumulator = TimerWheel::GetWorldTimers().GetTickAccumulator();
+        match.difficulty = (uint8_t)currentDifficulty;
+        match.selectedAvatar = (uint8_t)selectedAvatar;
+        match.selectedMod = (uint8_t)selectedMod;
+        match.isMultiPlayer = isMultiPlayer;
+        match.bossActive = bossActive;
+
+        GameSnapshot::Capture(GetSnapshotWorld(), match, out);
+    }
+
+    bool Game::RestoreSnapshot(const std::vector<uint8_t>& snapshot) {
+        if (!GameSnapshot::IsValid(snapshot)) return false;
+
+        MemoryTagScope memoryTag(MEMORY_GAMEPLAY);
+        snapshotRestores++;
+
+        // Alte Objekte und Ablufe verwerfen, die Tick-Uhren laufen weiter
+        // (Partikel bleiben: Rollbacks im Netzwerk-Modus sollen sie nicht wegwischen)
+        gameplayManager->ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
+        players.clear();
+        ResetGameplayTimers();
+
+        MatchState match;
+        SnapshotWorld world = GetSnapshotWorld();
+        GameSnapshot::Restore(snapshot, world, match);
+
+        gameTime = match.gameTime;
+        backgroundScroll = match.backgroundScroll;
+        currentDifficulty = (Difficulty)match.difficulty;
+        selectedAvatar = (AvatarType)match.selectedAvatar;
+        selectedMod = (ModType)match.selectedMod;
+        isMultiPlayer = match.isMultiPlayer;
+        bossActive = match.bossActive;
+
+        GameRandom::SetState(match.randomState);
+        TimerWheel::GetGameTimers().SetTickAccumulator(match.gameTickAccumulator);
+        TimerWheel::GetWorldTimers().SetTickAccumulator(match.worldTickAccumulator);
+
+        // Ganze Ticks statt Sekunden: der angebrochene Tick steckt schon im Akkumulator
+        if (match.slowMotionTicks > 0) {
+            StartSlowMotion(match.slowMotionTicks);
+        }
+
+        // Spawns mit ihren Rest-Ticks neu einplanen
+        SelectDifficultyPipeline(std::max(match.enemySpawnTicks, 0), std::max(match.bossSpawnTicks, 0));
+        return true;
+    }
+
+    bool Game::ResumeSavedRun() {
+        if (!saveSystem->LoadRunSnapshot(snapshotBuffer)) return false;
+
+        if (!RestoreSnapshot(snapshotBuffer)) {
+            // z.B. Snapshot einer lteren Version
+            Logger::Warning("Gespeicherte Partie ist ungueltig und wird verworfen");
+            saveSystem->ClearRunSnapshot();
+            return false;
+        }
+
+        particles.Clear();
+        rewindHistory.Clear();
+        runRewound = false;
+        gameplayManager->GetEventBus().Publish({ EVENT_RUN_STARTED, -1, 0, 0, { 0, 0 } });
+        currentState = STATE_GAME;
+        Logger::Info("Gespeicherte Partie fortgesetzt (%.0f s gespielt)", gameTime);
+        return true;
+    }
+
+    void Game::ScheduleAutosave() {
+        autosaveTimer = TimerWheel::GetGameTimers().Schedule(GameConfig::AUTOSAVE_INTERVAL, [this]() {
+            Autosave();
+            ScheduleAutosave();
+        });
+    }
+
+    void Game::Autosave() {
+        if (players.empty() || netSession) return;
+
+        CaptureSnapshot(snapshotBuffer);
+        saveSystem->SaveRunSnapshot(snapshotBuffer);
+    }
+
+    // === Gameplay-Pipeline pro Schwierigkeitsgrad ===
+    void Game::SelectDifficultyPipeline(int32_t enemySpawnTicks, int32_t bossSpawnTicks) {
+        // Einzige Auswertung des Schwierigkeitsgrads pro Partie (negative Verzgerung = Profilwert)
+        DispatchDifficulty(currentDifficulty, [this, enemySpawnTicks, bossSpawnTicks](auto profile) {
+            using Profile = decltype(profile);
+            gameplayStep = &Game::StepGameplay<Profile>;
+            ScheduleEnemySpawn<Profile>(enemySpawnTicks >= 0 ? (uint32_t)enemySpawnTicks
+                : TimerWheel::SecondsToTicks(Profile::EnemySpawnInterval()));
+            ScheduleBossSpawn<Profile>(bossSpawnTicks >= 0 ? (uint32_t)bossSpawnTicks
+                : TimerWheel::SecondsToTicks(Profile::VALUES.bossSpawnTime));
+        });
+        if (!netSession) {
+            ScheduleAutosave();
+        }
+    }
+
+    template <typename Profile>
+    void Game::StepGameplay(float deltaTime) {
+        // Fllige Ablufe auslsen (Spawns, PowerUp- und SlowMotion-Ende)
+        TimerWheel::GetGameTimers().Advance(deltaTime);
+
+        // Time Scale fr SlowMotion
+        timeScale = slowMotionActive ? GameConfig::SLOWMOTION_TIME_SCALE : 1.0f;
+
+        float scaledDeltaTime = deltaTime * timeScale;
+        TimerWheel::GetWorldTimers().Advance(scaledDeltaTime);
+        gameTime += deltaTime;
+
+        // Hintergrund scrollen
+        backgroundScroll += Profile::VALUES.backgroundScrollSpeed * deltaTime;
+        if (backgroundScroll >= textureManager.GetBackgroundTexture().height) {
+            backgroundScroll = 0.0f;
+        }
+
+        // Player Input und Updates
+        HandlePlayerInput<Profile>(deltaTime);
+
+        // Gameplay Manager bernimmt komplette Update-Logik
+        gameplayManager->UpdateGameplay<Profile>(players, enemies, bullets, enemyBullets, powerUps, explosions,
+            boss, bossActive, deltaTime, scaledDeltaTime);
+    }
+
+    template <typename Profile>
+    void Game::ScheduleEnemySpawn(uint32_t ticks) {
+        enemySpawnTimer = TimerWheel::GetGameTimers().ScheduleTicks(ticks, [this]() {
+            if (!bossActive) {
+                gameplayManager->SpawnEnemy<Profile>(enemies);
+            }
+            ScheduleEnemySpawn<Profile>(TimerWheel::SecondsToTicks(Profile::EnemySpawnInterval()));
+        });
+    }
+
+    template <typename Profile>
+    void Game::ScheduleBossSpawn(uint32_t ticks) {
+        bossSpawnTimer = TimerWheel::GetGameTimers().ScheduleTicks(ticks, [this]() {
+            if (!bossActive) {
+                gameplayManager->SpawnBoss(boss, bossActive, Profile::DIFFICULTY);
+            }
+            ScheduleBossSpawn<Profile>(TimerWheel::SecondsToTicks(Profile::VALUES.bossSpawnTime));
+        });
+    }
+
+    template <typename Profile>
     void Game::HandlePlayerInput(float deltaTime) {
+        TraceScope trace("Game::HandlePlayerInput");
+
         // Player 1 Input
         if (!players.empty() && players[0]) {
-            auto p1Input = inputManager.GetPlayer1Input();
+            auto p1Input = playerInputs[0];
             bool p1Left = (p1Input == InputManager::PLAYER_LEFT);
             bool p1Right = (p1Input == InputManager::PLAYER_RIGHT);
             bool p1Shoot = (p1Input == InputManager::PLAYER_SHOOT);
 
-            players[0]->HandleInput(p1Left, p1Right, p1Shoot);
-            players[0]->Update(deltaTime, currentDifficulty);
+            players[0]->HandleInput(p1Left, p1Right, p1Shoot, deltaTime);
+            players[0]->Update<Profile>();
         }
 
         // Player 2 Input (Multiplayer)
         if (isMultiPlayer && players.size() > 1 && players[1]) {
-            auto p2Input = inputManager.GetPlayer2Input();
+            auto p2Input = playerInputs[1];
             bool p2Left = (p2Input == InputManager::PLAYER_LEFT);
             bool p2Right = (p2Input == InputManager::PLAYER_RIGHT);
             bool p2Shoot = (p2Input == InputManager::PLAYER_SHOOT);
 
-            players[1]->HandleInput(p2Left, p2Right, p2Shoot);
-            players[1]->Update(deltaTime, currentDifficulty);
+            players[1]->HandleInput(p2Left, p2Right, p2Shoot, deltaTime);
+            players[1]->Update<Profile>();
         }
 
-        // Bullets erstellen (vereinfacht)
-        CreatePlayerBullets();
+        // Bullets erstellen
+        gameplayManager->SpawnPlayerBullets(players, bullets);
     }
 
-    void Game::CreatePlayerBullets() {
-        for (size_t i = 0; i < players.size(); i++) {
-            if (!players[i] || !players[i]->WantsToShoot()) continue;
-
-            Vector2 shootPos = {
-                players[i]->GetPosition().x + Player::AVATAR_WIDTH / 2,
-                players[i]->GetPosition().y
-            };
-
-            float bulletSpeed = 500.0f * players[i]->GetBulletSpeedMultiplier();
-
-            if (players[i]->IsTripleShotActive()) {
-                bullets.push_back(std::make_unique<Bullet>((int)i, shootPos, bulletSpeed, Bullet::TRIPLE_SHOT));
-                bullets.push_back(std::make_unique<Bullet>((int)i, Vector2{ shootPos.x - 30, shootPos.y }, bulletSpeed, Bullet::TRIPLE_SHOT));
-                bullets.push_back(std::make_unique<Bullet>((int)i, Vector2{ shootPos.x + 30, shootPos.y }, bulletSpeed, Bullet::TRIPLE_SHOT));
-            }
-            else {
-                Bullet::BulletType type = players[i]->IsFastFireActive() ? Bullet::FAST_FIRE : Bullet::NORMAL;
-                bullets.push_back(std::make_unique<Bullet>((int)i, shootPos, bulletSpeed, type));
-            }
+    size_t Game::GetGameObjectCount() const {
+        return players.size() + enemies.size() + bullets.size() + enemyBullets.size() +
+            powerUps.size() + explosions.size() + (boss ? 1 : 0);
+    }
 
-            players[i]->ResetShootRequest();
-        }
+    void Game::PublishMetrics() const {
+        MetricsServer& metrics = MetricsServer::GetInstance();
+        metrics.PublishEntityCount(METRICS_PLAYERS, players.size());
+        metrics.PublishEntityCount(METRICS_ENEMIES, enemies.size());
+        metrics.PublishEntityCount(METRICS_BULLETS, bullets.size());
+        metrics.PublishEntityCount(METRICS_ENEMY_BULLETS, enemyBullets.size());
+        metrics.PublishEntityCount(METRICS_POWERUPS, powerUps.size());
+        metrics.PublishEntityCount(METRICS_EXPLOSIONS, explosions.size());
+        metrics.PublishEntityCount(METRICS_BOSSES, boss ? 1 : 0);
+        metrics.PublishEntityCount(METRICS_PARTICLES, particles.GetCount());
+        metrics.PublishGameState(currentState);
     }
 
     // === Render Functions (delegiert an Systeme) ===
     void Game::RenderMainMenu() {
         int currentCoins = saveSystem->LoadCoins();
-        menuSystem->RenderMainMenu(currentCoins);
+        menuSystem->RenderMainMenu(currentCoins, saveSystem->HasRunSnapshot());
     }
 
     void Game::RenderSinglePlayerSetup() {
@@ -514,7 +1096,7 @@ namespace SpaceInvaders {
 
     void Game::RenderGameplay() {
         gameRenderer->RenderGameplay(players, enemies, bullets, enemyBullets, powerUps, explosions,
-            boss, bossActive, slowMotionActive, backgroundScroll,
+            particles, boss, bossActive, slowMotionActive, backgroundScroll,
             currentDifficulty, isMultiPlayer);
     }
 
@@ -16,8 +16,22 @@
 #include "ModManager.h"
 #include "GameRenderer.h"
 #include "GameplayManager.h"
+#include "FrameArena.h"
+#include "TimerWheel.h"
+#include "StatisticsCollector.h"
+#include "Tracer.h"
+#include "FlightRecorder.h"
+#include "MemoryTracker.h"
+#include "MetricsServer.h"
+#include "Logger.h"
+#include "GameSnapshot.h"
+#include "NetSession.h"
+#include "RollbackSession.h"
+#include "ParticleSystem.h"
+#include "AudioMixer.h"
 #include <vector>
 #include <memory>
+#include <chrono>
 
 namespace SpaceInvaders {
 
@@ -44,6 +58,9 @@ namespace SpaceInvaders {
         void Run();
         void Shutdown();
 
+        // === Netzwerk-Partie (Handshake ist bereits erfolgt) ===
+        void StartNetworkMatch(std::unique_ptr<NetSession> session);
+
     private:
         // === Core Update & Render ===
         void Update(float deltaTime);
@@ -52,11 +69,13 @@ namespace SpaceInvaders {
         // === State-spezifische Updates (schlanker) ===
         void UpdateMainMenu(float deltaTime);
         void UpdateSinglePlayerSetup(float deltaTime);
-        void UpdateMultiPlayerSetup(float deltaTime);
+        void UpdateMultiPlayerSetup();
         void UpdateDifficultySelection(float deltaTime);
         void UpdateStatistics(float deltaTime);
         void UpdateRules(float deltaTime);
         void UpdateGameplay(float deltaTime);
+        void UpdateNetworkGameplay();
+        void UpdateParticles(float deltaTime);
         void UpdateGameOver(float deltaTime);
         void UpdatePause(float deltaTime);
 
@@ -74,12 +93,40 @@ namespace SpaceInvaders {
         // === Gameplay-Setup (vereinfacht) ===
         void InitializeSinglePlayer();
         void InitializeMultiPlayer();
-        void HandlePlayerInput(float deltaTime);
-        void CreatePlayerBullets();
+        void FinishRun();
+        void EndNetworkMatch();
+        size_t GetGameObjectCount() const;
+        void PublishMetrics() const;
+
+        // === Zeitgesteuerte Ablufe (TimerWheel) ===
+        void ResetGameplayTimers();
+        void StartSlowMotion(uint32_t ticks);
+
+        // === Gameplay-Pipeline pro Schwierigkeitsgrad (Profile = DifficultyProfile<...>) ===
+        void SelectDifficultyPipeline(int32_t enemySpawnTicks = -1, int32_t bossSpawnTicks = -1);
+        template <typename Profile> void StepGameplay(float deltaTime);
+        template <typename Profile> void HandlePlayerInput(float deltaTime);
+        template <typename Profile> void ScheduleEnemySpawn(uint32_t ticks);
+        template <typename Profile> void ScheduleBossSpawn(uint32_t ticks);
+
+        // === Snapshots (Autosave, Fortsetzen, Rewind) ===
+        SnapshotWorld GetSnapshotWorld();
+        void CaptureSnapshot(std::vector<uint8_t>& out);
+        bool RestoreSnapshot(const std::vector<uint8_t>& snapshot);
+        bool ResumeSavedRun();
+        void ScheduleAutosave();
+        void Autosave();
+
+        // === Event-Bus ===
+        void ConnectEventConsumers();
+        bool IsResimulating() const;  // Rollback rechnet nach: keine Effekte ausloesen
+
+        // === Erst beim ersten Besuch aufgebaute Screens ===
+        bool EnsureSelectionScreens();  // Avatar- und Mod-Auswahl
 
         // === Core Systeme ===
         TextureManager& textureManager;
-        InputManager inputManager;
+        InputManager inputManager;  // einzige Instanz, Snapshot wird an die Subsysteme weitergereicht
         std::unique_ptr<MenuSystem> menuSystem;
         std::unique_ptr<SaveSystem> saveSystem;
         std::unique_ptr<AvatarManager> avatarManager;
@@ -87,18 +134,36 @@ namespace SpaceInvaders {
         std::unique_ptr<GameRenderer> gameRenderer;
         std::unique_ptr<GameplayManager> gameplayManager;
 
+        // === Hintergrund-Konsumenten des Event-Bus ===
+        StatisticsCollector statisticsCollector;
+
         // === Game State ===
         GameState currentState;
         GameState previousState;
         Difficulty currentDifficulty;
+        void (Game::*gameplayStep)(float deltaTime);  // beim Partiestart gewaehlt
         bool isMultiPlayer;
         bool gameInitialized;
+        std::chrono::steady_clock::time_point startupBegin;  // fuer Zeit bis zum ersten Frame
+        InputManager::PlayerInput playerInputs[2];  // Eingaben des aktuellen Simulations-Frames
 
         // === Timing ===
         float gameTime;
-        float enemySpawnTimer;
+        TimerWheel::Handle enemySpawnTimer;
         float backgroundScroll;
-        float bossSpawnTimer;
+        TimerWheel::Handle bossSpawnTimer;
+        TimerWheel::Handle autosaveTimer;
+
+        // === Snapshots ===
+        SnapshotHistory rewindHistory;
+        std::vector<uint8_t> snapshotBuffer;
+        bool runRewound;  // Statistiken der Partie stammen teils aus verworfenen Zeitlinien
+        size_t snapshotRestores;  // baut alle Objekte neu auf (fuer den Allokations-Check)
+
+        // === Netzwerk-Partie (nullptr = lokal) ===
+        std::unique_ptr<NetSession> netSession;
+        std::unique_ptr<RollbackSession> rollbackSession;
+        uint32_t netGameOverFrame;
 
         // === Players (vereinfacht zu Vector) ===
         std::vector<std::unique_ptr<Player>> players;
@@ -110,13 +175,16 @@ namespace SpaceInvaders {
         std::vector<std::unique_ptr<PowerUp>> powerUps;
         std::vector<Explosion> explosions;
 
+        // === Partikel (nur Darstellung, nicht im Snapshot) ===
+        ParticleSystem particles;
+
         // === Boss System ===
         std::unique_ptr<Boss> boss;
         bool bossActive;
 
         // === PowerUp System ===
         bool slowMotionActive;
-        float slowMotionTimer;
+        TimerWheel::Handle slowMotionTimer;
         float timeScale;
 
         // === SinglePlayer Setup State ===
@@ -1,87 +1,72 @@
 #include "GameConfig.h"
+#include "DifficultyProfile.h"
 
 namespace SpaceInvaders {
 
+    namespace {
+        // Jeder Simulations-Thread des Balance-Sweeps spielt mit eigenen Werten
+        thread_local const GameConfig::BalanceParameters* balanceOverride = nullptr;
+    } // namespace
+
     // === Schwierigkeitsgrad-abhngige Werte ===
-    float GameConfig::GetEnemySpawnInterval(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return ENEMY_SPAWN_INTERVAL_EASY;
-        case DIFF_MEDIUM: return ENEMY_SPAWN_INTERVAL_MEDIUM;
-        case DIFF_HARD:   return ENEMY_SPAWN_INTERVAL_HARD;
-        default:          return ENEMY_SPAWN_INTERVAL_MEDIUM;
+    namespace {
+        const DifficultyValues& ValuesFor(Difficulty diff) {
+            return DIFFICULTY_VALUES[(diff >= DIFF_EASY && diff <= DIFF_HARD) ? diff : DIFF_MEDIUM];
         }
+    } // namespace
+
+    float GameConfig::GetEnemySpawnInterval(Difficulty diff) {
+        if (balanceOverride) return balanceOverride->enemySpawnInterval;
+        return ValuesFor(diff).enemySpawnInterval;
     }
 
     float GameConfig::GetEnemySpeed(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return ENEMY_SPEED_EASY;
-        case DIFF_MEDIUM: return ENEMY_SPEED_MEDIUM;
-        case DIFF_HARD:   return ENEMY_SPEED_HARD;
-        default:          return ENEMY_SPEED_MEDIUM;
-        }
+        return ValuesFor(diff).enemySpeed;
     }
 
     float GameConfig::GetEnemyShootCooldown(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return ENEMY_SHOOT_COOLDOWN_EASY;
-        case DIFF_MEDIUM: return ENEMY_SHOOT_COOLDOWN_MEDIUM;
-        case DIFF_HARD:   return ENEMY_SHOOT_COOLDOWN_HARD;
-        default:          return ENEMY_SHOOT_COOLDOWN_MEDIUM;
-        }
+        if (balanceOverride) return balanceOverride->enemyShootCooldown;
+        return ValuesFor(diff).enemyShootCooldown;
     }
 
     float GameConfig::GetEnemyBulletSpeed(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return ENEMY_BULLET_SPEED_EASY;
-        case DIFF_MEDIUM: return ENEMY_BULLET_SPEED_MEDIUM;
-        case DIFF_HARD:   return ENEMY_BULLET_SPEED_HARD;
-        default:          return ENEMY_BULLET_SPEED_MEDIUM;
-        }
+        return ValuesFor(diff).enemyBulletSpeed;
     }
 
     float GameConfig::GetBackgroundScrollSpeed(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return BACKGROUND_SCROLL_SPEED_EASY;
-        case DIFF_MEDIUM: return BACKGROUND_SCROLL_SPEED_MEDIUM;
-        case DIFF_HARD:   return BACKGROUND_SCROLL_SPEED_HARD;
-        default:          return BACKGROUND_SCROLL_SPEED_MEDIUM;
-        }
+        return ValuesFor(diff).backgroundScrollSpeed;
     }
 
     float GameConfig::GetPlayerShootCooldown(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return PLAYER_SHOOT_COOLDOWN_EASY;
-        case DIFF_MEDIUM: return PLAYER_SHOOT_COOLDOWN_MEDIUM;
-        case DIFF_HARD:   return PLAYER_SHOOT_COOLDOWN_HARD;
-        default:          return PLAYER_SHOOT_COOLDOWN_MEDIUM;
-        }
+        return ValuesFor(diff).playerShootCooldown;
     }
 
     float GameConfig::GetPlayerMovementSpeed(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return PLAYER_MOVEMENT_SPEED_EASY;
-        case DIFF_MEDIUM: return PLAYER_MOVEMENT_SPEED_MEDIUM;
-        case DIFF_HARD:   return PLAYER_MOVEMENT_SPEED_HARD;
-        default:          return PLAYER_MOVEMENT_SPEED_MEDIUM;
-        }
+        return ValuesFor(diff).playerMovementSpeed;
     }
 
     float GameConfig::GetPowerUpDropChance(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return POWERUP_DROP_CHANCE_EASY;
-        case DIFF_MEDIUM: return POWERUP_DROP_CHANCE_MEDIUM;
-        case DIFF_HARD:   return POWERUP_DROP_CHANCE_HARD;
-        default:          return POWERUP_DROP_CHANCE_MEDIUM;
-        }
+        if (balanceOverride) return balanceOverride->powerUpDropChance;
+        return ValuesFor(diff).powerUpDropChance;
     }
 
     float GameConfig::GetBossSpawnTime(Difficulty diff) {
-        switch (diff) {
-        case DIFF_EASY:   return BOSS_SPAWN_TIME_EASY;
-        case DIFF_MEDIUM: return BOSS_SPAWN_TIME_MEDIUM;
-        case DIFF_HARD:   return BOSS_SPAWN_TIME_HARD;
-        default:          return BOSS_SPAWN_TIME_MEDIUM;
-        }
+        return ValuesFor(diff).bossSpawnTime;
+    }
+
+    // === Balancing-Overrides ===
+    GameConfig::BalanceParameters GameConfig::GetDefaultBalance(Difficulty diff) {
+        // Immer die Konstanten, auch wenn auf diesem Thread ein Override aktiv ist
+        const DifficultyValues& values = ValuesFor(diff);
+        return { values.enemySpawnInterval, values.enemyShootCooldown, values.powerUpDropChance };
+    }
+
+    void GameConfig::SetBalanceOverride(const BalanceParameters* parameters) {
+        balanceOverride = parameters;
+    }
+
+    const GameConfig::BalanceParameters* GameConfig::GetBalanceOverride() {
+        return balanceOverride;
     }
 
 } // namespace SpaceInvaders
\ No newline at end of file
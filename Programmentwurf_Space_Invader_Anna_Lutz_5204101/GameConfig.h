@@ -34,7 +34,9 @@ namespace SpaceInvaders {
         POWERUP_NONE,
         POWERUP_SHIELD,
         POWERUP_TRIPLESHOT,
-        POWERUP_SLOWMO
+        POWERUP_SLOWMO,
+        POWERUP_HOMING,
+        POWERUP_LASER
     };
 
     // === Game States ===
@@ -52,10 +54,70 @@ namespace SpaceInvaders {
 
     // === Zentrale Spiel-Konfiguration ===
     struct GameConfig {
+        /**
+         * @brief Balancing-Werte eines Schwierigkeitsgrads, die der Balance-Sweep variiert
+         */
+        struct BalanceParameters {
+            float enemySpawnInterval;
+            float enemyShootCooldown;
+            float powerUpDropChance;
+        };
+
         // === Bildschirm ===
         static const int SCREEN_WIDTH = 1280;
         static const int SCREEN_HEIGHT = 800;
         static const int TARGET_FPS = 60;
+        static const int SIMULATION_TICK_RATE = 60; // Ticks pro Sekunde fuer das TimerWheel
+        static const bool FIXED_POINT_SIMULATION = true; // Q16.16 statt float fuer Positionen & Geschwindigkeiten (bit-exakt)
+
+        // === Flight Recorder ===
+        static inline const float FRAME_BUDGET_MS = 33.3f;        // Laengere Frames loesen einen Dump aus
+        static inline const float FLIGHT_RECORDER_SECONDS = 30.0f; // So weit reicht ein Dump zurueck
+        static inline const char* FLIGHT_RECORDER_FOLDER = "flightrecorder/";
+
+        // === Speicher-Diagnose ===
+        static inline const char* MEMORY_REPORT_FILE = "memory_report.txt"; // F4 im Spiel
+
+        // === Logging ===
+        static inline const float LOG_DEDUP_SECONDS = 5.0f; // Gleiche Meldung hoechstens so oft
+        static const int LOG_RATE_LIMIT = 50;               // Meldungen pro Sekunde und Thread
+
+        // === Metrik-Endpunkt (nur 127.0.0.1) ===
+        static const bool METRICS_ENABLED = true;
+        static const int METRICS_PORT = 9464;
+
+        // === Snapshots (Autosave & Rewind) ===
+        static inline const float AUTOSAVE_INTERVAL = 15.0f;   // Sekunden zwischen Autosaves einer Partie
+#ifdef _DEBUG
+        static const bool REWIND_ENABLED = true;              // F9 im Spiel (nur Debug-Builds)
+#else
+        static const bool REWIND_ENABLED = false;
+#endif
+        static const int REWIND_HISTORY_FRAMES = 600;          // ca. 10 s bei 60 FPS
+        static const int REWIND_KEYFRAME_INTERVAL = 60;        // Frames pro Keyframe
+        static const int REWIND_FRAMES = 180;                  // So weit springt F9 zurueck
+
+        // === Netzwerk-Modus (Rollback, UDP) ===
+        static const int NET_DEFAULT_PORT = 7777;
+        static const int NET_INPUT_DELAY = 2;                  // Frames bis eine lokale Eingabe wirkt
+        static const int NET_MAX_ROLLBACK_FRAMES = 8;          // Weiter wird nicht vorhergesagt (sonst Warten)
+        static const int NET_CHECKSUM_INTERVAL = 30;           // Frames zwischen Desync-Pruefungen
+        static inline const float NET_CONNECT_TIMEOUT = 30.0f; // Sekunden Warten auf die Gegenseite
+        static inline const float NET_DISCONNECT_TIMEOUT = 5.0f;
+
+        // === Audio ===
+        static const bool AUDIO_ENABLED = true;               // false = Null-Device (mischt ohne Ausgabe)
+        static const int AUDIO_SAMPLE_RATE = 44100;
+        static const int AUDIO_BUFFER_FRAMES = 512;           // ca. 12 ms pro Geraetepuffer
+        static const int AUDIO_VOICE_COUNT = 32;              // Stimmen im Pool, danach wird verdraengt
+        static inline const float AUDIO_MASTER_VOLUME = 0.8f;
+        static inline const float AUDIO_MUSIC_VOLUME = 0.5f;
+        static inline const char* AUDIO_FOLDER = "sounds/";
+        static inline const char* AUDIO_MUSIC_FILE = "sounds/music.wav"; // 16-Bit-PCM mit AUDIO_SAMPLE_RATE
+
+        // === Texturen ===
+        // true = 16-Bit GPU-Formate (R5G6B5 / R4G4B4A4) statt RGBA8, halbiert den VRAM-Bedarf
+        static const bool TEXTURE_COMPACT_FORMATS = false;
 
         // === Avatar Kosten ===
         static const int AVATAR_COST = 30;
@@ -69,54 +131,66 @@ namespace SpaceInvaders {
 
         // === PowerUp Dauer ===
         static inline const float POWERUP_DURATION = 5.0f;
+        static inline const float SLOWMOTION_TIME_SCALE = 0.4f;
 
         // === Boss ===
-        static inline const float BOSS_SPAWN_TIME_EASY = 90.0f;
-        static inline const float BOSS_SPAWN_TIME_MEDIUM = 75.0f;
-        static inline const float BOSS_SPAWN_TIME_HARD = 60.0f;
+        static constexpr float BOSS_SPAWN_TIME_EASY = 90.0f;
+        static constexpr float BOSS_SPAWN_TIME_MEDIUM = 75.0f;
+        static constexpr float BOSS_SPAWN_TIME_HARD = 60.0f;
+
+        // === Schwierigkeitsgrad-spezifische Werte (constexpr fuer DifficultyProfile) ===
+        static constexpr float ENEMY_SPAWN_INTERVAL_EASY = 1.8f;
+        static constexpr float ENEMY_SPAWN_INTERVAL_MEDIUM = 1.2f;
+        static constexpr float ENEMY_SPAWN_INTERVAL_HARD = 0.8f;
 
-        // === Schwierigkeitsgrad-spezifische Werte - FIXED: als inline ===
-        static inline const float ENEMY_SPAWN_INTERVAL_EASY = 1.8f;
-        static inline const float ENEMY_SPAWN_INTERVAL_MEDIUM = 1.2f;
-        static inline const float ENEMY_SPAWN_INTERVAL_HARD = 0.8f;
+        static constexpr float ENEMY_SPEED_EASY = 120.0f;
+        static constexpr float ENEMY_SPEED_MEDIUM = 180.0f;
+        static constexpr float ENEMY_SPEED_HARD = 240.0f;
 
-        static inline const float ENEMY_SPEED_EASY = 120.0f;
-        static inline const float ENEMY_SPEED_MEDIUM = 180.0f;
-        static inline const float ENEMY_SPEED_HARD = 240.0f;
+        static constexpr float ENEMY_SHOOT_COOLDOWN_EASY = 2.5f;
+        static constexpr float ENEMY_SHOOT_COOLDOWN_MEDIUM = 1.8f;
+        static constexpr float ENEMY_SHOOT_COOLDOWN_HARD = 1.2f;
 
-        static inline const float ENEMY_SHOOT_COOLDOWN_EASY = 2.5f;
-        static inline const float ENEMY_SHOOT_COOLDOWN_MEDIUM = 1.8f;
-        static inline const float ENEMY_SHOOT_COOLDOWN_HARD = 1.2f;
+        static constexpr float ENEMY_BULLET_SPEED_EASY = 200.0f;
+        static constexpr float ENEMY_BULLET_SPEED_MEDIUM = 280.0f;
+        static constexpr float ENEMY_BULLET_SPEED_HARD = 360.0f;
 
-        static inline const float ENEMY_BULLET_SPEED_EASY = 200.0f;
-        static inline const float ENEMY_BULLET_SPEED_MEDIUM = 280.0f;
-        static inline const float ENEMY_BULLET_SPEED_HARD = 360.0f;
+        static constexpr float BACKGROUND_SCROLL_SPEED_EASY = 80.0f;
+        static constexpr float BACKGROUND_SCROLL_SPEED_MEDIUM = 120.0f;
+        static constexpr float BACKGROUND_SCROLL_SPEED_HARD = 160.0f;
 
-        static inline const float BACKGROUND_SCROLL_SPEED_EASY = 80.0f;
-        static inline const float BACKGROUND_SCROLL_SPEED_MEDIUM = 120.0f;
-        static inline const float BACKGROUND_SCROLL_SPEED_HARD = 160.0f;
+        static constexpr float PLAYER_SHOOT_COOLDOWN_EASY = 0.35f;
+        static constexpr float PLAYER_SHOOT_COOLDOWN_MEDIUM = 0.30f;
+        static constexpr float PLAYER_SHOOT_COOLDOWN_HARD = 0.25f;
 
-        static inline const float PLAYER_SHOOT_COOLDOWN_EASY = 0.35f;
-        static inline const float PLAYER_SHOOT_COOLDOWN_MEDIUM = 0.30f;
-        static inline const float PLAYER_SHOOT_COOLDOWN_HARD = 0.25f;
+        static constexpr float PLAYER_MOVEMENT_SPEED_EASY = 280.0f;
+        static constexpr float PLAYER_MOVEMENT_SPEED_MEDIUM = 320.0f;
+        static constexpr float PLAYER_MOVEMENT_SPEED_HARD = 360.0f;
 
-        static inline const float PLAYER_MOVEMENT_SPEED_EASY = 280.0f;
-        static inline const float PLAYER_MOVEMENT_SPEED_MEDIUM = 320.0f;
-        static inline const float PLAYER_MOVEMENT_SPEED_HARD = 360.0f;
+        static constexpr float POWERUP_DROP_CHANCE_EASY = 0.15f;
+        static constexpr float POWERUP_DROP_CHANCE_MEDIUM = 0.12f;
+        static constexpr float POWERUP_DROP_CHANCE_HARD = 0.08f;
 
-        static inline const float POWERUP_DROP_CHANCE_EASY = 0.15f;
-        static inline const float POWERUP_DROP_CHANCE_MEDIUM = 0.12f;
-        static inline const float POWERUP_DROP_CHANCE_HARD = 0.08f;
+        // Spieler-Schuesse zerstoeren entgegenkommende Gegner-Schuesse
+        static constexpr bool BULLET_CANCELLATION_EASY = true;
+        static constexpr bool BULLET_CANCELLATION_MEDIUM = true;
+        static constexpr bool BULLET_CANCELLATION_HARD = false;
 
         // === Datei-Pfade ===
         static inline const char* SAVE_FOLDER = "save/";
+        static inline const char* SAVE_CONTAINER_FILE = "save/savegame.bin";
+        static inline const char* RUN_HISTORY_FOLDER = "save/runs/";  // Spaltendateien der Run-Historie
+        static const int STATISTICS_HISTORY_DAYS = 30;                // Zeitraum der Avatar-Auswertung im Statistik-Screen
+
+        // === Alte Textdateien (nur noch fuer die einmalige Migration) ===
         static inline const char* HIGHSCORE_FILE = "save/highscores.txt";
         static inline const char* COINS_FILE = "save/coins.txt";
         static inline const char* STATISTICS_FILE = "save/statistics.txt";
         static inline const char* AVATAR_UNLOCKS_FILE = "save/avatar_unlocks.txt";
         static inline const char* MOD_UNLOCKS_FILE = "save/mod_unlocks.txt";
+        static inline const char* MULTIPLAYER_BESTSCORE_FILE = "save/bestscore_multiplayer.txt";
 
-        // === Hilfsfunktionen ===
+        // === Hilfsfunktionen (Laufzeit-Lookup, Gameplay nutzt DifficultyProfile) ===
         static float GetEnemySpawnInterval(Difficulty diff);
         static float GetEnemySpeed(Difficulty diff);
         static float GetEnemyShootCooldown(Difficulty diff);
@@ -126,6 +200,11 @@ namespace SpaceInvaders {
         static float GetPlayerMovementSpeed(Difficulty diff);
         static float GetPowerUpDropChance(Difficulty diff);
         static float GetBossSpawnTime(Difficulty diff);
+
+        // === Balancing-Overrides (pro Thread, nullptr = Konstanten oben) ===
+        static BalanceParameters GetDefaultBalance(Difficulty diff);
+        static void SetBalanceOverride(const BalanceParameters* parameters);
+        static const BalanceParameters* GetBalanceOverride();
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
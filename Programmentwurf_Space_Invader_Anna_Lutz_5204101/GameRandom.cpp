@@ -0,0 +1,53 @@
+#include "GameRandom.h"
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // Zustand des aktuellen Threads (nie 0, sonst bleibt xorshift bei 0 stehen)
+        thread_local uint64_t randomState = 0x9E3779B97F4A7C15ull;
+
+        uint64_t MixSeed(uint64_t seed) {
+            // SplitMix64, verteilt auch kleine Seeds (0, 1, 2, ...) gut
+            seed += 0x9E3779B97F4A7C15ull;
+            seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+            seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+            return seed ^ (seed >> 31);
+        }
+
+    } // namespace
+
+    // === Zustand ===
+    void GameRandom::Seed(uint64_t seed) {
+        SetState(MixSeed(seed));
+    }
+
+    uint64_t GameRandom::GetState() {
+        return randomState;
+    }
+
+    void GameRandom::SetState(uint64_t state) {
+        randomState = state != 0 ? state : 0x9E3779B97F4A7C15ull;
+    }
+
+    // === Zahlen ===
+    uint32_t GameRandom::Next() {
+        randomState ^= randomState >> 12;
+        randomState ^= randomState << 25;
+        randomState ^= randomState >> 27;
+        return (uint32_t)((randomState * 0x2545F4914F6CDD1Dull) >> 32);
+    }
+
+    int GameRandom::NextInt(int bound) {
+        if (bound <= 0) return 0;
+
+        // Multiplikation statt Modulo: gleichverteilt genug und ohne Division
+        return (int)(((uint64_t)Next() * (uint32_t)bound) >> 32);
+    }
+
+    float GameRandom::NextFloat() {
+        // Obere 24 Bit passen exakt in die Mantisse
+        return (float)(Next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Deterministischer Zufallsgenerator der Simulation (xorshift64*)
+     *
+     * Ersetzt rand() im Gameplay: der Zustand ist ein einzelner 64-Bit-Wert,
+     * der mit jedem Snapshot gesichert und wiederhergestellt wird. Damit
+     * laufen Rewind, Rollback-Netcode und Balance-Sweep reproduzierbar.
+     *
+     * Eine Instanz pro Thread (wie TimerWheel), parallele kopflose Partien
+     * beeinflussen sich also nicht gegenseitig. Rein kosmetische Effekte
+     * (z.B. Boss-Wackeln beim Rendern) duerfen weiter rand() verwenden.
+     */
+    class GameRandom {
+    public:
+        // === Zustand ===
+        static void Seed(uint64_t seed);
+        static uint64_t GetState();
+        static void SetState(uint64_t state);
+
+        // === Zahlen ===
+        static uint32_t Next();
+        static int NextInt(int bound);  // [0, bound)
+        static float NextFloat();       // [0, 1)
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -5,6 +5,10 @@
 #include "Bullet.h"
 #include "EnemyBullet.h"
 #include "PowerUp.h"
+#include "ParticleSystem.h"
+#include "FrameArena.h"
+#include "Tracer.h"
+#include "MemoryTracker.h"
 
 namespace SpaceInvaders {
 
@@ -18,7 +22,8 @@ namespace SpaceInvaders {
 
     // === Konstruktor ===
     GameRenderer::GameRenderer()
-        : textureManager(TextureManager::GetInstance()) {
+        : textureManager(TextureManager::GetInstance())
+        , memoryOverlayVisible(false) {
     }
 
     // === Haupt-Rendering ===
@@ -29,6 +34,7 @@ namespace SpaceInvaders {
         const std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
         const std::vector<std::unique_ptr<PowerUp>>& powerUps,
         const std::vector<Explosion>& explosions,
+        const ParticleSystem& particles,
         const std::unique_ptr<Boss>& boss,
         bool bossActive,
         bool slowMotionActive,
@@ -36,65 +42,93 @@ namespace SpaceInvaders {
         Difficulty currentDifficulty,
         bool isMultiPlayer) {
 
+        TraceScope trace("GameRenderer::RenderGameplay");
+
         BeginDrawing();
         ClearBackground(BLACK);
 
         // Hintergrund
-        RenderBackground(backgroundScroll);
+        {
+            TraceScope pass("Render: Hintergrund");
+            RenderBackground(backgroundScroll);
+        }
 
         // Players
-        for (const auto& player : players) {
-            if (player) {
-                player->Render();
-                player->RenderShield();
+        {
+            TraceScope pass("Render: Spieler");
+            for (const auto& player : players) {
+                if (player) {
+                    player->Render();
+                    player->RenderShield();
+                }
             }
         }
 
         // Boss (falls aktiv)
         if (bossActive && boss) {
+            TraceScope pass("Render: Boss");
             boss->Render();
             boss->RenderHealthBar();
             RenderBossUI();
         }
 
-        // Bullets
-        for (const auto& bullet : bullets) {
-            bullet->Render();
-        }
+        // Bullets, Enemies, Enemy Bullets, PowerUps
+        {
+            TraceScope pass("Render: Objekte");
+            for (const auto& bullet : bullets) {
+                bullet->Render();
+            }
 
-        // Enemies (nur wenn kein Boss)
-        if (!bossActive) {
-            for (const auto& enemy : enemies) {
-                enemy->Render();
+            // Enemies (nur wenn kein Boss)
+            if (!bossActive) {
+                for (const auto& enemy : enemies) {
+                    enemy->Render();
+                }
             }
-        }
 
-        // Enemy Bullets
-        for (const auto& enemyBullet : enemyBullets) {
-            enemyBullet->Render();
-        }
+            for (const auto& enemyBullet : enemyBullets) {
+                enemyBullet->Render();
+            }
 
-        // PowerUps
-        for (const auto& powerUp : powerUps) {
-            powerUp->Render();
+            for (const auto& powerUp : powerUps) {
+                powerUp->Render();
+            }
         }
 
         // Explosionen
-        RenderExplosions(explosions);
+        {
+            TraceScope pass("Render: Explosionen");
+            RenderExplosions(explosions);
+        }
 
-        // SlowMotion Effekt
-        if (slowMotionActive) {
-            RenderSlowMotionEffect();
+        // Partikel (additiv, ein Batch)
+        {
+            TraceScope pass("Render: Partikel");
+            particles.Render();
         }
 
-        // UI
-        RenderUI(players, isMultiPlayer, currentDifficulty);
+        // SlowMotion Effekt, UI und PowerUp Indikatoren
+        {
+            TraceScope pass("Render: UI");
+            if (slowMotionActive) {
+                RenderSlowMotionEffect();
+            }
+
+            RenderUI(players, isMultiPlayer, currentDifficulty);
 
-        // PowerUp Indikatoren
-        float slowMotionTimer = 0.0f; // TODO: Von Game bergeben lassen
-        RenderPowerUpIndicators(players, isMultiPlayer, slowMotionActive, slowMotionTimer);
+            float slowMotionTimer = 0.0f; // TODO: Von Game bergeben lassen
+            RenderPowerUpIndicators(players, isMultiPlayer, slowMotionActive, slowMotionTimer);
 
-        EndDrawing();
+            if (memoryOverlayVisible) {
+                RenderMemoryOverlay();
+            }
+        }
+
+        // Buffer-Tausch inkl. VSync-Wartezeit
+        {
+            TraceScope pass("Render: EndDrawing");
+            EndDrawing();
+        }
     }
 
     // === UI-Komponenten ===
@@ -126,8 +160,8 @@ namespace SpaceInvaders {
             DrawText(p2ScoreText, GameConfig::SCREEN_WIDTH - textWidth - 20, 20, 24, SKYBLUE);
         }
 
-        // Schwierigkeitsgrad
-        std::string diffText = "Schwierigkeit: ";
+        // Schwierigkeitsgrad (Text auf der Frame-Arena, kein Heap pro Frame)
+        FrameString diffText("Schwierigkeit: ", FrameArena::GetInstance().GetResource());
         switch (difficulty) {
         case DIFF_EASY: diffText += "Leicht"; break;
         case DIFF_MEDIUM: diffText += "Mittel"; break;
@@ -209,7 +243,8 @@ namespace SpaceInvaders {
         float progress,
         Vector2 position,
         int size,
-        Color ringColor) {
+        Color ringColor,
+        const char* label) {
 
         // Hintergrund-Kreis
         DrawCircleV(position, size / 2.0f, Fade(DARKGRAY, 0.5f));
@@ -218,6 +253,13 @@ namespace SpaceInvaders {
         DrawRing(position, size / 2.0f - 5, size / 2.0f,
             -90.0f, -90.0f + 360.0f * progress, 60, ringColor);
 
+        if (label) {
+            int fontSize = size / 2;
+            DrawText(label, (int)(position.x - MeasureText(label, fontSize) / 2.0f),
+                (int)(position.y - fontSize / 2.0f), fontSize, ringColor);
+            return;
+        }
+
         // Icon
         auto iconTexture = textureManager.GetModIconTexture(modType);
         TextureManager::DrawTextureScaled(iconTexture,
@@ -286,6 +328,42 @@ namespace SpaceInvaders {
 
             currentY += spacing;
         }
+
+        // Homing Indikator
+        if (player->IsHomingActive()) {
+            float remaining = player->GetHomingTimer();
+            float total = GameConfig::POWERUP_DURATION;
+            float progress = 1.0f - (remaining / total);
+
+            RenderSinglePowerUpIndicator(
+                MOD_NONE,
+                progress,
+                { startX + indicatorSize / 2.0f, currentY + indicatorSize / 2.0f },
+                indicatorSize,
+                LIME,
+                "H"
+            );
+
+            currentY += spacing;
+        }
+
+        // Laser Indikator
+        if (player->IsLaserActive()) {
+            float remaining = player->GetLaserTimer();
+            float total = GameConfig::POWERUP_DURATION;
+            float progress = 1.0f - (remaining / total);
+
+            RenderSinglePowerUpIndicator(
+                MOD_NONE,
+                progress,
+                { startX + indicatorSize / 2.0f, currentY + indicatorSize / 2.0f },
+                indicatorSize,
+                RED,
+                "L"
+            );
+
+            currentY += spacing;
+        }
     }
 
     void GameRenderer::RenderSlowMotionEffect() {
@@ -320,4 +398,41 @@ namespace SpaceInvaders {
         DrawText(bossText, (GameConfig::SCREEN_WIDTH - bossTextWidth) / 2, 100, 30, YELLOW);
     }
 
+    // === Speicher-Overlay ===
+    void GameRenderer::ToggleMemoryOverlay() {
+        memoryOverlayVisible = !memoryOverlayVisible;
+    }
+
+    bool GameRenderer::IsMemoryOverlayVisible() const {
+        return memoryOverlayVisible;
+    }
+
+    void GameRenderer::RenderMemoryOverlay() {
+        int x = 10;
+        int y = 120;
+        int lineHeight = 18;
+
+        DrawRectangle(x - 5, y - 5, 420, lineHeight * (MEMORY_TAG_COUNT + 4) + 10, Fade(BLACK, 0.7f));
+        DrawText("SPEICHER (live KiB / peak KiB / allok. pro Frame)", x, y, 14, YELLOW);
+        y += lineHeight + 4;
+
+        // TextFormat nutzt raylibs statische Puffer, kein Heap
+        for (int tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+            MemoryTagStats stats = MemoryTracker::GetStats((MemoryTag)tag);
+            Color color = stats.frameAllocations > 0 ? ORANGE : WHITE;
+            DrawText(MemoryTracker::GetTagName((MemoryTag)tag), x, y, 14, color);
+            DrawText(TextFormat("%.1f / %.1f / %d", stats.liveBytes / 1024.0f, stats.peakBytes / 1024.0f,
+                (int)stats.frameAllocations), x + 110, y, 14, color);
+            y += lineHeight;
+        }
+
+        DrawText(TextFormat("Heap gesamt: %.1f KiB (peak %.1f KiB)",
+            MemoryTracker::GetLiveBytes() / 1024.0f, MemoryTracker::GetPeakBytes() / 1024.0f), x, y, 14, GREEN);
+        y += lineHeight;
+        DrawText(TextFormat("Texturen VRAM (geschaetzt): %.1f KiB",
+            textureManager.GetTotalVideoMemory() / 1024.0f), x, y, 14, SKYBLUE);
+        y += lineHeight;
+        DrawText("F4: Bericht speichern", x, y, 14, GRAY);
+    }
+
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace SpaceInvaders {
     class EnemyBullet;
     class Enemy;
     class PowerUp;
+    class ParticleSystem;
     struct Explosion;
 
     /**
@@ -38,6 +39,7 @@ namespace SpaceInvaders {
             const std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
             const std::vector<std::unique_ptr<PowerUp>>& powerUps,
             const std::vector<Explosion>& explosions,
+            const ParticleSystem& particles,
             const std::unique_ptr<Boss>& boss,
             bool bossActive,
             bool slowMotionActive,
@@ -58,8 +60,13 @@ namespace SpaceInvaders {
         // === Coin-Display (berall verwendbar) ===
         void RenderCoinsDisplay(int coins, int x, int y, int fontSize = 30);
 
+        // === Speicher-Overlay (F3) ===
+        void ToggleMemoryOverlay();
+        bool IsMemoryOverlayVisible() const;
+
     private:
         TextureManager& textureManager;
+        bool memoryOverlayVisible;
 
         // === PowerUp-Indikator Hilfsfunktionen (DRY-Prinzip) ===
         void RenderSinglePowerUpIndicator(
@@ -67,7 +74,8 @@ namespace SpaceInvaders {
             float progress,
             Vector2 position,
             int size,
-            Color ringColor
+            Color ringColor,
+            const char* label = nullptr  // statt Icon, fuer PowerUps ohne Mod-Textur
         );
 
         void RenderPlayerPowerUpIndicators(
@@ -84,6 +92,9 @@ namespace SpaceInvaders {
 
         // === Boss-spezifisch ===
         void RenderBossUI();
+
+        // === Diagnose ===
+        void RenderMemoryOverlay();
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,421 @@
+#include "GameSnapshot.h"
+#include "MemoryTracker.h"
+#include "SaveContainer.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // === Sektionen in fester Reihenfolge ===
+        enum SnapshotSectionId {
+            SNAPSHOT_MATCH,
+            SNAPSHOT_PLAYERS,
+            SNAPSHOT_ENEMIES,
+            SNAPSHOT_BULLETS,
+            SNAPSHOT_ENEMY_BULLETS,
+            SNAPSHOT_POWERUPS,
+            SNAPSHOT_EXPLOSIONS,
+            SNAPSHOT_BOSS,
+            SNAPSHOT_SECTION_COUNT
+        };
+
+        struct SnapshotSection {
+            uint32_t offset;
+            uint32_t count;
+            uint32_t recordSize;
+        };
+
+        struct SnapshotHeader {
+            uint32_t magic;
+            uint16_t version;
+            uint16_t headerSize;
+            uint32_t sequence;
+            uint32_t totalSize;
+            SnapshotSection sections[SNAPSHOT_SECTION_COUNT];
+        };
+
+        struct DeltaHeader {
+            uint32_t magic;
+            uint16_t version;
+            uint16_t reserved;
+            uint32_t keyframeSequence;
+            uint32_t targetSize;
+            uint32_t runCount;
+        };
+
+        struct DeltaRun {
+            uint32_t offset;
+            uint32_t length;
+        };
+
+        static_assert(std::is_trivially_copyable<Player::State>::value, "Snapshot-States muessen POD sein");
+        static_assert(std::is_trivially_copyable<Enemy::State>::value, "Snapshot-States muessen POD sein");
+        static_assert(std::is_trivially_copyable<Bullet::State>::value, "Snapshot-States muessen POD sein");
+        static_assert(std::is_trivially_copyable<EnemyBullet::State>::value, "Snapshot-States muessen POD sein");
+        static_assert(std::is_trivially_copyable<PowerUp::State>::value, "Snapshot-States muessen POD sein");
+        static_assert(std::is_trivially_copyable<Boss::State>::value, "Snapshot-States muessen POD sein");
+        static_assert(std::is_trivially_copyable<Explosion>::value, "Snapshot-States muessen POD sein");
+
+        std::atomic<uint32_t> nextSequence{ 1 };
+
+        size_t AlignUp(size_t value) {
+            return (value + 7) & ~(size_t)7;
+        }
+
+        // Reserviert eine Sektion und gibt ihren Offset zurueck
+        size_t Reserve(SnapshotHeader& header, SnapshotSectionId id, size_t& cursor, size_t count, size_t recordSize) {
+            size_t offset = AlignUp(cursor);
+            header.sections[id] = { (uint32_t)offset, (uint32_t)count, (uint32_t)recordSize };
+            cursor = offset + count * recordSize;
+            return offset;
+        }
+
+        template <typename Entity>
+        void WriteEntities(uint8_t* base, size_t offset, const std::vector<std::unique_ptr<Entity>>& entities) {
+            uint8_t* target = base + offset;
+            for (const auto& entity : entities) {
+                typename Entity::State state = entity->CaptureState();
+                std::memcpy(target, &state, sizeof(state));
+                target += sizeof(state);
+            }
+        }
+
+        template <typename Entity>
+        void ReadEntities(const uint8_t* base, const SnapshotSection& section,
+            std::vector<std::unique_ptr<Entity>>& entities) {
+
+            entities.clear();
+            entities.reserve(section.count);
+            const uint8_t* source = base + section.offset;
+            for (uint32_t i = 0; i < section.count; i++) {
+                typename Entity::State state;
+                std::memcpy(&state, source + i * sizeof(state), sizeof(state));
+                entities.push_back(std::make_unique<Entity>(state));
+            }
+        }
+
+        bool ReadHeader(const std::vector<uint8_t>& buffer, SnapshotHeader& header) {
+            if (buffer.size() < sizeof(SnapshotHeader)) return false;
+            std::memcpy(&header, buffer.data(), sizeof(header));
+
+            if (header.magic != GameSnapshot::MAGIC || header.version != GameSnapshot::VERSION) return false;
+            if (header.headerSize != sizeof(SnapshotHeader) || header.totalSize != buffer.size()) return false;
+
+            // Record-Groessen muessen zum aktuellen Build passen
+            static const uint32_t expectedSizes[SNAPSHOT_SECTION_COUNT] = {
+                sizeof(MatchState), sizeof(Player::State), sizeof(Enemy::State), sizeof(Bullet::State),
+                sizeof(EnemyBullet::State), sizeof(PowerUp::State), sizeof(Explosion), sizeof(Boss::State)
+            };
+
+            for (int id = 0; id < SNAPSHOT_SECTION_COUNT; id++) {
+                const SnapshotSection& section = header.sections[id];
+                if (section.recordSize != expectedSizes[id]) return false;
+                if (section.offset < sizeof(SnapshotHeader) || section.offset > buffer.size()) return false;
+                if ((uint64_t)section.count * section.recordSize > buffer.size() - section.offset) return false;
+            }
+            return header.sections[SNAPSHOT_MATCH].count == 1 && header.sections[SNAPSHOT_BOSS].count <= 1;
+        }
+
+    } // namespace
+
+    // === Keyframes ===
+    void GameSnapshot::Capture(const SnapshotWorld& world, const MatchState& match, std::vector<uint8_t>& out) {
+        SnapshotHeader header = {};
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.headerSize = sizeof(SnapshotHeader);
+        header.sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+
+        // Layout festlegen
+        size_t cursor = sizeof(SnapshotHeader);
+        size_t matchOffset = Reserve(header, SNAPSHOT_MATCH, cursor, 1, sizeof(MatchState));
+        size_t playersOffset = Reserve(header, SNAPSHOT_PLAYERS, cursor, world.players.size(), sizeof(Player::State));
+        size_t enemiesOffset = Reserve(header, SNAPSHOT_ENEMIES, cursor, world.enemies.size(), sizeof(Enemy::State));
+        size_t bulletsOffset = Reserve(header, SNAPSHOT_BULLETS, cursor, world.bullets.size(), sizeof(Bullet::State));
+        size_t enemyBulletsOffset = Reserve(header, SNAPSHOT_ENEMY_BULLETS, cursor,
+            world.enemyBullets.size(), sizeof(EnemyBullet::State));
+        size_t powerUpsOffset = Reserve(header, SNAPSHOT_POWERUPS, cursor, world.powerUps.size(), sizeof(PowerUp::State));
+        size_t explosionsOffset = Reserve(header, SNAPSHOT_EXPLOSIONS, cursor, world.explosions.size(), sizeof(Explosion));
+        size_t bossOffset = Reserve(header, SNAPSHOT_BOSS, cursor, world.boss ? 1 : 0, sizeof(Boss::State));
+        header.totalSize = (uint32_t)cursor;
+
+        // Kapazitaet des Puffers wiederverwenden, Luecken nullen (stabile Deltas)
+        out.assign(cursor, 0);
+        uint8_t* base = out.data();
+        std::memcpy(base, &header, sizeof(header));
+        std::memcpy(base + matchOffset, &match, sizeof(match));
+
+        WriteEntities(base, playersOffset, world.players);
+        WriteEntities(base, enemiesOffset, world.enemies);
+        WriteEntities(base, bulletsOffset, world.bullets);
+        WriteEntities(base, enemyBulletsOffset, world.enemyBullets);
+        WriteEntities(base, powerUpsOffset, world.powerUps);
+        if (!world.explosions.empty()) {
+            std::memcpy(base + explosionsOffset, world.explosions.data(), world.explosions.size() * sizeof(Explosion));
+        }
+        if (world.boss) {
+            Boss::State state = world.boss->CaptureState();
+            std::memcpy(base + bossOffset, &state, sizeof(state));
+        }
+    }
+
+    bool GameSnapshot::Restore(const std::vector<uint8_t>& buffer, SnapshotWorld& world, MatchState& match) {
+        SnapshotHeader header;
+        if (!ReadHeader(buffer, header)) return false;
+
+        MemoryTagScope memoryTag(MEMORY_GAMEPLAY);
+        const uint8_t* base = buffer.data();
+        std::memcpy(&match, base + header.sections[SNAPSHOT_MATCH].offset, sizeof(match));
+
+        // Spieler brauchen ihren Avatar schon im Konstruktor
+        const SnapshotSection& playerSection = header.sections[SNAPSHOT_PLAYERS];
+        world.players.clear();
+        for (uint32_t i = 0; i < playerSection.count; i++) {
+            Player::State state;
+            std::memcpy(&state, base + playerSection.offset + i * sizeof(state), sizeof(state));
+            auto player = std::make_unique<Player>((AvatarType)state.avatarType, state.position);
+            player->RestoreState(state);
+            world.players.push_back(std::move(player));
+        }
+
+        ReadEntities(base, header.sections[SNAPSHOT_ENEMIES], world.enemies);
+        ReadEntities(base, header.sections[SNAPSHOT_BULLETS], world.bullets);
+        ReadEntities(base, header.sections[SNAPSHOT_ENEMY_BULLETS], world.enemyBullets);
+        ReadEntities(base, header.sections[SNAPSHOT_POWERUPS], world.powerUps);
+
+        const SnapshotSection& explosionSection = header.sections[SNAPSHOT_EXPLOSIONS];
+        world.explosions.resize(explosionSection.count);
+        if (explosionSection.count > 0) {
+            std::memcpy(world.explosions.data(), base + explosionSection.offset,
+                explosionSection.count * sizeof(Explosion));
+        }
+
+        world.boss.reset();
+        if (header.sections[SNAPSHOT_BOSS].count == 1) {
+            Boss::State state;
+            std::memcpy(&state, base + header.sections[SNAPSHOT_BOSS].offset, sizeof(state));
+            world.boss = std::make_unique<Boss>(state);
+        }
+        match.bossActive = match.bossActive && world.boss != nullptr;
+        return true;
+    }
+
+    bool GameSnapshot::IsValid(const std::vector<uint8_t>& buffer) {
+        SnapshotHeader header;
+        return ReadHeader(buffer, header);
+    }
+
+    uint32_t GameSnapshot::GetSequence(const std::vector<uint8_t>& buffer) {
+        SnapshotHeader header;
+        return ReadHeader(buffer, header) ? header.sequence : 0;
+    }
+
+    uint32_t GameSnapshot::Checksum(const std::vector<uint8_t>& buffer) {
+        // Magic, Version und Sequenz unterscheiden sich zwischen Prozessen bzw. Aufnahmen
+        const size_t begin = offsetof(SnapshotHeader, totalSize);
+        if (buffer.size() <= begin) return 0;
+        return SaveContainer::Crc32(buffer.data() + begin, buffer.size() - begin);
+    }
+
+    // === Deltas gegen einen Keyframe ===
+    void GameSnapshot::CaptureDelta(const std::vector<uint8_t>& keyframe, const std::vector<uint8_t>& current,
+        std::vector<uint8_t>& delta) {
+
+        DeltaHeader header = {};
+        header.magic = DELTA_MAGIC;
+        header.version = VERSION;
+        header.keyframeSequence = GetSequence(keyframe);
+        header.targetSize = (uint32_t)current.size();
+
+        delta.resize(sizeof(DeltaHeader));
+
+        auto appendRun = [&](size_t begin, size_t end) {
+            DeltaRun run = { (uint32_t)begin, (uint32_t)(end - begin) };
+            size_t position = delta.size();
+            delta.resize(position + sizeof(run) + run.length);
+            std::memcpy(delta.data() + position, &run, sizeof(run));
+            std::memcpy(delta.data() + position + sizeof(run), current.data() + begin, run.length);
+            header.runCount++;
+        };
+
+        // Geaenderte Bereiche suchen, kurze Luecken zusammenfassen
+        size_t common = std::min(keyframe.size(), current.size());
+        size_t runStart = 0;
+        size_t runEnd = 0;
+        bool inRun = false;
+
+        for (size_t i = 0; i < common; i++) {
+            if (keyframe[i] == current[i]) continue;
+
+            if (inRun && i - runEnd <= DELTA_MERGE_GAP) {
+                runEnd = i + 1;
+                continue;
+            }
+            if (inRun) appendRun(runStart, runEnd);
+            runStart = i;
+            runEnd = i + 1;
+            inRun = true;
+        }
+
+        // Alles hinter dem Keyframe ist neu
+        if (current.size() > common) {
+            if (inRun && common - runEnd <= DELTA_MERGE_GAP) {
+                runEnd = current.size();
+            }
+            else {
+                if (inRun) appendRun(runStart, runEnd);
+                runStart = common;
+                runEnd = current.size();
+                inRun = true;
+            }
+        }
+        if (inRun) appendRun(runStart, runEnd);
+
+        std::memcpy(delta.data(), &header, sizeof(header));
+    }
+
+    bool GameSnapshot::ApplyDelta(const std::vector<uint8_t>& keyframe, const std::vector<uint8_t>& delta,
+        std::vector<uint8_t>& out) {
+
+        if (delta.size() < sizeof(DeltaHeader)) return false;
+
+        DeltaHeader header;
+        std::memcpy(&header, delta.data(), sizeof(header));
+        if (header.magic != DELTA_MAGIC || header.version != VERSION) return false;
+        if (header.keyframeSequence != GetSequence(keyframe)) return false;
+
+        out.assign(keyframe.begin(), keyframe.begin() + std::min<size_t>(keyframe.size(), header.targetSize));
+        out.resize(header.targetSize, 0);
+
+        size_t position = sizeof(DeltaHeader);
+        for (uint32_t i = 0; i < header.runCount; i++) {
+            DeltaRun run;
+            if (delta.size() - position < sizeof(run)) return false;
+            std::memcpy(&run, delta.data() + position, sizeof(run));
+            position += sizeof(run);
+
+            if (delta.size() - position < run.length) return false;
+            if (run.offset > out.size() || run.length > out.size() - run.offset) return false;
+            std::memcpy(out.data() + run.offset, delta.data() + position, run.length);
+            position += run.length;
+        }
+
+        return IsValid(out);
+    }
+
+    size_t GameSnapshot::GetMaxDeltaSize(size_t snapshotSize) {
+        // Zwischen zwei Runs liegen mehr als DELTA_MERGE_GAP unveraenderte Bytes
+        size_t maxRuns = snapshotSize / (DELTA_MERGE_GAP + 1) + 1;
+        return sizeof(DeltaHeader) + maxRuns * sizeof(DeltaRun) + snapshotSize;
+    }
+
+    // === SnapshotHistory ===
+    SnapshotHistory::SnapshotHistory(size_t capacityFrames, size_t keyframeInterval)
+        : firstSegment(0)
+        , segmentCount(0)
+        , capacityFrames(capacityFrames)
+        , keyframeInterval(std::max<size_t>(keyframeInterval, 1))
+        , frameCount(0)
+        , reservedSize(0)
+    {
+        // Volle Segmente plus ein angebrochenes am Anfang und eins am Ende
+        segments.resize(capacityFrames / this->keyframeInterval + 2);
+        for (Segment& segment : segments) {
+            segment.deltas.resize(this->keyframeInterval - 1);
+        }
+    }
+
+    SnapshotHistory::Segment& SnapshotHistory::SegmentAt(size_t index) {
+        return segments[(firstSegment + index) % segments.size()];
+    }
+
+    void SnapshotHistory::Record(const std::vector<uint8_t>& snapshot) {
+        MemoryTagScope memoryTag(MEMORY_GAMEPLAY);
+
+        // Nur wenn die Partie groesser wird als je zuvor: alle Puffer auf einmal nachziehen
+        if (snapshot.size() > reservedSize) {
+            reservedSize = snapshot.size();
+            size_t deltaSize = GameSnapshot::GetMaxDeltaSize(reservedSize);
+            for (Segment& segment : segments) {
+                segment.keyframe.reserve(reservedSize);
+                for (auto& delta : segment.deltas) {
+                    delta.reserve(deltaSize);
+                }
+            }
+        }
+
+        if (segmentCount == 0 || SegmentAt(segmentCount - 1).deltaCount + 1 >= keyframeInterval) {
+            // Neues Segment; das aelteste freigeben, falls der Verlauf voll ist
+            if (segmentCount > 0 && (frameCount + 1 > capacityFrames || segmentCount == segments.size())) {
+                frameCount -= SegmentAt(0).deltaCount + 1;
+                firstSegment = (firstSegment + 1) % segments.size();
+                segmentCount--;
+            }
+
+            // Puffer des Slots aus dem letzten Umlauf weiterverwenden
+            Segment& segment = SegmentAt(segmentCount++);
+            segment.keyframe.assign(snapshot.begin(), snapshot.end());
+            segment.deltaCount = 0;
+        }
+        else {
+            Segment& segment = SegmentAt(segmentCount - 1);
+            GameSnapshot::CaptureDelta(segment.keyframe, snapshot, segment.deltas[segment.deltaCount++]);
+        }
+        frameCount++;
+    }
+
+    bool SnapshotHistory::Rewind(size_t frames, std::vector<uint8_t>& out) {
+        if (frameCount == 0) return false;
+
+        // Ziel-Frame suchen (0 = aeltester), alles danach verwerfen
+        size_t target = frames >= frameCount ? 0 : frameCount - 1 - frames;
+        size_t index = 0;
+        for (size_t s = 0; s < segmentCount; s++) {
+            Segment& segment = SegmentAt(s);
+            size_t segmentFrames = segment.deltaCount + 1;
+            if (target >= index + segmentFrames) {
+                index += segmentFrames;
+                continue;
+            }
+
+            size_t local = target - index;
+            bool restored = local == 0
+                ? (out.assign(segment.keyframe.begin(), segment.keyframe.end()), true)
+                : GameSnapshot::ApplyDelta(segment.keyframe, segment.deltas[local - 1], out);
+
+            // Neuere Frames nur als frei markieren, die Puffer bleiben im Pool
+            segment.deltaCount = local;
+            segmentCount = s + 1;
+            frameCount = target + 1;
+            return restored;
+        }
+        return false;
+    }
+
+    void SnapshotHistory::Clear() {
+        firstSegment = 0;
+        segmentCount = 0;
+        frameCount = 0;
+    }
+
+    size_t SnapshotHistory::GetFrameCount() const {
+        return frameCount;
+    }
+
+    size_t SnapshotHistory::GetMemoryUsage() const {
+        size_t bytes = 0;
+        for (const Segment& segment : segments) {
+            bytes += segment.keyframe.capacity();
+            for (const auto& delta : segment.deltas) {
+                bytes += delta.capacity();
+            }
+        }
+        return bytes;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "GameConfig.h"
+#include "GameplayManager.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Zustand einer Partie ausserhalb der Spielobjekte
+     *
+     * Eingeplante Ablaeufe werden als Rest in ganzen Ticks gespeichert und beim
+     * Wiederherstellen neu eingeplant (Callbacks sind nicht serialisierbar).
+     * Zufallsgenerator und angebrochene Ticks gehoeren dazu, damit eine
+     * wiederhergestellte Partie exakt gleich weiterlaeuft.
+     */
+    struct MatchState {
+        uint64_t randomState;
+        float gameTime;
+        float backgroundScroll;
+        int32_t enemySpawnTicks;     // < 0 = nicht eingeplant
+        int32_t bossSpawnTicks;      // < 0 = nicht eingeplant
+        uint32_t slowMotionTicks;    // 0 = inaktiv
+        float gameTickAccumulator;
+        float worldTickAccumulator;
+        uint8_t difficulty;
+        uint8_t selectedAvatar;
+        uint8_t selectedMod;
+        bool isMultiPlayer;
+        bool bossActive;
+        uint8_t reserved[7];
+    };
+
+    /**
+     * @brief Verweise auf die Spielobjekte von Game bzw. HeadlessMatch
+     */
+    struct SnapshotWorld {
+        std::vector<std::unique_ptr<Player>>& players;
+        std::vector<std::unique_ptr<Enemy>>& enemies;
+        std::vector<std::unique_ptr<Bullet>>& bullets;
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets;
+        std::vector<std::unique_ptr<PowerUp>>& powerUps;
+        std::vector<Explosion>& explosions;
+        std::unique_ptr<Boss>& boss;
+    };
+
+    /**
+     * @brief Snapshot der kompletten Simulation als flacher Byte-Puffer
+     *
+     * Aufbau: Header mit Offset, Anzahl und Record-Groesse pro Sektion,
+     * danach MatchState und je Objekt-Typ ein Array der POD-States
+     * (Player::State, Enemy::State, ...). Es gibt keine Zeiger, der Puffer
+     * kann also beliebig kopiert, gespeichert und wieder geladen werden.
+     * Tick-basierte Cooldowns stehen relativ zur aktuellen Tick-Uhr darin.
+     *
+     * Capture verwendet die Kapazitaet des Ziel-Puffers weiter und kommt
+     * im laufenden Spiel ohne Allokation aus. Deltas speichern nur die
+     * Byte-Bereiche, die sich gegenueber einem Keyframe geaendert haben.
+     *
+     * Das Format ist Host-Byte-Order und an VERSION gebunden, es ist fuer
+     * Autosave, Rewind, Rollback und Debugging gedacht, nicht als
+     * Austauschformat. Alle States haben explizite reserved-Bytes statt
+     * Compiler-Padding, gleiche Simulation ergibt also gleiche Bytes und
+     * Checksum() taugt zum Vergleich zweier Prozesse.
+     */
+    class GameSnapshot {
+    public:
+        // === Keyframes ===
+        static void Capture(const SnapshotWorld& world, const MatchState& match, std::vector<uint8_t>& out);
+        static bool Restore(const std::vector<uint8_t>& buffer, SnapshotWorld& world, MatchState& match);
+        static bool IsValid(const std::vector<uint8_t>& buffer);
+        static uint32_t GetSequence(const std::vector<uint8_t>& buffer);
+        static uint32_t Checksum(const std::vector<uint8_t>& buffer);  // ohne Sequenznummer
+
+        // === Deltas gegen einen Keyframe ===
+        static void CaptureDelta(const std::vector<uint8_t>& keyframe, const std::vector<uint8_t>& current,
+            std::vector<uint8_t>& delta);
+        static bool ApplyDelta(const std::vector<uint8_t>& keyframe, const std::vector<uint8_t>& delta,
+            std::vector<uint8_t>& out);
+        static size_t GetMaxDeltaSize(size_t snapshotSize);  // obere Schranke fuer CaptureDelta
+
+        // === Constants ===
+        static const uint32_t MAGIC = 0x4E534953;        // "SISN" little endian
+        static const uint32_t DELTA_MAGIC = 0x44534953;  // "SISD" little endian
+        // Bit 15: Festkomma-Simulation (States sind sonst nicht austauschbar)
+        static const uint16_t VERSION = GameConfig::FIXED_POINT_SIMULATION ? 0x8005 : 0x0005;
+        static const size_t DELTA_MERGE_GAP = 16;        // kleinere Luecken werden mitkopiert
+    };
+
+    /**
+     * @brief Rewind-Verlauf der letzten Frames (Keyframe + Deltas)
+     *
+     * Alle keyframeInterval Frames wird ein voller Snapshot abgelegt,
+     * dazwischen nur Deltas gegen diesen Keyframe. Ueberschreitet der
+     * Verlauf capacityFrames, faellt das aelteste Segment komplett weg.
+     *
+     * Segmente liegen in einem festen Ring, Delta-Puffer werden per Index
+     * wiederverwendet. Alle Puffer sind auf den groessten bisherigen Snapshot
+     * reserviert, Record() allokiert also nur, wenn die Partie waechst.
+     */
+    class SnapshotHistory {
+    public:
+        SnapshotHistory(size_t capacityFrames, size_t keyframeInterval);
+
+        void Record(const std::vector<uint8_t>& snapshot);
+        bool Rewind(size_t frames, std::vector<uint8_t>& out);  // verwirft die neueren Frames
+        void Clear();
+
+        size_t GetFrameCount() const;
+        size_t GetMemoryUsage() const;
+
+    private:
+        struct Segment {
+            std::vector<uint8_t> keyframe;
+            std::vector<std::vector<uint8_t>> deltas;  // Pool, gueltig sind die ersten deltaCount
+            size_t deltaCount = 0;
+        };
+
+        Segment& SegmentAt(size_t index);  // 0 = aeltestes Segment
+
+        std::vector<Segment> segments;     // Ring
+        size_t firstSegment;
+        size_t segmentCount;
+        size_t capacityFrames;
+        size_t keyframeInterval;
+        size_t frameCount;
+        size_t reservedSize;               // groesster bisher aufgezeichneter Snapshot
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,702 @@
+#include "GameplayManager.h"
+#include "Tracer.h"
+#include "DifficultyProfile.h"
+#include "GameRandom.h"
+#include <algorithm>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // Entfernt alle inaktiven Objekte (erase-remove)
+        template <typename T>
+        void RemoveInactive(std::vector<std::unique_ptr<T>>& objects) {
+            objects.erase(std::remove_if(objects.begin(), objects.end(),
+                [](const std::unique_ptr<T>& object) { return !object || !object->IsActive(); }),
+                objects.end());
+        }
+
+        float RandomFloat() {
+            return GameRandom::NextFloat();
+        }
+
+        // Stabiler Insertion-Sort nach linker Kante, ohne Allokation. Schuesse
+        // bewegen sich fast nur vertikal (Homing-Raketen driften leicht): die
+        // Reihenfolge vom letzten Frame bleibt nahezu gueltig, im Wesentlichen
+        // wandern nur neu angehaengte Schuesse an ihren Platz.
+        template <typename T>
+        void SortByLeftEdge(std::vector<std::unique_ptr<T>>& objects) {
+            for (size_t i = 1; i < objects.size(); i++) {
+                SimScalar left = objects[i]->GetBounds().x;
+                if (!(left < objects[i - 1]->GetBounds().x)) continue;
+
+                std::unique_ptr<T> moving = std::move(objects[i]);
+                size_t j = i;
+                while (j > 0 && left < objects[j - 1]->GetBounds().x) {
+                    objects[j] = std::move(objects[j - 1]);
+                    j--;
+                }
+                objects[j] = std::move(moving);
+            }
+        }
+
+        // Schliesst Intervalle links von bounds und entnimmt das erste ueberlappende
+        template <typename Interval>
+        auto TakeOverlap(std::vector<Interval>& open, const SimRect& bounds) -> decltype(Interval::object) {
+            for (size_t i = 0; i < open.size();) {
+                const SimRect& other = open[i].bounds;
+                bool closed = !(bounds.x < other.x + other.width);
+                bool overlaps = !closed && bounds.Overlaps(other);
+
+                if (closed || overlaps) {
+                    auto object = open[i].object;
+                    open[i] = open.back();
+                    open.pop_back();
+                    if (overlaps) return object;
+                    continue;
+                }
+                i++;
+            }
+            return nullptr;
+        }
+
+    } // namespace
+
+    // === Konstruktor ===
+    GameplayManager::GameplayManager() {
+        RegisterEventHandlers();
+    }
+
+    // === Update-Funktionen ===
+    template <typename Profile>
+    void GameplayManager::UpdateGameplay(
+        std::vector<std::unique_ptr<Player>>& players,
+        std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+        std::vector<std::unique_ptr<PowerUp>>& powerUps,
+        std::vector<Explosion>& explosions,
+        std::unique_ptr<Boss>& boss,
+        bool& bossActive,
+        float deltaTime,
+        float scaledDeltaTime) {
+
+        TraceScope trace("GameplayManager::UpdateGameplay");
+
+        // Objekte fuer die Abonnenten dieses Frames bereitstellen
+        framePlayers = &players;
+        framePowerUps = &powerUps;
+        frameExplosions = &explosions;
+        frameDropChance = Profile::PowerUpDropChance();
+
+        // Spieler-Projektile laufen in Echtzeit, Gegner folgen der SlowMotion
+        UpdateGuidedBullets(bullets, enemies, boss, deltaTime);
+        UpdateBullets(bullets, deltaTime);
+        UpdateEnemies(enemies, enemyBullets, scaledDeltaTime, Profile::VALUES.enemyBulletSpeed, bossActive);
+        UpdateEnemyBullets(enemyBullets, scaledDeltaTime);
+        UpdatePowerUps(powerUps, deltaTime);
+        UpdateBoss(boss, enemyBullets, bossActive, scaledDeltaTime);
+
+        // Abfangen vor den Treffern, ein abgefangener Schuss trifft nichts mehr
+        if constexpr (Profile::VALUES.bulletCancellation) {
+            HandleBulletCancellation(bullets, enemyBullets);
+        }
+
+        HandleAllCollisions(players, enemies, bullets, enemyBullets, powerUps, boss, bossActive);
+
+        // Seiteneffekte des Frames gesammelt ausfuehren
+        {
+            TraceScope dispatch("EventBus::Dispatch");
+            eventBus.Dispatch();
+        }
+
+        UpdateExplosions(explosions, deltaTime);
+
+        framePlayers = nullptr;
+        framePowerUps = nullptr;
+        frameExplosions = nullptr;
+    }
+
+    EventBus& GameplayManager::GetEventBus() {
+        return eventBus;
+    }
+
+    // === Spawning ===
+    template <typename Profile>
+    void GameplayManager::SpawnEnemy(std::vector<std::unique_ptr<Enemy>>& enemies) {
+        int enemyType = GameRandom::NextInt(Enemy::MAX_ENEMY_TYPES);
+        SimScalar maxX = SimScalar(GameConfig::SCREEN_WIDTH - Enemy::DEFAULT_SIZE);
+        SimVector2 position = { SimScalar(RandomFloat()) * maxX, -SimScalar(Enemy::DEFAULT_SIZE) };
+
+        enemies.push_back(std::make_unique<Enemy>(enemyType, position,
+            SimScalar(Profile::VALUES.enemySpeed), Profile::EnemyShootCooldown()));
+        spawnCount++;
+    }
+
+    void GameplayManager::SpawnPowerUp(std::vector<std::unique_ptr<PowerUp>>& powerUps, SimVector2 position) {
+        static const PowerUpType dropTypes[] = {
+            POWERUP_SHIELD, POWERUP_TRIPLESHOT, POWERUP_SLOWMO, POWERUP_HOMING, POWERUP_LASER
+        };
+        PowerUpType type = dropTypes[GameRandom::NextInt(sizeof(dropTypes) / sizeof(dropTypes[0]))];
+
+        powerUps.push_back(std::make_unique<PowerUp>(position, type));
+        spawnCount++;
+    }
+
+    void GameplayManager::SpawnBoss(std::unique_ptr<Boss>& boss, bool& bossActive, Difficulty difficulty) {
+        SimVector2 position = { SimScalar(GameConfig::SCREEN_WIDTH / 2.0f - Boss::DEFAULT_WIDTH / 2.0f), SimScalar(50) };
+
+        boss = std::make_unique<Boss>(position, difficulty);
+        bossActive = true;
+        spawnCount++;
+    }
+
+    void GameplayManager::SpawnPlayerBullets(std::vector<std::unique_ptr<Player>>& players,
+        std::vector<std::unique_ptr<Bullet>>& bullets) {
+
+        for (size_t i = 0; i < players.size(); i++) {
+            if (!players[i] || !players[i]->WantsToShoot()) continue;
+
+            SimVector2 shootPos = {
+                players[i]->GetPosition().x + SimScalar(Player::AVATAR_WIDTH / 2),
+                players[i]->GetPosition().y
+            };
+
+            SimScalar bulletSpeed = SimScalar(500.0f * players[i]->GetBulletSpeedMultiplier());
+
+            // Laser vor Homing vor TripleShot, wenn mehrere PowerUps gleichzeitig laufen
+            size_t bulletsBefore = bullets.size();
+            if (players[i]->IsLaserActive()) {
+                SimScalar laserSpeed = SimScalar(Bullet::LASER_SPEED * players[i]->GetBulletSpeedMultiplier());
+                bullets.push_back(std::make_unique<Bullet>((int)i, shootPos, laserSpeed, Bullet::LASER));
+            }
+            else if (players[i]->IsHomingActive()) {
+                bullets.push_back(std::make_unique<Bullet>((int)i, SimVector2{ shootPos.x - 15, shootPos.y }, bulletSpeed, Bullet::HOMING));
+                bullets.push_back(std::make_unique<Bullet>((int)i, SimVector2{ shootPos.x + 15, shootPos.y }, bulletSpeed, Bullet::HOMING));
+            }
+            else if (players[i]->IsTripleShotActive()) {
+                bullets.push_back(std::make_unique<Bullet>((int)i, shootPos, bulletSpeed, Bullet::TRIPLE_SHOT));
+                bullets.push_back(std::make_unique<Bullet>((int)i, SimVector2{ shootPos.x - 30, shootPos.y }, bulletSpeed, Bullet::TRIPLE_SHOT));
+                bullets.push_back(std::make_unique<Bullet>((int)i, SimVector2{ shootPos.x + 30, shootPos.y }, bulletSpeed, Bullet::TRIPLE_SHOT));
+            }
+            else {
+                Bullet::BulletType type = players[i]->IsFastFireActive() ? Bullet::FAST_FIRE : Bullet::NORMAL;
+                bullets.push_back(std::make_unique<Bullet>((int)i, shootPos, bulletSpeed, type));
+            }
+
+            eventBus.Publish({ EVENT_PLAYER_SHOT, (int8_t)i, (int16_t)bullets.back()->GetType(),
+                (int32_t)(bullets.size() - bulletsBefore), ToVector2(shootPos) });
+            players[i]->ResetShootRequest();
+            spawnCount += bullets.size() - bulletsBefore;
+        }
+    }
+
+    size_t GameplayManager::GetSpawnCount() const {
+        return spawnCount;
+    }
+
+    // === Kollisionen ===
+    void GameplayManager::HandleAllCollisions(
+        std::vector<std::unique_ptr<Player>>& players,
+        std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+        std::vector<std::unique_ptr<PowerUp>>& powerUps,
+        std::unique_ptr<Boss>& boss,
+        bool bossActive) {
+
+        TraceScope trace("GameplayManager::HandleAllCollisions");
+
+        HandleBulletEnemyCollisions(bullets, enemies);
+        if (bossActive) {
+            HandleBulletBossCollisions(bullets, boss);
+        }
+        HandlePlayerEnemyCollisions(players, enemies);
+        HandlePlayerBulletCollisions(players, enemyBullets);
+        HandlePowerUpCollisions(players, powerUps);
+    }
+
+    // === Game Object Management ===
+    void GameplayManager::UpdateBullets(std::vector<std::unique_ptr<Bullet>>& bullets, float deltaTime) {
+        TraceScope trace("GameplayManager::UpdateBullets");
+
+        for (auto& bullet : bullets) {
+            bullet->Update(deltaTime);
+        }
+        RemoveInactive(bullets);
+    }
+
+    void GameplayManager::UpdateEnemies(std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+        float deltaTime, float bulletSpeed, bool bossActive) {
+
+        TraceScope trace("GameplayManager::UpdateEnemies");
+
+        for (auto& enemy : enemies) {
+            enemy->Update(deltaTime);
+
+            // Waehrend des Bosskampfs feuern nur noch die Boss-Salven
+            if (!bossActive && enemy->IsActive() && enemy->GetPosition().y > 0 && enemy->WantsToShoot()) {
+                enemyBullets.push_back(std::make_unique<EnemyBullet>(
+                    enemy->GetShootPosition(), SimScalar(bulletSpeed), enemy->GetBulletColor()));
+                enemy->ResetShootTimer();
+                spawnCount++;
+            }
+        }
+        RemoveInactive(enemies);
+    }
+
+    void GameplayManager::UpdateEnemyBullets(std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets, float deltaTime) {
+        TraceScope trace("GameplayManager::UpdateEnemyBullets");
+
+        for (auto& bullet : enemyBullets) {
+            bullet->Update(deltaTime);
+        }
+        RemoveInactive(enemyBullets);
+    }
+
+    void GameplayManager::UpdatePowerUps(std::vector<std::unique_ptr<PowerUp>>& powerUps, float deltaTime) {
+        TraceScope trace("GameplayManager::UpdatePowerUps");
+
+        for (auto& powerUp : powerUps) {
+            powerUp->Update(deltaTime);
+        }
+        RemoveInactive(powerUps);
+    }
+
+    void GameplayManager::UpdateExplosions(std::vector<Explosion>& explosions, float deltaTime) {
+        TraceScope trace("GameplayManager::UpdateExplosions");
+
+        for (auto& explosion : explosions) {
+            explosion.timer += deltaTime;
+        }
+
+        explosions.erase(std::remove_if(explosions.begin(), explosions.end(),
+            [](const Explosion& explosion) { return explosion.timer >= explosion.duration; }),
+            explosions.end());
+    }
+
+    void GameplayManager::UpdateBoss(std::unique_ptr<Boss>& boss, std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+        bool& bossActive, float deltaTime) {
+
+        TraceScope trace("GameplayManager::UpdateBoss");
+
+        if (!boss) {
+            bossActive = false;
+            return;
+        }
+
+        // Besiegter Boss wurde im letzten Frame deaktiviert
+        if (!boss->IsActive()) {
+            boss.reset();
+            bossActive = false;
+            return;
+        }
+
+        size_t bulletsBefore = enemyBullets.size();
+        boss->Update(deltaTime);
+        boss->Shoot(enemyBullets);
+        spawnCount += enemyBullets.size() - bulletsBefore;
+    }
+
+    // === Cleanup ===
+    void GameplayManager::ClearAllGameObjects(
+        std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
+        std::vector<std::unique_ptr<PowerUp>>& powerUps,
+        std::vector<Explosion>& explosions,
+        std::unique_ptr<Boss>& boss,
+        bool& bossActive) {
+
+        enemies.clear();
+        bullets.clear();
+        enemyBullets.clear();
+        powerUps.clear();
+        explosions.clear();
+        boss.reset();
+        bossActive = false;
+    }
+
+    // === Kollisions-Hilfsfunktionen ===
+    void GameplayManager::HandleBulletEnemyCollisions(
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::vector<std::unique_ptr<Enemy>>& enemies) {
+
+        for (auto& bullet : bullets) {
+            // Laser-Treffer laufen ueber die Strahlabfrage in FireLaser
+            if (!bullet->IsActive() || bullet->GetType() == Bullet::LASER) continue;
+
+            for (auto& enemy : enemies) {
+                if (!enemy->IsActive()) continue;
+                if (!bullet->GetBounds().Overlaps(enemy->GetBounds())) continue;
+
+                bullet->Deactivate();
+                KillEnemy(*enemy, bullet->GetPlayerId());
+                break;
+            }
+        }
+    }
+
+    void GameplayManager::HandleBulletBossCollisions(
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::unique_ptr<Boss>& boss) {
+
+        if (!boss || !boss->IsActive()) return;
+
+        for (auto& bullet : bullets) {
+            if (!bullet->IsActive() || bullet->GetType() == Bullet::LASER) continue;
+            if (!bullet->GetBounds().Overlaps(boss->GetBounds())) continue;
+
+            bullet->Deactivate();
+            HitBoss(*boss, bullet->GetPlayerId(), ToVector2(bullet->GetPosition()));
+            if (!boss->IsActive()) break;
+        }
+    }
+
+    void GameplayManager::HandlePlayerEnemyCollisions(
+        std::vector<std::unique_ptr<Player>>& players,
+        std::vector<std::unique_ptr<Enemy>>& enemies) {
+
+        for (size_t i = 0; i < players.size(); i++) {
+            if (!players[i] || players[i]->GetLives() <= 0) continue;
+
+            for (auto& enemy : enemies) {
+                if (!enemy->IsActive()) continue;
+                if (!players[i]->GetBounds().Overlaps(enemy->GetBounds())) continue;
+
+                // Rammen zerstoert den Gegner, bringt aber keine Punkte
+                enemy->Deactivate();
+                eventBus.Publish({ EVENT_ENEMY_KILLED, -1, (int16_t)enemy->GetEnemyType(), 0,
+                    GetCenter(enemy->GetBounds()) });
+
+                HitPlayer(players, (int)i, HIT_ENEMY_COLLISION);
+            }
+        }
+    }
+
+    void GameplayManager::HandlePlayerBulletCollisions(
+        std::vector<std::unique_ptr<Player>>& players,
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets) {
+
+        for (size_t i = 0; i < players.size(); i++) {
+            if (!players[i] || players[i]->GetLives() <= 0) continue;
+
+            for (auto& bullet : enemyBullets) {
+                if (!bullet->IsActive()) continue;
+                if (!players[i]->GetBounds().Overlaps(bullet->GetBounds())) continue;
+
+                bullet->Deactivate();
+                HitPlayer(players, (int)i, HIT_ENEMY_BULLET);
+            }
+        }
+    }
+
+    void GameplayManager::HandlePowerUpCollisions(
+        std::vector<std::unique_ptr<Player>>& players,
+        std::vector<std::unique_ptr<PowerUp>>& powerUps) {
+
+        for (size_t i = 0; i < players.size(); i++) {
+            if (!players[i] || players[i]->GetLives() <= 0) continue;
+
+            for (auto& powerUp : powerUps) {
+                if (!powerUp->IsActive()) continue;
+                if (!players[i]->GetBounds().Overlaps(powerUp->GetBounds())) continue;
+
+                powerUp->Deactivate();
+                eventBus.Publish({ EVENT_POWERUP_COLLECTED, (int8_t)i, 0,
+                    (int32_t)powerUp->GetType(), ToVector2(powerUp->GetPosition()) });
+            }
+        }
+    }
+
+    void GameplayManager::HandleBulletCancellation(
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets) {
+
+        TraceScope trace("GameplayManager::HandleBulletCancellation");
+
+        SortByLeftEdge(bullets);
+        SortByLeftEdge(enemyBullets);
+
+        // Beide Listen nach linker Kante zusammenfuehren; verglichen wird nur
+        // mit offenen Intervallen der Gegenseite, die x noch ueberdecken
+        // Reserve waechst nur mit neuen Geschossen, nie in einem Frame ohne Spawn
+        sweepOpenBullets.clear();
+        sweepOpenEnemyBullets.clear();
+        sweepOpenBullets.reserve(bullets.size());
+        sweepOpenEnemyBullets.reserve(enemyBullets.size());
+
+        size_t nextBullet = 0;
+        size_t nextEnemyBullet = 0;
+        while (nextBullet < bullets.size() || nextEnemyBullet < enemyBullets.size()) {
+            bool takeBullet = nextEnemyBullet >= enemyBullets.size() ||
+                (nextBullet < bullets.size() &&
+                    !(enemyBullets[nextEnemyBullet]->GetBounds().x < bullets[nextBullet]->GetBounds().x));
+
+            if (takeBullet) {
+                Bullet* bullet = bullets[nextBullet++].get();
+                if (!bullet->IsActive()) continue;
+
+                SimRect bounds = bullet->GetBounds();
+                EnemyBullet* hit = TakeOverlap(sweepOpenEnemyBullets, bounds);
+                if (!hit) {
+                    sweepOpenBullets.push_back({ bounds, bullet });
+                    continue;
+                }
+
+                bullet->Deactivate();
+                hit->Deactivate();
+                eventBus.Publish({ EVENT_BULLET_CANCELLED, (int8_t)bullet->GetPlayerId(), 0, 0,
+                    ToVector2(hit->GetPosition()) });
+            }
+            else {
+                EnemyBullet* enemyBullet = enemyBullets[nextEnemyBullet++].get();
+                if (!enemyBullet->IsActive()) continue;
+
+                SimRect bounds = enemyBullet->GetBounds();
+                Bullet* hit = TakeOverlap(sweepOpenBullets, bounds);
+                if (!hit) {
+                    sweepOpenEnemyBullets.push_back({ bounds, enemyBullet });
+                    continue;
+                }
+
+                hit->Deactivate();
+                enemyBullet->Deactivate();
+                eventBus.Publish({ EVENT_BULLET_CANCELLED, (int8_t)hit->GetPlayerId(), 0, 0,
+                    ToVector2(enemyBullet->GetPosition()) });
+            }
+        }
+    }
+
+    void GameplayManager::HitPlayer(std::vector<std::unique_ptr<Player>>& players, int playerId, HitCause cause) {
+        Player* player = players[playerId].get();
+        Vector2 center = GetCenter(player->GetBounds());
+
+        // Schild faengt den Treffer ab
+        if (player->HasShield()) {
+            player->HitShield();
+            eventBus.Publish({ EVENT_SHIELD_HIT, (int8_t)playerId, 0, player->GetShieldStrength(), center });
+            return;
+        }
+
+        player->LoseLife();
+        eventBus.Publish({ EVENT_PLAYER_HIT, (int8_t)playerId, cause, player->GetLives(), center });
+    }
+
+    void GameplayManager::KillEnemy(Enemy& enemy, int playerId) {
+        enemy.Deactivate();
+        eventBus.Publish({ EVENT_ENEMY_KILLED, (int8_t)playerId,
+            (int16_t)enemy.GetEnemyType(), enemy.GetScoreValue(), GetCenter(enemy.GetBounds()) });
+    }
+
+    void GameplayManager::HitBoss(Boss& boss, int playerId, Vector2 hitPosition) {
+        boss.TakeDamage(1);
+        eventBus.Publish({ EVENT_BOSS_HIT, (int8_t)playerId, 0, boss.GetCurrentHealth(), hitPosition });
+
+        if (boss.IsDefeated()) {
+            boss.Deactivate();
+            eventBus.Publish({ EVENT_BOSS_DEFEATED, (int8_t)playerId, 0,
+                BOSS_SCORE_BONUS, GetCenter(boss.GetBounds()) });
+        }
+    }
+
+    // === Homing & Laser ===
+    void GameplayManager::UpdateGuidedBullets(
+        std::vector<std::unique_ptr<Bullet>>& bullets,
+        std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::unique_ptr<Boss>& boss,
+        float deltaTime) {
+
+        bool anyGuided = std::any_of(bullets.begin(), bullets.end(), [](const std::unique_ptr<Bullet>& bullet) {
+            return bullet->IsActive() && (bullet->GetType() == Bullet::HOMING || bullet->GetType() == Bullet::LASER);
+        });
+        if (!anyGuided) return;
+
+        TraceScope trace("GameplayManager::UpdateGuidedBullets");
+
+        // Ein Aufbau pro Tick, danach kostet jede Rakete nur die Zellen in ihrer Naehe
+        BuildEnemyIndex(enemies, boss);
+
+        for (auto& bullet : bullets) {
+            if (!bullet->IsActive()) continue;
+
+            if (bullet->GetType() == Bullet::HOMING) {
+                SteerHomingBullet(*bullet, deltaTime);
+            }
+            else if (bullet->GetType() == Bullet::LASER) {
+                FireLaser(*bullet, enemies, boss, deltaTime);
+            }
+        }
+    }
+
+    void GameplayManager::BuildEnemyIndex(
+        std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::unique_ptr<Boss>& boss) {
+
+        enemyIndex.Clear();
+
+        // Inaktive Gegner bekommen trotzdem eine Id, damit Id == Index in enemies bleibt
+        for (const auto& enemy : enemies) {
+            int32_t id = enemyIndex.Insert(enemy->GetBounds());
+            if (!enemy->IsActive()) enemyIndex.Remove(id);
+        }
+
+        bossIndexId = (boss && boss->IsActive()) ? enemyIndex.Insert(boss->GetBounds()) : -1;
+        enemyIndex.Build();
+    }
+
+    void GameplayManager::SteerHomingBullet(Bullet& bullet, float deltaTime) {
+        SimVector2 position = bullet.GetPosition();
+        enemyIndex.FindNearest(position, HOMING_CANDIDATES, nearestTargets);
+
+        // Naechstes Ziel vor der Rakete, bereits passierte Gegner werden ignoriert
+        for (const SpatialIndex::Neighbor& target : nearestTargets) {
+            SimVector2 center = enemyIndex.GetBounds(target.id).GetCenter();
+            if (!(center.y < position.y)) continue;
+
+            bullet.SteerTowards(center.x, deltaTime);
+            return;
+        }
+    }
+
+    void GameplayManager::FireLaser(
+        Bullet& bullet,
+        std::vector<std::unique_ptr<Enemy>>& enemies,
+        std::unique_ptr<Boss>& boss,
+        float deltaTime) {
+
+        // Strecke, die der Laser in diesem Tick zuruecklegt
+        SimVector2 from = bullet.GetPosition();
+        SimVector2 to = { from.x, from.y - bullet.GetSpeed() * SimScalar(deltaTime) };
+
+        SpatialIndex::RayHit hit;
+        while (bullet.IsActive() && enemyIndex.Raycast(from, to, hit)) {
+            // Der Boss haelt den Strahl auf
+            if (hit.id == bossIndexId) {
+                SimVector2 hitPosition = { from.x, from.y + (to.y - from.y) * hit.fraction };
+                HitBoss(*boss, bullet.GetPlayerId(), ToVector2(hitPosition));
+                if (!boss->IsActive()) enemyIndex.Remove(hit.id);
+                bullet.Deactivate();
+                break;
+            }
+
+            // Getroffene Gegner verschwinden auch fuer die uebrigen Abfragen dieses Ticks
+            enemyIndex.Remove(hit.id);
+            KillEnemy(*enemies[hit.id], bullet.GetPlayerId());
+            bullet.Pierce();
+        }
+    }
+
+    // === Abonnenten ===
+    void GameplayManager::RegisterEventHandlers() {
+        eventBus.Subscribe(EVENT_ENEMY_KILLED, [this](const GameEvent& event) { OnEnemyKilled(event); });
+        eventBus.Subscribe(EVENT_BOSS_DEFEATED, [this](const GameEvent& event) { OnBossDefeated(event); });
+        eventBus.Subscribe(EVENT_PLAYER_HIT, [this](const GameEvent& event) { OnPlayerHit(event); });
+        eventBus.Subscribe(EVENT_POWERUP_COLLECTED, [this](const GameEvent& event) { OnPowerUpCollected(event); });
+        eventBus.Subscribe(EVENT_BULLET_CANCELLED, [this](const GameEvent& event) { OnBulletCancelled(event); });
+    }
+
+    void GameplayManager::OnEnemyKilled(const GameEvent& event) {
+        if (frameExplosions) {
+            CreateExplosion(*frameExplosions, event.position, Enemy::DEFAULT_SIZE * 1.2f);
+        }
+
+        // Punkte an den Schuetzen
+        if (framePlayers && event.playerId >= 0 && event.playerId < (int)framePlayers->size()) {
+            auto& player = (*framePlayers)[event.playerId];
+            if (player) player->AddScore(event.value);
+        }
+
+        // Nur abgeschossene Gegner koennen ein PowerUp fallen lassen
+        if (framePowerUps && event.playerId >= 0 &&
+            RandomFloat() < frameDropChance) {
+            // Event-Positionen sind float, die Rueckwandlung ist exakt reproduzierbar
+            SpawnPowerUp(*framePowerUps, ToSimVector2(event.position));
+        }
+    }
+
+    void GameplayManager::OnBossDefeated(const GameEvent& event) {
+        if (frameExplosions) {
+            CreateExplosion(*frameExplosions, event.position, Boss::DEFAULT_WIDTH * 1.5f);
+        }
+
+        if (framePlayers && event.playerId >= 0 && event.playerId < (int)framePlayers->size()) {
+            auto& player = (*framePlayers)[event.playerId];
+            if (player) player->AddScore(event.value);
+        }
+    }
+
+    void GameplayManager::OnPlayerHit(const GameEvent& event) {
+        if (frameExplosions) {
+            CreateExplosion(*frameExplosions, event.position, Player::AVATAR_WIDTH * 0.6f);
+        }
+    }
+
+    void GameplayManager::OnPowerUpCollected(const GameEvent& event) {
+        if (!framePlayers || event.playerId < 0 || event.playerId >= (int)framePlayers->size()) return;
+
+        // SlowMotion wirkt global und wird von Game abonniert
+        ApplyPowerUpToPlayer((PowerUpType)event.value, (*framePlayers)[event.playerId].get());
+    }
+
+    void GameplayManager::OnBulletCancelled(const GameEvent& event) {
+        if (frameExplosions) {
+            CreateExplosion(*frameExplosions, event.position, EnemyBullet::DEFAULT_RADIUS * 3.0f);
+        }
+    }
+
+    // === PowerUp Anwendung ===
+    void GameplayManager::ApplyPowerUpToPlayer(PowerUpType type, Player* player) {
+        if (!player) return;
+
+        switch (type) {
+        case POWERUP_SHIELD:
+            player->ActivateShield(3, GameConfig::POWERUP_DURATION);
+            break;
+        case POWERUP_TRIPLESHOT:
+            player->ActivateTripleShot(GameConfig::POWERUP_DURATION);
+            break;
+        case POWERUP_HOMING:
+            player->ActivateHoming(GameConfig::POWERUP_DURATION);
+            break;
+        case POWERUP_LASER:
+            player->ActivateLaser(GameConfig::POWERUP_DURATION);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // === Hilfsfunktionen ===
+    void GameplayManager::CreateExplosion(std::vector<Explosion>& explosions, Vector2 position, float size) {
+        explosions.push_back({ position, size, 0.0f, 0.5f });
+        spawnCount++;
+    }
+
+    Vector2 GameplayManager::GetCenter(const SimRect& bounds) {
+        return ToVector2(bounds.GetCenter());
+    }
+
+    // === Explizite Instanziierung pro Schwierigkeitsprofil ===
+    template void GameplayManager::UpdateGameplay<EasyProfile>(
+        std::vector<std::unique_ptr<Player>>&, std::vector<std::unique_ptr<Enemy>>&,
+        std::vector<std::unique_ptr<Bullet>>&, std::vector<std::unique_ptr<EnemyBullet>>&,
+        std::vector<std::unique_ptr<PowerUp>>&, std::vector<Explosion>&,
+        std::unique_ptr<Boss>&, bool&, float, float);
+    template void GameplayManager::UpdateGameplay<MediumProfile>(
+        std::vector<std::unique_ptr<Player>>&, std::vector<std::unique_ptr<Enemy>>&,
+        std::vector<std::unique_ptr<Bullet>>&, std::vector<std::unique_ptr<EnemyBullet>>&,
+        std::vector<std::unique_ptr<PowerUp>>&, std::vector<Explosion>&,
+        std::unique_ptr<Boss>&, bool&, float, float);
+    template void GameplayManager::UpdateGameplay<HardProfile>(
+        std::vector<std::unique_ptr<Player>>&, std::vector<std::unique_ptr<Enemy>>&,
+        std::vector<std::unique_ptr<Bullet>>&, std::vector<std::unique_ptr<EnemyBullet>>&,
+        std::vector<std::unique_ptr<PowerUp>>&, std::vector<Explosion>&,
+        std::unique_ptr<Boss>&, bool&, float, float);
+
+    template void GameplayManager::SpawnEnemy<EasyProfile>(std::vector<std::unique_ptr<Enemy>>&);
+    template void GameplayManager::SpawnEnemy<MediumProfile>(std::vector<std::unique_ptr<Enemy>>&);
+    template void GameplayManager::SpawnEnemy<HardProfile>(std::vector<std::unique_ptr<Enemy>>&);
+
+} // namespace SpaceInvaders
\ No newline at end of file
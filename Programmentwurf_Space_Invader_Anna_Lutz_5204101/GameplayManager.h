@@ -8,6 +8,8 @@
 #include "Bullet.h"
 #include "EnemyBullet.h"
 #include "PowerUp.h"
+#include "EventBus.h"
+#include "SpatialIndex.h"
 #include <vector>
 #include <memory>
 
@@ -28,10 +30,15 @@ namespace SpaceInvaders {
      *
      * Zustndig fr:
      * - Kollisionserkennung
+     * - Homing-Raketen und Laser (Abfragen ueber einen SpatialIndex der Gegner)
      * - Object Spawning (Enemies, PowerUps, Boss)
      * - Game Object Updates
      * - Explosion-System
      *
+     * Kollisionen verffentlichen nur Ereignisse auf dem EventBus.
+     * Explosionen, Punkte und PowerUp-Drops hngen als Abonnenten daran
+     * und werden am Frame-Ende gesammelt ausgefhrt.
+     *
      * Entlastet Game.cpp erheblich von Implementierungsdetails.
      */
     class GameplayManager {
@@ -39,7 +46,8 @@ namespace SpaceInvaders {
         GameplayManager();
         ~GameplayManager() = default;
 
-        // === Update-Funktionen ===
+        // === Update-Funktionen (Profile = DifficultyProfile<...>) ===
+        template <typename Profile>
         void UpdateGameplay(
             std::vector<std::unique_ptr<Player>>& players,
             std::vector<std::unique_ptr<Enemy>>& enemies,
@@ -50,15 +58,20 @@ namespace SpaceInvaders {
             std::unique_ptr<Boss>& boss,
             bool& bossActive,
             float deltaTime,
-            float scaledDeltaTime,
-            Difficulty difficulty,
-            bool isMultiPlayer
+            float scaledDeltaTime
         );
 
+        // === Ereignisse ===
+        EventBus& GetEventBus();
+
         // === Spawning ===
-        void SpawnEnemy(std::vector<std::unique_ptr<Enemy>>& enemies, Difficulty difficulty);
-        void SpawnPowerUp(std::vector<std::unique_ptr<PowerUp>>& powerUps, Vector2 position, Difficulty difficulty);
+        template <typename Profile>
+        void SpawnEnemy(std::vector<std::unique_ptr<Enemy>>& enemies);
+        void SpawnPowerUp(std::vector<std::unique_ptr<PowerUp>>& powerUps, SimVector2 position);
         void SpawnBoss(std::unique_ptr<Boss>& boss, bool& bossActive, Difficulty difficulty);
+        void SpawnPlayerBullets(std::vector<std::unique_ptr<Player>>& players,
+            std::vector<std::unique_ptr<Bullet>>& bullets);
+        size_t GetSpawnCount() const;  // alle bisher erzeugten Objekte (fuer den Allokations-Check)
 
         // === Kollisionen ===
         void HandleAllCollisions(
@@ -67,22 +80,20 @@ namespace SpaceInvaders {
             std::vector<std::unique_ptr<Bullet>>& bullets,
             std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
             std::vector<std::unique_ptr<PowerUp>>& powerUps,
-            std::vector<Explosion>& explosions,
             std::unique_ptr<Boss>& boss,
-            bool bossActive,
-            bool isMultiPlayer
+            bool bossActive
         );
 
         // === Game Object Management ===
         void UpdateBullets(std::vector<std::unique_ptr<Bullet>>& bullets, float deltaTime);
         void UpdateEnemies(std::vector<std::unique_ptr<Enemy>>& enemies,
             std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
-            float deltaTime, Difficulty difficulty, bool bossActive);
+            float deltaTime, float bulletSpeed, bool bossActive);
         void UpdateEnemyBullets(std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets, float deltaTime);
         void UpdatePowerUps(std::vector<std::unique_ptr<PowerUp>>& powerUps, float deltaTime);
         void UpdateExplosions(std::vector<Explosion>& explosions, float deltaTime);
         void UpdateBoss(std::unique_ptr<Boss>& boss, std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
-            std::vector<std::unique_ptr<Player>>& players, bool& bossActive, float deltaTime);
+            bool& bossActive, float deltaTime);
 
         // === Cleanup ===
         void ClearAllGameObjects(
@@ -96,51 +107,109 @@ namespace SpaceInvaders {
         );
 
     private:
-        // === Kollisions-Hilfsfunktionen ===
+        // === Kollisions-Hilfsfunktionen (verffentlichen nur Ereignisse) ===
         void HandleBulletEnemyCollisions(
-            std::vector<std::unique_ptr<Player>>& players,
-            std::vector<std::unique_ptr<Enemy>>& enemies,
             std::vector<std::unique_ptr<Bullet>>& bullets,
-            std::vector<Explosion>& explosions,
-            std::vector<std::unique_ptr<PowerUp>>& powerUps,
-            Difficulty difficulty
+            std::vector<std::unique_ptr<Enemy>>& enemies
         );
 
         void HandleBulletBossCollisions(
-            std::vector<std::unique_ptr<Player>>& players,
             std::vector<std::unique_ptr<Bullet>>& bullets,
             std::unique_ptr<Boss>& boss
         );
 
         void HandlePlayerEnemyCollisions(
             std::vector<std::unique_ptr<Player>>& players,
-            std::vector<std::unique_ptr<Enemy>>& enemies,
-            bool isMultiPlayer
+            std::vector<std::unique_ptr<Enemy>>& enemies
         );
 
         void HandlePlayerBulletCollisions(
             std::vector<std::unique_ptr<Player>>& players,
-            std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets,
-            bool isMultiPlayer
+            std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets
         );
 
         void HandlePowerUpCollisions(
             std::vector<std::unique_ptr<Player>>& players,
-            std::vector<std::unique_ptr<PowerUp>>& powerUps,
-            bool& slowMotionActive,
-            float& slowMotionTimer
+            std::vector<std::unique_ptr<PowerUp>>& powerUps
+        );
+
+        // Sort-and-Sweep auf der x-Achse, sortiert beide Listen nach linker Kante
+        void HandleBulletCancellation(
+            std::vector<std::unique_ptr<Bullet>>& bullets,
+            std::vector<std::unique_ptr<EnemyBullet>>& enemyBullets
         );
 
+        void HitPlayer(std::vector<std::unique_ptr<Player>>& players, int playerId, HitCause cause);
+        void KillEnemy(Enemy& enemy, int playerId);
+        void HitBoss(Boss& boss, int playerId, Vector2 hitPosition);  // deaktiviert ihn beim letzten Treffer
+
+        // === Homing & Laser (vor der Bewegung, gegen die Gegner-Positionen des Tick-Beginns) ===
+        void UpdateGuidedBullets(
+            std::vector<std::unique_ptr<Bullet>>& bullets,
+            std::vector<std::unique_ptr<Enemy>>& enemies,
+            std::unique_ptr<Boss>& boss,
+            float deltaTime
+        );
+
+        void BuildEnemyIndex(
+            std::vector<std::unique_ptr<Enemy>>& enemies,
+            std::unique_ptr<Boss>& boss
+        );
+
+        void SteerHomingBullet(Bullet& bullet, float deltaTime);
+
+        void FireLaser(
+            Bullet& bullet,
+            std::vector<std::unique_ptr<Enemy>>& enemies,
+            std::unique_ptr<Boss>& boss,
+            float deltaTime
+        );
+
+        // === Abonnenten (laufen in EventBus::Dispatch) ===
+        void RegisterEventHandlers();
+        void OnEnemyKilled(const GameEvent& event);
+        void OnBossDefeated(const GameEvent& event);
+        void OnPlayerHit(const GameEvent& event);
+        void OnPowerUpCollected(const GameEvent& event);
+        void OnBulletCancelled(const GameEvent& event);
+
         // === PowerUp Anwendung ===
-        void ApplyPowerUpToPlayer(PowerUpType type, Player* player,
-            bool& slowMotionActive, float& slowMotionTimer);
+        void ApplyPowerUpToPlayer(PowerUpType type, Player* player);
 
         // === Hilfsfunktionen ===
         void CreateExplosion(std::vector<Explosion>& explosions, Vector2 position, float size);
-
-        // === Member Variables fr globale Effekte ===
-        bool* slowMotionActiveRef = nullptr;
-        float* slowMotionTimerRef = nullptr;
+        static Vector2 GetCenter(const SimRect& bounds);  // fuer Event-Positionen
+
+        // === Event-Bus ===
+        EventBus eventBus;
+
+        // === Objekte des laufenden Frames (fr die Abonnenten) ===
+        std::vector<std::unique_ptr<Player>>* framePlayers = nullptr;
+        std::vector<std::unique_ptr<PowerUp>>* framePowerUps = nullptr;
+        std::vector<Explosion>* frameExplosions = nullptr;
+        float frameDropChance = 0.0f;
+
+        // === Erzeugte Objekte (jedes kostet eine Allokation) ===
+        size_t spawnCount = 0;
+
+        // === Offene Intervalle des Sweeps (Kapazitaet bleibt zwischen Frames erhalten) ===
+        template <typename T>
+        struct SweepInterval {
+            SimRect bounds;  // kopiert, damit der Vergleich keinem Zeiger folgt
+            T* object;
+        };
+
+        std::vector<SweepInterval<Bullet>> sweepOpenBullets;
+        std::vector<SweepInterval<EnemyBullet>> sweepOpenEnemyBullets;
+
+        // === Raeumlicher Index der Gegner (Id = Index in enemies, Boss zuletzt) ===
+        SpatialIndex enemyIndex;
+        int32_t bossIndexId = -1;
+        std::vector<SpatialIndex::Neighbor> nearestTargets;
+
+        // === Constants ===
+        static const int BOSS_SCORE_BONUS = 500;
+        static const int HOMING_CANDIDATES = 4;  // naechste Ziele, aus denen das erste vor der Rakete gewaehlt wird
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "HeadlessMatch.h"
+#include "DifficultyProfile.h"
+#include "GameRandom.h"
+
+namespace SpaceInvaders {
+
+    // === Konstruktor & Destruktor ===
+    HeadlessMatch::HeadlessMatch(const MatchSettings& settings)
+        : settings(settings)
+        , bossActive(false)
+        , slowMotionActive(false)
+        , slowMotionTimer(TimerWheel::INVALID_HANDLE)
+        , gameTime(0.0f)
+    {
+        EventBus& events = gameplayManager.GetEventBus();
+
+        // Gezaehlt wird wie im StatisticsCollector, nur synchron
+        events.Subscribe(EVENT_ENEMY_KILLED, [this](const GameEvent& event) {
+            if (event.playerId >= 0) result.enemiesKilled++;
+        });
+        events.Subscribe(EVENT_BOSS_DEFEATED, [this](const GameEvent&) {
+            result.bossesDefeated++;
+        });
+        events.Subscribe(EVENT_POWERUP_COLLECTED, [this](const GameEvent& event) {
+            if (event.value == POWERUP_SLOWMO) {
+                StartSlowMotion(GameConfig::POWERUP_DURATION);
+            }
+        });
+    }
+
+    HeadlessMatch::~HeadlessMatch() {
+        ReleaseGameObjects();
+    }
+
+    // === Simulation ===
+    MatchResult HeadlessMatch::Run() {
+        GameConfig::SetBalanceOverride(&settings.balance);
+        GameRandom::Seed(settings.seed);
+
+        Setup();
+
+        // Einzige Auswertung des Schwierigkeitsgrads pro Partie
+        DispatchDifficulty(settings.difficulty, [this](auto profile) {
+            Simulate<decltype(profile)>();
+        });
+
+        result.survivalTime = gameTime;
+        result.score = players[0]->GetScore();
+        result.timedOut = players[0]->GetLives() > 0;
+
+        ReleaseGameObjects();
+        GameConfig::SetBalanceOverride(nullptr);
+        return result;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void HeadlessMatch::Setup() {
+        // Reste einer vorherigen Partie auf diesem Thread verwerfen
+        TimerWheel::GetGameTimers().Clear();
+        TimerWheel::GetWorldTimers().Clear();
+
+        Vector2 startPos = {
+            GameConfig::SCREEN_WIDTH / 2 - Player::AVATAR_WIDTH / 2,
+            GameConfig::SCREEN_HEIGHT - Player::AVATAR_HEIGHT - 20
+        };
+
+        auto player = std::make_unique<Player>(settings.avatar, ToSimVector2(startPos));
+        player->SetName("Bot");
+        player->ApplyStartMod(settings.mod);
+        players.push_back(std::move(player));
+
+        if (settings.mod == MOD_SLOWMO) {
+            StartSlowMotion(GameConfig::POWERUP_DURATION);
+        }
+    }
+
+    void HeadlessMatch::StartSlowMotion(float duration) {
+        auto& timers = TimerWheel::GetGameTimers();
+        timers.Cancel(slowMotionTimer);
+
+        slowMotionActive = true;
+        slowMotionTimer = timers.Schedule(duration, [this]() {
+            slowMotionActive = false;
+            slowMotionTimer = TimerWheel::INVALID_HANDLE;
+        });
+    }
+
+    void HeadlessMatch::ReleaseGameObjects() {
+        gameplayManager.ClearAllGameObjects(enemies, bullets, enemyBullets, powerUps, explosions, boss, bossActive);
+        players.clear();
+
+        // Ausstehende Timer zeigen auf diese Instanz
+        TimerWheel::GetGameTimers().Clear();
+        TimerWheel::GetWorldTimers().Clear();
+    }
+
+    // === Simulation pro Schwierigkeitsgrad ===
+    template <typename Profile>
+    void HeadlessMatch::Simulate() {
+        ScheduleEnemySpawn<Profile>();
+        ScheduleBossSpawn<Profile>();
+
+        const float deltaTime = 1.0f / GameConfig::SIMULATION_TICK_RATE;
+        while (players[0]->GetLives() > 0 && gameTime < settings.maxDuration) {
+            Step<Profile>(deltaTime);
+        }
+    }
+
+    template <typename Profile>
+    void HeadlessMatch::Step(float deltaTime) {
+        // Gleiche Reihenfolge wie Game::UpdateGameplay
+        TimerWheel::GetGameTimers().Advance(deltaTime);
+
+        float timeScale = slowMotionActive ? GameConfig::SLOWMOTION_TIME_SCALE : 1.0f;
+        float scaledDeltaTime = deltaTime * timeScale;
+        TimerWheel::GetWorldTimers().Advance(scaledDeltaTime);
+        gameTime += deltaTime;
+
+        Player& player = *players[0];
+        BotInput input = bot.DecideInput(player, enemies, enemyBullets, boss.get(),
+            Profile::VALUES.playerMovementSpeed, deltaTime);
+
+        player.HandleInput(input.left, input.right, input.shoot, deltaTime);
+        player.Update<Profile>();
+        gameplayManager.SpawnPlayerBullets(players, bullets);
+
+        gameplayManager.UpdateGameplay<Profile>(players, enemies, bullets, enemyBullets, powerUps, explosions,
+            boss, bossActive, deltaTime, scaledDeltaTime);
+    }
+
+    template <typename Profile>
+    void HeadlessMatch::ScheduleEnemySpawn() {
+        TimerWheel::GetGameTimers().Schedule(Profile::EnemySpawnInterval(), [this]() {
+            if (!bossActive) {
+                gameplayManager.SpawnEnemy<Profile>(enemies);
+            }
+            ScheduleEnemySpawn<Profile>();
+        });
+    }
+
+    template <typename Profile>
+    void HeadlessMatch::ScheduleBossSpawn() {
+        TimerWheel::GetGameTimers().Schedule(Profile::VALUES.bossSpawnTime, [this]() {
+            if (!bossActive) {
+                gameplayManager.SpawnBoss(boss, bossActive, Profile::DIFFICULTY);
+            }
+            ScheduleBossSpawn<Profile>();
+        });
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "raylib.h"
+#include "GameConfig.h"
+#include "GameplayManager.h"
+#include "BotController.h"
+#include "TimerWheel.h"
+#include <vector>
+#include <memory>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Einstellungen einer kopflosen Partie
+     */
+    struct MatchSettings {
+        AvatarType avatar = AVATAR_BLUE;
+        ModType mod = MOD_NONE;
+        Difficulty difficulty = DIFF_MEDIUM;
+        GameConfig::BalanceParameters balance = GameConfig::GetDefaultBalance(DIFF_MEDIUM);
+        unsigned int seed = 1;
+        float maxDuration = 600.0f;  // Abbruch, falls der Bot nicht verliert
+    };
+
+    /**
+     * @brief Ergebnis einer kopflosen Partie
+     */
+    struct MatchResult {
+        float survivalTime = 0.0f;
+        int score = 0;
+        int enemiesKilled = 0;
+        int bossesDefeated = 0;
+        bool timedOut = false;
+    };
+
+    /**
+     * @brief Singleplayer-Partie ohne Fenster, Rendering und Save-System
+     *
+     * Nutzt denselben GameplayManager wie Game, gesteuert von einem
+     * BotController mit festem Zeitschritt. Die TimerWheels und Balancing-
+     * Overrides sind thread-lokal, daher kann jeder Worker-Thread seine
+     * eigene Partie simulieren. Eine Instanz spielt genau eine Partie.
+     */
+    class HeadlessMatch {
+    public:
+        // === Konstruktor & Destruktor ===
+        explicit HeadlessMatch(const MatchSettings& settings);
+        ~HeadlessMatch();
+        HeadlessMatch(const HeadlessMatch&) = delete;
+        HeadlessMatch& operator=(const HeadlessMatch&) = delete;
+
+        // === Simulation ===
+        MatchResult Run();
+
+    private:
+        // === Private Hilfsfunktionen ===
+        void Setup();
+        void StartSlowMotion(float duration);
+        void ReleaseGameObjects();
+
+        // === Simulation pro Schwierigkeitsgrad (Profile = DifficultyProfile<...>) ===
+        template <typename Profile> void Simulate();
+        template <typename Profile> void Step(float deltaTime);
+        template <typename Profile> void ScheduleEnemySpawn();
+        template <typename Profile> void ScheduleBossSpawn();
+
+        // === Einstellungen & Systeme ===
+        MatchSettings settings;
+        GameplayManager gameplayManager;
+        BotController bot;
+
+        // === Game Objects ===
+        std::vector<std::unique_ptr<Player>> players;
+        std::vector<std::unique_ptr<Enemy>> enemies;
+        std::vector<std::unique_ptr<Bullet>> bullets;
+        std::vector<std::unique_ptr<EnemyBullet>> enemyBullets;
+        std::vector<std::unique_ptr<PowerUp>> powerUps;
+        std::vector<Explosion> explosions;
+        std::unique_ptr<Boss> boss;
+        bool bossActive;
+
+        // === Zustand ===
+        bool slowMotionActive;
+        TimerWheel::Handle slowMotionTimer;
+        float gameTime;
+        MatchResult result;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "InitGraph.h"
+#include "Tracer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace SpaceInvaders {
+
+    // === Konstruktor ===
+    InitGraph::InitGraph()
+        : startTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    // === Aufbau ===
+    int InitGraph::AddStep(const char* name, InitThread thread, std::initializer_list<int> dependencies, StepFunction function) {
+        // Ungueltige Abhaengigkeit: Schritt gilt als fehlgeschlagen, seine Abhaengigen werden uebersprungen
+        for (int dependency : dependencies) {
+            if (dependency < 0 || dependency >= (int)steps.size()) {
+                Logger::Error("InitGraph: Schritt '%s' haengt von unbekanntem Schritt %d ab", name, dependency);
+                steps.push_back({ name, thread, {}, std::move(function), STEP_FAILED, 0.0f, 0.0f });
+                return (int)steps.size() - 1;
+            }
+        }
+
+        steps.push_back({ name, thread, dependencies, std::move(function), STEP_PENDING, 0.0f, 0.0f });
+        return (int)steps.size() - 1;
+    }
+
+    // === Ausfuehrung ===
+    bool InitGraph::Run() {
+        TraceScope trace("InitGraph::Run");
+        startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true) {
+            int mainStep = -1;
+            bool unfinished = false;
+
+            // Abhaengigkeiten zeigen nur nach vorn, ein Durchlauf reicht fuer das Ueberspringen ganzer Ketten
+            for (int i = 0; i < (int)steps.size(); i++) {
+                Step& step = steps[i];
+
+                if (step.state == STEP_PENDING && HasFailedDependency(step)) {
+                    step.state = STEP_SKIPPED;
+                    Logger::Warning("InitGraph: '%s' uebersprungen (Abhaengigkeit fehlgeschlagen)", step.name);
+                    continue;
+                }
+
+                if (step.state == STEP_PENDING && IsReady(step)) {
+                    if (step.thread == INIT_WORKER_THREAD) {
+                        step.state = STEP_RUNNING;
+                        workers.emplace_back([this, i]() { Execute(i); });
+                    }
+                    else if (mainStep < 0) {
+                        mainStep = i;
+                    }
+                }
+
+                if (step.state == STEP_PENDING || step.state == STEP_RUNNING) {
+                    unfinished = true;
+                }
+            }
+
+            if (!unfinished) break;
+
+            // Haupt-Thread-Schritte direkt ausfuehren, sonst auf den naechsten fertigen Worker warten
+            if (mainStep >= 0) {
+                steps[mainStep].state = STEP_RUNNING;
+                lock.unlock();
+                Execute(mainStep);
+                lock.lock();
+            }
+            else {
+                stepFinished.wait(lock);
+            }
+        }
+
+        lock.unlock();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        return std::all_of(steps.begin(), steps.end(),
+            [](const Step& step) { return step.state == STEP_DONE; });
+    }
+
+    // === Zeitleiste ===
+    void InitGraph::LogTimeline() const {
+        float totalMs = 0.0f;
+        Logger::Info("Start-Zeitleiste:");
+        for (const Step& step : steps) {
+            Logger::Info("  %-20s %8.1f .. %8.1f ms  %-6s %s", step.name, step.startMs, step.endMs,
+                step.thread == INIT_MAIN_THREAD ? "Haupt" : "Worker", GetStateName(step.state));
+            totalMs = std::max(totalMs, step.endMs);
+        }
+        Logger::Info("Start-Zeitleiste gesamt: %.1f ms", totalMs);
+    }
+
+    // === Private Hilfsfunktionen ===
+    bool InitGraph::IsReady(const Step& step) const {
+        for (int dependency : step.dependencies) {
+            if (steps[dependency].state != STEP_DONE) return false;
+        }
+        return true;
+    }
+
+    bool InitGraph::HasFailedDependency(const Step& step) const {
+        for (int dependency : step.dependencies) {
+            if (steps[dependency].state == STEP_FAILED || steps[dependency].state == STEP_SKIPPED) return true;
+        }
+        return false;
+    }
+
+    float InitGraph::ElapsedMs() const {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    const char* InitGraph::GetStateName(StepState state) {
+        switch (state) {
+        case STEP_DONE:    return "ok";
+        case STEP_FAILED:  return "FEHLER";
+        case STEP_SKIPPED: return "uebersprungen";
+        default:           return "offen";
+        }
+    }
+
+    void InitGraph::Execute(int index) {
+        Step& step = steps[index];
+        if (step.thread == INIT_WORKER_THREAD) {
+            Tracer::GetInstance().SetThreadName(step.name);
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            step.startMs = ElapsedMs();
+        }
+
+        bool succeeded = false;
+        {
+            TraceScope trace("InitGraph::Step", step.name);
+            try {
+                succeeded = step.function();
+            }
+            catch (const std::exception& e) {
+                Logger::Error("InitGraph: '%s' abgebrochen: %s", step.name, e.what());
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            step.endMs = ElapsedMs();
+            step.state = succeeded ? STEP_DONE : STEP_FAILED;
+        }
+        stepFinished.notify_all();
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Thread, auf dem ein Startschritt laufen muss
+     */
+    enum InitThread {
+        INIT_MAIN_THREAD,    // Fenster, OpenGL-Uploads, alles mit raylib-Kontext
+        INIT_WORKER_THREAD   // reine CPU- oder Datei-Arbeit
+    };
+
+    /**
+     * @brief Abhaengigkeitsgraph fuer den Programmstart
+     *
+     * Jeder Schritt nennt die Schritte, die vor ihm fertig sein muessen.
+     * Run startet alle Worker-Schritte auf eigenen Threads, sobald ihre
+     * Abhaengigkeiten erfuellt sind, und fuehrt die Haupt-Thread-Schritte
+     * in der Zwischenzeit auf dem aufrufenden Thread aus. So laufen z.B.
+     * Spielstand und Textur-Dekodierung parallel zum Fensteraufbau.
+     *
+     * Schlaegt ein Schritt fehl, werden alle davon abhaengigen Schritte
+     * uebersprungen. Abhaengigkeiten zeigen immer auf frueher hinzugefuegte
+     * Schritte, Zyklen sind damit ausgeschlossen.
+     */
+    class InitGraph {
+    public:
+        using StepFunction = std::function<bool()>;
+
+        // === Konstruktor ===
+        InitGraph();
+
+        // === Aufbau ===
+        int AddStep(const char* name, InitThread thread, std::initializer_list<int> dependencies, StepFunction function);
+
+        // === Ausfuehrung (blockiert, bis alle Schritte fertig oder uebersprungen sind) ===
+        bool Run();
+
+        // === Zeitleiste ===
+        void LogTimeline() const;
+
+    private:
+        enum StepState {
+            STEP_PENDING,
+            STEP_RUNNING,
+            STEP_DONE,
+            STEP_FAILED,
+            STEP_SKIPPED
+        };
+
+        struct Step {
+            const char* name;
+            InitThread thread;
+            std::vector<int> dependencies;
+            StepFunction function;
+            StepState state;
+            float startMs;
+            float endMs;
+        };
+
+        std::vector<Step> steps;
+        std::chrono::steady_clock::time_point startTime;
+
+        std::mutex mutex;
+        std::condition_variable stepFinished;
+
+        // === Private Hilfsfunktionen ===
+        bool IsReady(const Step& step) const;
+        bool HasFailedDependency(const Step& step) const;
+        float ElapsedMs() const;
+        static const char* GetStateName(StepState state);
+        void Execute(int index);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -4,8 +4,58 @@
 
 namespace SpaceInvaders {
 
+    // === Konstruktor ===
+    InputManager::InputManager()
+        : snapshot{}
+    {
+    }
+
+    // === Abtastung ===
+    void InputManager::Sample(float deltaTime) {
+        InputSnapshot next = {};
+        next.frame = snapshot.frame + 1;
+        next.timestamp = GetTime();
+        next.deltaTime = deltaTime;
+
+        for (int slot = 0; slot < TRACKED_KEY_COUNT; slot++) {
+            if (::IsKeyDown(TRACKED_KEYS[slot])) next.keysDown |= 1u << slot;
+            if (::IsKeyPressed(TRACKED_KEYS[slot])) next.keysPressed |= 1u << slot;
+        }
+
+        next.mousePosition = ::GetMousePosition();
+        next.mouseDown = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+        next.mousePressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+        next.closeRequested = WindowShouldClose();
+
+        // Zeichen-Warteschlange jeden Frame leeren, sonst tauchen alte Eingaben spter im Namensfeld auf
+        int key = GetCharPressed();
+        while (key > 0) {
+            if (key >= 32 && key <= 125 && next.textLength < InputSnapshot::TEXT_CAPACITY) {
+                next.text[next.textLength++] = (char)key;
+            }
+            key = GetCharPressed();
+        }
+
+        snapshot = next;
+    }
+
+    const InputSnapshot& InputManager::GetSnapshot() const {
+        return snapshot;
+    }
+
+    // === Einzelne Tasten ===
+    bool InputManager::IsKeyDown(int key) const {
+        int slot = GetKeySlot(key);
+        return slot >= 0 && (snapshot.keysDown & (1u << slot)) != 0;
+    }
+
+    bool InputManager::IsKeyPressed(int key) const {
+        int slot = GetKeySlot(key);
+        return slot >= 0 && (snapshot.keysPressed & (1u << slot)) != 0;
+    }
+
     // === Navigation Input ===
-    InputManager::NavInput InputManager::GetNavigationInput() {
+    InputManager::NavInput InputManager::GetNavigationInput() const {
         // Tastatur-Navigation
         if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) return NAV_UP;
         if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) return NAV_DOWN;
@@ -18,7 +68,7 @@ namespace SpaceInvaders {
     }
 
     // === Player 1 Input (Pfeiltasten) ===
-    InputManager::PlayerInput InputManager::GetPlayer1Input() {
+    InputManager::PlayerInput InputManager::GetPlayer1Input() const {
         if (IsKeyDown(KEY_LEFT)) return PLAYER_LEFT;
         if (IsKeyDown(KEY_RIGHT)) return PLAYER_RIGHT;
         if (IsKeyDown(KEY_UP) || IsKeyPressed(KEY_UP)) return PLAYER_SHOOT;
@@ -26,7 +76,7 @@ namespace SpaceInvaders {
     }
 
     // === Player 2 Input (WASD) ===
-    InputManager::PlayerInput InputManager::GetPlayer2Input() {
+    InputManager::PlayerInput InputManager::GetPlayer2Input() const {
         if (IsKeyDown(KEY_A)) return PLAYER_LEFT;
         if (IsKeyDown(KEY_D)) return PLAYER_RIGHT;
         if (IsKeyDown(KEY_W) || IsKeyPressed(KEY_W)) return PLAYER_SHOOT;
@@ -34,75 +84,94 @@ namespace SpaceInvaders {
     }
 
     // === Maus-Untersttzung ===
-    bool InputManager::IsMouseOverRectangle(Rectangle rect) {
-        Vector2 mousePos = GetMousePosition();
-        return CheckCollisionPointRec(mousePos, rect);
+    bool InputManager::IsMouseOverRectangle(Rectangle rect) const {
+        return CheckCollisionPointRec(snapshot.mousePosition, rect);
+    }
+
+    bool InputManager::IsMouseClicked() const {
+        return snapshot.mousePressed;
     }
 
-    bool InputManager::IsMouseClicked() {
-        return IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+    bool InputManager::IsMouseDown() const {
+        return snapshot.mouseDown;
     }
 
-    Vector2 InputManager::GetMousePosition() {
-        return ::GetMousePosition();
+    Vector2 InputManager::GetMousePosition() const {
+        return snapshot.mousePosition;
     }
 
     // === Key Hold/Repeat System ===
     bool InputManager::IsKeyPressedOrHeld(int key, float holdDelay, float repeatRate) {
-        if (key < 0 || key >= 512) return false;
+        int slot = GetKeySlot(key);
+        if (slot < 0) return false;
 
         bool keyDown = IsKeyDown(key);
         bool keyPressed = IsKeyPressed(key);
 
         if (keyPressed) {
-            keyHoldTimers[key] = 0.0f;
-            keyRepeatTimers[key] = 0.0f;
-            keyHeldStates[key] = true;
+            keyHoldTimers[slot] = 0.0f;
+            keyRepeatTimers[slot] = 0.0f;
+            keyHeldStates[slot] = true;
             return true;
         }
 
-        if (keyDown && keyHeldStates[key]) {
-            keyHoldTimers[key] += GetFrameTime();
+        if (keyDown && keyHeldStates[slot]) {
+            keyHoldTimers[slot] += snapshot.deltaTime;
 
-            if (keyHoldTimers[key] >= holdDelay) {
-                keyRepeatTimers[key] += GetFrameTime();
+            if (keyHoldTimers[slot] >= holdDelay) {
+                keyRepeatTimers[slot] += snapshot.deltaTime;
 
-                if (keyRepeatTimers[key] >= repeatRate) {
-                    keyRepeatTimers[key] = 0.0f;
+                if (keyRepeatTimers[slot] >= repeatRate) {
+                    keyRepeatTimers[slot] = 0.0f;
                     return true;
                 }
             }
         }
         else {
-            keyHoldTimers[key] = 0.0f;
-            keyRepeatTimers[key] = 0.0f;
-            keyHeldStates[key] = false;
+            keyHoldTimers[slot] = 0.0f;
+            keyRepeatTimers[slot] = 0.0f;
+            keyHeldStates[slot] = false;
         }
 
         return false;
     }
 
     // === Spezielle Tasten ===
-    bool InputManager::IsPausePressed() {
+    bool InputManager::IsPausePressed() const {
         return IsKeyPressed(KEY_P);
     }
 
-    bool InputManager::IsExitPressed() {
-        return WindowShouldClose() || IsKeyPressed(KEY_ESCAPE);
+    bool InputManager::IsExitPressed() const {
+        return snapshot.closeRequested || IsKeyPressed(KEY_ESCAPE);
+    }
+
+    // === Diagnose ===
+    bool InputManager::IsDebugOverlayPressed() const {
+        return IsKeyPressed(KEY_F3);
+    }
+
+    bool InputManager::IsMemoryReportPressed() const {
+        return IsKeyPressed(KEY_F4);
+    }
+
+    bool InputManager::IsRewindPressed() const {
+        return IsKeyPressed(KEY_F9);
+    }
+
+    bool InputManager::IsResumeRunPressed() const {
+        return IsKeyPressed(KEY_C);
     }
 
     // === Text-Eingabe ===
-    bool InputManager::GetTextInput(std::string& text, int maxLength) {
+    bool InputManager::GetTextInput(std::string& text, int maxLength) const {
         bool textChanged = false;
 
-        int key = GetCharPressed();
-        while (key > 0) {
-            // Druckbare Zeichen hinzufgen
-            if ((key >= 32) && (key <= 125) && text.length() < maxLength) {
-                text += (char)key;
+        // Druckbare Zeichen hinzufgen (schon beim Abtasten gefiltert)
+        for (int i = 0; i < snapshot.textLength; i++) {
+            if (text.length() < (size_t)maxLength) {
+                text += snapshot.text[i];
                 textChanged = true;
             }
-            key = GetCharPressed();
         }
 
         // Backspace behandeln
@@ -114,27 +183,29 @@ namespace SpaceInvaders {
         return textChanged;
     }
 
-    void InputManager::ResetTextInput() {
-        currentTextInput.clear();
+    // === Private Hilfsfunktionen ===
+    int InputManager::GetKeySlot(int key) {
+        for (int slot = 0; slot < TRACKED_KEY_COUNT; slot++) {
+            if (TRACKED_KEYS[slot] == key) return slot;
+        }
+        return -1;
     }
 
     // === Animierte Button-Funktion ===
-    bool UpdateAnimatedButton(Rectangle rect, ButtonState& state,
-        Color baseColor, Color hoverColor, Color pressedColor,
-        float deltaTime) {
+    bool UpdateAnimatedButton(const InputManager& input, Rectangle rect, ButtonState& state,
+        Color baseColor, Color hoverColor, Color pressedColor) {
 
-        InputManager inputManager;
-        bool mouseOver = inputManager.IsMouseOverRectangle(rect);
-        bool mouseClicked = inputManager.IsMouseClicked();
+        bool mouseOver = input.IsMouseOverRectangle(rect);
+        bool mouseClicked = input.IsMouseClicked();
 
         // State Update
         state.isHovered = mouseOver;
-        state.isPressed = mouseOver && IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+        state.isPressed = mouseOver && input.IsMouseDown();
 
         // Animation der Skalierung (smooth lerp)
         float targetScale = mouseOver ? 1.1f : 1.0f;
         float lerpSpeed = 8.0f;
-        state.hoverScale += (targetScale - state.hoverScale) * lerpSpeed * deltaTime;
+        state.hoverScale += (targetScale - state.hoverScale) * lerpSpeed * input.GetSnapshot().deltaTime;
 
         // Farb-Animation
         if (state.isPressed) {
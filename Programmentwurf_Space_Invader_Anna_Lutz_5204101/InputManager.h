@@ -1,7 +1,9 @@
 #pragma once
 
 #include "raylib.h"
+#include <cstdint>
 #include <string>
+#include <type_traits>
 
 namespace SpaceInvaders {
 
@@ -15,11 +17,53 @@ namespace SpaceInvaders {
         Color currentColor = WHITE;
     };
 
+    // === Tasten, die das Spiel abfragt (Bit-Index im Snapshot = Position in der Liste) ===
+    inline constexpr int TRACKED_KEYS[] = {
+        KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT,
+        KEY_W, KEY_A, KEY_S, KEY_D,
+        KEY_ENTER, KEY_SPACE, KEY_ESCAPE, KEY_BACKSPACE,
+        KEY_P, KEY_M, KEY_C,
+        KEY_F3, KEY_F4, KEY_F9
+    };
+
+    inline constexpr int TRACKED_KEY_COUNT = sizeof(TRACKED_KEYS) / sizeof(TRACKED_KEYS[0]);
+    static_assert(TRACKED_KEY_COUNT <= 32, "Tastenmasken im InputSnapshot sind 32 Bit breit");
+
+    /**
+     * @brief Alle Eingaben eines Frames, einmal abgetastet und danach unvernderlich
+     *
+     * POD mit fester Gre, damit Eingaben spter unverndert aufgezeichnet
+     * und wieder abgespielt werden knnen.
+     */
+    struct InputSnapshot {
+        static constexpr int TEXT_CAPACITY = 16;
+
+        uint64_t frame;
+        double timestamp;          // GetTime() bei der Abtastung
+        float deltaTime;
+        uint32_t keysDown;         // Bit i = TRACKED_KEYS[i]
+        uint32_t keysPressed;
+        Vector2 mousePosition;
+        bool mouseDown;            // linke Maustaste
+        bool mousePressed;
+        bool closeRequested;       // Fenster soll geschlossen werden
+        uint8_t textLength;
+        char text[TEXT_CAPACITY];  // in diesem Frame getippte Zeichen (ASCII 32..125)
+    };
+
+    static_assert(std::is_trivially_copyable<InputSnapshot>::value, "InputSnapshot muss kopierbar bleiben");
+
     /**
      * @brief Zentrale Klasse fr einheitliche Input-Behandlung (Tastatur + Maus)
      *
-     * Der InputManager ermglicht es, sowohl Tastatur- als auch Maus-Eingaben
-     * einheitlich zu behandeln und stellt Hilfsfunktionen fr Men-Navigation bereit.
+     * Game ruft Sample() einmal zu Beginn jedes Frames auf, danach lesen alle
+     * Konsumenten (Game, Mens, Avatar- und Mod-Auswahl, Buttons) nur noch
+     * aus demselben Snapshot. Jede Abfrage ist damit im ganzen Frame gleich,
+     * egal wie oft und von wem sie gestellt wird, und raylib wird pro Frame
+     * genau einmal befragt.
+     *
+     * Abgetastet werden nur die TRACKED_KEYS, andere Tasten gelten als
+     * nicht gedrckt.
      */
     class InputManager {
     public:
@@ -43,46 +87,62 @@ namespace SpaceInvaders {
         };
 
         // === Konstruktor ===
-        InputManager() = default;
+        InputManager();
+
+        // === Abtastung (einmal pro Frame, vor allen Konsumenten) ===
+        void Sample(float deltaTime);
+        const InputSnapshot& GetSnapshot() const;
+
+        // === Einzelne Tasten (nur TRACKED_KEYS) ===
+        bool IsKeyDown(int key) const;
+        bool IsKeyPressed(int key) const;
 
         // === Navigation Input (fr Mens) ===
-        NavInput GetNavigationInput();
+        NavInput GetNavigationInput() const;
 
         // === Player Input (fr Gameplay) ===
-        PlayerInput GetPlayer1Input();
-        PlayerInput GetPlayer2Input();
+        PlayerInput GetPlayer1Input() const;
+        PlayerInput GetPlayer2Input() const;
 
         // === Maus-Untersttzung fr Mens ===
-        bool IsMouseOverRectangle(Rectangle rect);
-        bool IsMouseClicked();
-        Vector2 GetMousePosition();
+        bool IsMouseOverRectangle(Rectangle rect) const;
+        bool IsMouseClicked() const;
+        bool IsMouseDown() const;
+        Vector2 GetMousePosition() const;
 
         // === Spezielle Input-Funktionen ===
         bool IsKeyPressedOrHeld(int key, float holdDelay = 0.5f, float repeatRate = 0.1f);
-        bool IsPausePressed();
-        bool IsExitPressed();
+        bool IsPausePressed() const;
+        bool IsExitPressed() const;
+        bool IsResumeRunPressed() const;
+
+        // === Diagnose ===
+        bool IsDebugOverlayPressed() const;
+        bool IsMemoryReportPressed() const;
+        bool IsRewindPressed() const;
 
         // === Text-Eingabe ===
-        bool GetTextInput(std::string& text, int maxLength = 10);
-        void ResetTextInput();
+        bool GetTextInput(std::string& text, int maxLength = 10) const;
 
     private:
-        // === Timer fr Key-Repeat ===
-        float keyHoldTimers[512] = { 0 };
-        float keyRepeatTimers[512] = { 0 };
-        bool keyHeldStates[512] = { false };
+        // === Aktueller Snapshot ===
+        InputSnapshot snapshot;
+
+        // === Timer fr Key-Repeat (Index wie TRACKED_KEYS) ===
+        float keyHoldTimers[TRACKED_KEY_COUNT] = { 0 };
+        float keyRepeatTimers[TRACKED_KEY_COUNT] = { 0 };
+        bool keyHeldStates[TRACKED_KEY_COUNT] = { false };
 
-        // === Text-Eingabe State ===
-        std::string currentTextInput = "";
+        // === Private Hilfsfunktionen ===
+        static int GetKeySlot(int key);  // -1 = nicht abgetastet
     };
 
     /**
-     * @brief Hilfsfunktion fr animierte Buttons
+     * @brief Hilfsfunktion fr animierte Buttons (liest Maus und deltaTime aus dem Snapshot)
      */
-    bool UpdateAnimatedButton(Rectangle rect, ButtonState& state,
+    bool UpdateAnimatedButton(const InputManager& input, Rectangle rect, ButtonState& state,
         Color baseColor = WHITE,
         Color hoverColor = YELLOW,
-        Color pressedColor = ORANGE,
-        float deltaTime = 0.0f);
+        Color pressedColor = ORANGE);
 
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,308 @@
+#include "Logger.h"
+#include "EventBus.h"
+#include "GameConfig.h"
+#include "Tracer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        const char* const levelPrefixes[] = { "[DEBUG]", "[INFO]", "[WARNUNG]", "[FEHLER]" };
+
+        uint32_t HashMessage(const char* text) {
+            // FNV-1a
+            uint32_t hash = 2166136261u;
+            for (const char* c = text; *c; c++) {
+                hash = (hash ^ (uint8_t)*c) * 16777619u;
+            }
+            return hash;
+        }
+
+        // Log-Kanal des aktuellen Threads (bleibt bis Programmende gueltig)
+        thread_local void* currentThreadLog = nullptr;
+
+    } // namespace
+
+    /**
+     * @brief Kanal und Drosselungs-Zustand eines schreibenden Threads
+     *
+     * Der besitzende Thread haelt mutex waehrend Dedup, Rate-Limit und
+     * Push. Der Ausgabe-Thread nimmt ihn pro Durchlauf kurz, um offene
+     * Wiederholungs-Zaehler nachzutragen; beim Shutdown dient er als
+     * Sperre gegen Meldungen, die noch in den Kanal unterwegs sind.
+     */
+    struct Logger::ThreadLog {
+        struct DedupEntry {
+            uint32_t hash = 0;
+            float windowStart = 0.0f;
+            uint32_t suppressed = 0;
+            LogLevel level = LOG_INFO;
+            char message[sizeof(LogRecord::message)] = {};
+
+            // Offenen Wiederholungs-Zaehler als eigene Zeile herausgeben
+            bool TakeRepeatSummary(float time, LogRecord& summary) {
+                if (suppressed == 0) return false;
+
+                summary.level = level;
+                summary.suppressed = suppressed;
+                summary.rateLimited = 0;
+                summary.time = time;
+                std::memcpy(summary.message, message, sizeof(summary.message));
+                suppressed = 0;
+                return true;
+            }
+        };
+
+        std::mutex mutex;
+        SpscChannel<LogRecord, CHANNEL_CAPACITY> channel;
+        DedupEntry dedup[DEDUP_SLOTS];
+
+        // Token-Bucket fuer das Rate-Limit
+        float tokens = (float)GameConfig::LOG_RATE_LIMIT;
+        float lastRefill = 0.0f;
+        uint32_t rateLimited = 0;
+    };
+
+    // === Singleton ===
+    Logger& Logger::GetInstance() {
+        // Absichtlich nie zerstoert: statische Destruktoren anderer Singletons loggen noch
+        static Logger* instance = new Logger();
+        return *instance;
+    }
+
+    Logger::Logger()
+        : minimumLevel(LOG_INFO)
+        , running(true)
+        , synchronous(false)
+        , writtenCount(0)
+        , startTime(std::chrono::steady_clock::now())
+    {
+#ifdef _DEBUG
+        minimumLevel.store(LOG_DEBUG);
+#endif
+        sink = std::thread(&Logger::Run, this);
+
+        // Beim Programmende alles Eingereihte ausgeben
+        std::atexit([] { GetInstance().Shutdown(); });
+    }
+
+    Logger::~Logger() {
+        Shutdown();
+    }
+
+    // === Meldungen ===
+    void Logger::Debug(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        GetInstance().Log(LOG_DEBUG, format, args);
+        va_end(args);
+    }
+
+    void Logger::Info(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        GetInstance().Log(LOG_INFO, format, args);
+        va_end(args);
+    }
+
+    void Logger::Warning(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        GetInstance().Log(LOG_WARNING, format, args);
+        va_end(args);
+    }
+
+    void Logger::Error(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        GetInstance().Log(LOG_ERROR, format, args);
+        va_end(args);
+    }
+
+    // === Steuerung ===
+    void Logger::SetMinimumLevel(LogLevel level) {
+        minimumLevel.store(level);
+    }
+
+    void Logger::Flush() {
+        if (synchronous.load()) return;
+
+        // Warten, bis der Ausgabe-Thread alles bisher Eingereihte geschrieben hat
+        size_t pushed = 0;
+        {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            for (const auto& threadLog : threadLogs) {
+                pushed += threadLog->channel.GetPushedCount();
+            }
+        }
+
+        while (writtenCount.load(std::memory_order_acquire) < pushed && running.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void Logger::Shutdown() {
+        if (!running.exchange(false)) return;
+
+        // Zuerst umschalten: ab jetzt schreibt jeder Aufruf direkt, Drain()
+        // wartet pro Kanal auf Meldungen, die den alten Modus noch gesehen haben
+        synchronous.store(true);
+
+        if (sink.joinable()) {
+            sink.join();
+        }
+
+        // Rest samt aller offenen Wiederholungs-Zaehler ausgeben
+        Drain(true);
+    }
+
+    // === Private Hilfsfunktionen ===
+    void Logger::Log(LogLevel level, const char* format, va_list args) {
+        if (level < minimumLevel.load(std::memory_order_relaxed)) return;
+
+        LogRecord record;
+        record.level = level;
+        record.suppressed = 0;
+        record.rateLimited = 0;
+        record.time = Now();
+        std::vsnprintf(record.message, sizeof(record.message), format, args);
+
+        ThreadLog* threadLog = GetThreadLog();
+        LogRecord evicted;
+        bool hasEvicted = false;
+        bool accepted = false;
+        {
+            std::lock_guard<std::mutex> lock(threadLog->mutex);
+
+            // Gleiche Meldung innerhalb des Fensters nur zaehlen
+            uint32_t hash = HashMessage(record.message);
+            ThreadLog::DedupEntry& entry = threadLog->dedup[hash & (DEDUP_SLOTS - 1)];
+            if (entry.hash == hash && record.time - entry.windowStart < GameConfig::LOG_DEDUP_SECONDS) {
+                entry.suppressed++;
+                return;
+            }
+            if (entry.hash == hash) {
+                record.suppressed = entry.suppressed;
+                entry.suppressed = 0;
+            }
+            else {
+                // Andere Meldung im selben Slot: deren Zaehler nicht verlieren
+                hasEvicted = entry.TakeRepeatSummary(record.time, evicted);
+                entry.hash = hash;
+                entry.level = level;
+                std::memcpy(entry.message, record.message, sizeof(entry.message));
+            }
+            entry.windowStart = record.time;
+
+            // Rate-Limit (Token-Bucket pro Thread)
+            threadLog->tokens = std::min((float)GameConfig::LOG_RATE_LIMIT,
+                threadLog->tokens + (record.time - threadLog->lastRefill) * GameConfig::LOG_RATE_LIMIT);
+            threadLog->lastRefill = record.time;
+            accepted = threadLog->tokens >= 1.0f;
+            if (accepted) {
+                threadLog->tokens -= 1.0f;
+                record.rateLimited = threadLog->rateLimited;
+                threadLog->rateLimited = 0;
+            }
+            else {
+                threadLog->rateLimited++;
+            }
+
+            // Kanal voll: Meldung verwerfen, der Kanal zaehlt mit.
+            // Der Modus wird unter dem Kanal-Mutex gelesen, damit Shutdown() nichts verliert
+            if (!synchronous.load()) {
+                if (hasEvicted) threadLog->channel.TryPush(evicted);
+                if (accepted) threadLog->channel.TryPush(record);
+                return;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        if (hasEvicted) Write(evicted);
+        if (accepted) Write(record);
+        std::cout.flush();
+        std::cerr.flush();
+    }
+
+    Logger::ThreadLog* Logger::GetThreadLog() {
+        if (currentThreadLog) {
+            return static_cast<ThreadLog*>(currentThreadLog);
+        }
+
+        // Erste Meldung dieses Threads: einmalig anmelden
+        std::lock_guard<std::mutex> lock(registryMutex);
+        threadLogs.push_back(std::make_unique<ThreadLog>());
+        currentThreadLog = threadLogs.back().get();
+        return threadLogs.back().get();
+    }
+
+    void Logger::Run() {
+        Tracer::GetInstance().SetThreadName("Logger");
+
+        while (running.load(std::memory_order_relaxed)) {
+            if (Drain(false) == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+    }
+
+    size_t Logger::Drain(bool finalDrain) {
+        std::lock_guard<std::mutex> lock(registryMutex);
+
+        float now = Now();
+        size_t count = 0;
+        size_t summaries = 0;
+        LogRecord record;
+        for (const auto& threadLog : threadLogs) {
+            std::lock_guard<std::mutex> threadLock(threadLog->mutex);
+            while (threadLog->channel.TryPop(record)) {
+                Write(record);
+                count++;
+            }
+
+            // Wiederholungen, deren Fenster abgelaufen ist (beim Shutdown alle),
+            // sonst erscheint der Zaehler erst, wenn die Meldung wiederkommt
+            for (ThreadLog::DedupEntry& entry : threadLog->dedup) {
+                if (!finalDrain && now - entry.windowStart < GameConfig::LOG_DEDUP_SECONDS) continue;
+                if (entry.TakeRepeatSummary(now, record)) {
+                    Write(record);
+                    summaries++;
+                }
+            }
+        }
+
+        // Ein Flush pro Durchlauf statt std::endl pro Zeile
+        if (count + summaries > 0) {
+            std::cout.flush();
+            std::cerr.flush();
+        }
+        if (count > 0) {
+            writtenCount.fetch_add(count, std::memory_order_release);
+        }
+        return count + summaries;
+    }
+
+    void Logger::Write(const LogRecord& record) {
+        std::ostream& out = record.level >= LOG_WARNING ? std::cerr : std::cout;
+
+        if (record.rateLimited > 0) {
+            out << "[WARNUNG] " << record.rateLimited << " Log-Meldungen wegen Rate-Limit verworfen\n";
+        }
+
+        out << levelPrefixes[record.level] << ' ' << record.message;
+        if (record.suppressed > 0) {
+            out << " (" << record.suppressed << "x wiederholt)";
+        }
+        out << '\n';
+    }
+
+    float Logger::Now() const {
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    // === Schweregrade ===
+    enum LogLevel : uint8_t {
+        LOG_DEBUG,
+        LOG_INFO,
+        LOG_WARNING,
+        LOG_ERROR
+    };
+
+    /**
+     * @brief Eine Log-Meldung im Kanal (feste Groesse, ohne Heap)
+     */
+    struct LogRecord {
+        LogLevel level;
+        uint32_t suppressed;    // gleiche Meldungen seit der letzten Ausgabe
+        uint32_t rateLimited;   // vorher wegen Rate-Limit verworfene Meldungen
+        float time;             // Sekunden seit Programmstart
+        char message[240];
+    };
+
+    /**
+     * @brief Asynchroner Logger mit Hintergrund-Ausgabe
+     *
+     * Jeder Thread schreibt formatierte Meldungen in einen eigenen
+     * lock-freien SPSC-Kanal, ein Hintergrund-Thread gibt sie auf
+     * std::cout (DEBUG/INFO) bzw. std::cerr (WARNUNG/FEHLER) aus und
+     * flusht nur einmal pro Durchlauf. Der aufrufende Thread wartet
+     * nie auf Konsolen-I/O.
+     *
+     * Gleiche Meldungen innerhalb von LOG_DEDUP_SECONDS werden nur einmal
+     * ausgegeben, die Anzahl der unterdrueckten Wiederholungen schreibt der
+     * Ausgabe-Thread nach Ablauf des Fensters nach. Pro Thread gehen
+     * hoechstens LOG_RATE_LIMIT Meldungen pro Sekunde in den Kanal.
+     *
+     * Shutdown() laeuft automatisch per atexit, danach wird synchron
+     * geschrieben, damit Meldungen aus statischen Destruktoren nicht
+     * verloren gehen.
+     */
+    class Logger {
+    public:
+        // === Singleton Pattern ===
+        static Logger& GetInstance();
+
+        // === Meldungen (printf-Format) ===
+        static void Debug(const char* format, ...);
+        static void Info(const char* format, ...);
+        static void Warning(const char* format, ...);
+        static void Error(const char* format, ...);
+
+        // === Steuerung ===
+        void SetMinimumLevel(LogLevel level);
+        void Flush();
+        void Shutdown();
+
+        // === Constants ===
+        static const size_t CHANNEL_CAPACITY = 256;    // Meldungen pro Thread, Zweierpotenz
+        static const size_t DEDUP_SLOTS = 32;          // Zweierpotenz
+
+    private:
+        // === Singleton - Private Konstruktor ===
+        Logger();
+        ~Logger();
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        struct ThreadLog;
+
+        // === Private Hilfsfunktionen ===
+        void Log(LogLevel level, const char* format, va_list args);
+        ThreadLog* GetThreadLog();
+        void Run();
+        size_t Drain(bool finalDrain);
+        static void Write(const LogRecord& record);
+        float Now() const;
+
+        std::atomic<LogLevel> minimumLevel;
+        std::atomic<bool> running;
+        std::atomic<bool> synchronous;
+        std::atomic<size_t> writtenCount;
+        std::chrono::steady_clock::time_point startTime;
+        std::thread sink;
+
+        std::mutex registryMutex;   // Anmeldung neuer Threads, Ausgabe-Durchlauf
+        std::vector<std::unique_ptr<ThreadLog>> threadLogs;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "MemoryTracker.h"
+#include "Logger.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+namespace {
+
+    using SpaceInvaders::MemoryTag;
+    using SpaceInvaders::MEMORY_GENERAL;
+    using SpaceInvaders::MEMORY_TAG_COUNT;
+
+    // === Kopf vor jeder Allokation (haelt die Standard-Ausrichtung von 16 Byte) ===
+    struct AllocationHeader {
+        uint64_t size;
+        uint32_t tag;
+        uint32_t magic;
+    };
+    static_assert(sizeof(AllocationHeader) == 16, "AllocationHeader muss 16 Byte gross sein");
+
+    const uint32_t HEADER_MAGIC = 0x4D454D54; // "MEMT"
+
+    // === Zaehler (konstant initialisiert, vor jedem statischen Konstruktor gueltig) ===
+    struct TagCounters {
+        std::atomic<size_t> liveBytes{ 0 };
+        std::atomic<size_t> liveAllocations{ 0 };
+        std::atomic<size_t> peakBytes{ 0 };
+        std::atomic<size_t> totalAllocations{ 0 };
+    };
+
+    TagCounters tagCounters[MEMORY_TAG_COUNT];
+    std::atomic<size_t> totalLiveBytes{ 0 };
+    std::atomic<size_t> totalPeakBytes{ 0 };
+    std::atomic<size_t> globalAllocationCount{ 0 };
+
+    // Stand beim letzten EndFrame (nur Haupt-Thread)
+    size_t lastFrameTotals[MEMORY_TAG_COUNT] = {};
+    size_t frameAllocations[MEMORY_TAG_COUNT] = {};
+
+    thread_local MemoryTag currentTag = MEMORY_GENERAL;
+
+    void UpdatePeak(std::atomic<size_t>& peak, size_t value) {
+        size_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+} // namespace
+
+// === Ersetzte globale Allokations-Operatoren (Speicher via malloc, mit Kopf) ===
+void* operator new(std::size_t size) {
+    MemoryTag tag = currentTag;
+
+    void* block = std::malloc(sizeof(AllocationHeader) + (size == 0 ? 1 : size));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(block);
+    header->size = size;
+    header->tag = tag;
+    header->magic = HEADER_MAGIC;
+
+    SpaceInvaders::MemoryTracker::OnAllocate(tag, size);
+    return header + 1;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(p) - 1;
+#ifdef _DEBUG
+    // Doppeltes delete oder fremder Zeiger
+    if (header->magic != HEADER_MAGIC) {
+        std::abort();
+    }
+#endif
+    SpaceInvaders::MemoryTracker::OnFree((MemoryTag)header->tag, (size_t)header->size);
+    header->magic = 0;
+    std::free(header);
+}
+
+void operator delete[](void* p) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+namespace SpaceInvaders {
+
+    // === Bereich des aktuellen Threads ===
+    MemoryTag MemoryTracker::GetCurrentTag() {
+        return currentTag;
+    }
+
+    void MemoryTracker::SetCurrentTag(MemoryTag tag) {
+        currentTag = tag;
+    }
+
+    // === Gesamtwerte ===
+    size_t MemoryTracker::GetAllocationCount() {
+        return globalAllocationCount.load(std::memory_order_relaxed);
+    }
+
+    size_t MemoryTracker::GetLiveBytes() {
+        return totalLiveBytes.load(std::memory_order_relaxed);
+    }
+
+    size_t MemoryTracker::GetPeakBytes() {
+        return totalPeakBytes.load(std::memory_order_relaxed);
+    }
+
+    // === Werte pro Bereich ===
+    size_t MemoryTracker::GetLiveBytes(MemoryTag tag) {
+        if (tag >= MEMORY_TAG_COUNT) return 0;
+        return tagCounters[tag].liveBytes.load(std::memory_order_relaxed);
+    }
+
+    MemoryTagStats MemoryTracker::GetStats(MemoryTag tag) {
+        MemoryTagStats stats;
+        if (tag >= MEMORY_TAG_COUNT) return stats;
+
+        const TagCounters& counters = tagCounters[tag];
+        stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+        stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+        stats.frameAllocations = frameAllocations[tag];
+        return stats;
+    }
+
+    const char* MemoryTracker::GetTagName(MemoryTag tag) {
+        switch (tag) {
+        case MEMORY_GENERAL:  return "Allgemein";
+        case MEMORY_GAMEPLAY: return "Gameplay";
+        case MEMORY_TEXTURES: return "Texturen";
+        case MEMORY_MENUS:    return "Menues";
+        case MEMORY_SAVE:     return "Save-System";
+        case MEMORY_STRINGS:  return "Strings";
+        case MEMORY_AUDIO:    return "Audio";
+        default:              return "Unbekannt";
+        }
+    }
+
+    // === Frame-Abschluss & Bericht ===
+    void MemoryTracker::EndFrame() {
+        for (int tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+            size_t total = tagCounters[tag].totalAllocations.load(std::memory_order_relaxed);
+            frameAllocations[tag] = total - lastFrameTotals[tag];
+            lastFrameTotals[tag] = total;
+        }
+    }
+
+    bool MemoryTracker::WriteReport(const std::string& path, size_t videoMemoryBytes) {
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (!file) {
+            Logger::Error("Speicherbericht konnte nicht geschrieben werden: %s", path.c_str());
+            return false;
+        }
+
+        std::fprintf(file, "# Speicherbericht (%lld)\n", (long long)std::time(nullptr));
+        std::fprintf(file, "bereich;live_bytes;live_allokationen;peak_bytes;allokationen_gesamt;allokationen_letzter_frame\n");
+
+        for (int tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+            MemoryTagStats stats = GetStats((MemoryTag)tag);
+            std::fprintf(file, "%s;%zu;%zu;%zu;%zu;%zu\n", GetTagName((MemoryTag)tag),
+                stats.liveBytes, stats.liveAllocations, stats.peakBytes,
+                stats.totalAllocations, stats.frameAllocations);
+        }
+
+        std::fprintf(file, "Heap gesamt;%zu;;%zu;%zu;\n", GetLiveBytes(), GetPeakBytes(), GetAllocationCount());
+        std::fprintf(file, "Texturen VRAM (geschaetzt);%zu;;;;\n", videoMemoryBytes);
+        std::fclose(file);
+
+        Logger::Info("Speicherbericht gespeichert: %s", path.c_str());
+        return true;
+    }
+
+    // === Intern (operator new/delete) ===
+    void MemoryTracker::OnAllocate(MemoryTag tag, size_t size) {
+        TagCounters& counters = tagCounters[tag];
+
+        globalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        size_t tagBytes = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t totalBytes = totalLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        UpdatePeak(counters.peakBytes, tagBytes);
+        UpdatePeak(totalPeakBytes, totalBytes);
+    }
+
+    void MemoryTracker::OnFree(MemoryTag tag, size_t size) {
+        TagCounters& counters = tagCounters[tag];
+
+        counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+        totalLiveBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    // === MemoryTagScope ===
+    MemoryTagScope::MemoryTagScope(MemoryTag tag)
+        : previousTag(MemoryTracker::GetCurrentTag())
+    {
+        MemoryTracker::SetCurrentTag(tag);
+    }
+
+    MemoryTagScope::~MemoryTagScope() {
+        MemoryTracker::SetCurrentTag(previousTag);
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SpaceInvaders {
+
+    // === Subsysteme fuer die Speicher-Zuordnung ===
+    enum MemoryTag : uint8_t {
+        MEMORY_GENERAL,     // alles ohne eigenen Bereich
+        MEMORY_GAMEPLAY,    // Entities, Kollisionen, Event-Bus
+        MEMORY_TEXTURES,    // TextureManager (nur Verwaltung, Pixel liegen im VRAM)
+        MEMORY_MENUS,       // Menues, Avatar- und Mod-Auswahl
+        MEMORY_SAVE,        // Save-System und Container
+        MEMORY_STRINGS,     // Text-Aufbereitung fuer die Anzeige
+        MEMORY_AUDIO,       // Sound-Banks und Musik-Puffer
+        MEMORY_TAG_COUNT
+    };
+
+    /**
+     * @brief Kennzahlen eines Bereichs
+     */
+    struct MemoryTagStats {
+        size_t liveBytes = 0;
+        size_t liveAllocations = 0;
+        size_t peakBytes = 0;
+        size_t totalAllocations = 0;
+        size_t frameAllocations = 0;   // im zuletzt abgeschlossenen Frame
+    };
+
+    /**
+     * @brief Zaehlt alle globalen new/delete-Aufrufe, aufgeteilt nach Subsystem
+     *
+     * Ersetzt operator new/delete: jede Allokation bekommt einen kleinen
+     * Kopf mit Groesse und Bereich, damit auch delete die Bytes richtig
+     * abziehen kann. Der Bereich kommt aus dem aktuellen MemoryTagScope
+     * des Threads. Alle Zaehler sind relaxed-Atomics.
+     */
+    class MemoryTracker {
+    public:
+        // === Bereich des aktuellen Threads ===
+        static MemoryTag GetCurrentTag();
+        static void SetCurrentTag(MemoryTag tag);
+
+        // === Gesamtwerte ===
+        static size_t GetAllocationCount();
+        static size_t GetLiveBytes();
+        static size_t GetLiveBytes(MemoryTag tag);
+        static size_t GetPeakBytes();
+
+        // === Werte pro Bereich ===
+        static MemoryTagStats GetStats(MemoryTag tag);
+        static const char* GetTagName(MemoryTag tag);
+
+        // === Frame-Abschluss & Bericht ===
+        static void EndFrame();
+        static bool WriteReport(const std::string& path, size_t videoMemoryBytes);
+
+        // === Intern (operator new/delete) ===
+        static void OnAllocate(MemoryTag tag, size_t size);
+        static void OnFree(MemoryTag tag, size_t size);
+    };
+
+    /**
+     * @brief Ordnet alle Allokationen im Gueltigkeitsbereich einem Subsystem zu
+     */
+    class MemoryTagScope {
+    public:
+        explicit MemoryTagScope(MemoryTag tag);
+        ~MemoryTagScope();
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    private:
+        MemoryTag previousTag;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
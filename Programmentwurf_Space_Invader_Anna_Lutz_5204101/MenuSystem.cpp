@@ -1,19 +1,23 @@
 #include "MenuSystem.h"
 #include "TextureManager.h"
+#include "MemoryTracker.h"
 #include <sstream>
 #include <iomanip>
+#include <ctime>
 
 namespace SpaceInvaders {
 
     // === Konstruktor ===
     MenuSystem::MenuSystem()
-        : saveSystem(nullptr)
+        : inputManager(nullptr)
+        , saveSystem(nullptr)
         , mainMenuSelection(0)
         , difficultySelection(1) // Medium als Standard
         , selectedDifficulty(DIFF_MEDIUM)
         , backgroundAnimation(0.0f)
         , titlePulse(0.0f)
         , bestMultiplayerScore(0)
+        , statisticsLoaded(false)
     {
     }
 
@@ -28,6 +32,14 @@ namespace SpaceInvaders {
         return true;
     }
 
+    void MenuSystem::SetSaveSystem(SaveSystem* system) {
+        saveSystem = system;
+    }
+
+    void MenuSystem::SetInputManager(const InputManager* input) {
+        inputManager = input;
+    }
+
     // === Hauptmen ===
     MenuSystem::MainMenuResult MenuSystem::UpdateMainMenu(float deltaTime, int coins) {
         backgroundAnimation += deltaTime;
@@ -36,7 +48,7 @@ namespace SpaceInvaders {
         UpdateMainMenuSelection(deltaTime);
 
         // berprfen ob eine Option ausgewhlt wurde
-        if (inputManager.GetNavigationInput() == InputManager::NAV_CONFIRM) {
+        if (inputManager->GetNavigationInput() == InputManager::NAV_CONFIRM) {
             switch (mainMenuSelection) {
             case 0: return MAIN_SINGLEPLAYER;
             case 1: return MAIN_MULTIPLAYER;
@@ -63,7 +75,7 @@ namespace SpaceInvaders {
         return MAIN_SELECTING;
     }
 
-    void MenuSystem::RenderMainMenu(int coins) {
+    void MenuSystem::RenderMainMenu(int coins, bool canResumeRun) {
         BeginDrawing();
         ClearBackground(BLACK);
 
@@ -88,6 +100,14 @@ namespace SpaceInvaders {
         // Men-Optionen
         RenderMenuOptions(mainMenuOptions, mainMenuSelection);
 
+        // Hinweis auf eine gespeicherte Partie
+        if (canResumeRun) {
+            const char* resumeHint = "[C] Gespeicherte Partie fortsetzen";
+            int resumeWidth = MeasureText(resumeHint, 20);
+            DrawText(resumeHint, (GameConfig::SCREEN_WIDTH - resumeWidth) / 2,
+                GameConfig::SCREEN_HEIGHT - 80, 20, GOLD);
+        }
+
         // Untertitel/Version
         const char* subtitle = "v1.0 - Erstellt mit Raylib";
         int subtitleWidth = MeasureText(subtitle, 16);
@@ -99,9 +119,9 @@ namespace SpaceInvaders {
 
     // === Regeln ===
     bool MenuSystem::UpdateRules(float deltaTime) {
-        return inputManager.GetNavigationInput() == InputManager::NAV_CONFIRM ||
-            inputManager.GetNavigationInput() == InputManager::NAV_BACK ||
-            inputManager.IsMouseClicked();
+        InputManager::NavInput navInput = inputManager->GetNavigationInput();
+        return navInput == InputManager::NAV_CONFIRM || navInput == InputManager::NAV_BACK ||
+            inputManager->IsMouseClicked();
     }
 
     void MenuSystem::RenderRules() {
@@ -109,71 +129,93 @@ namespace SpaceInvaders {
         ClearBackground(BLACK);
 
         RenderMenuBackground();
-        RenderTitle("SPIELREGELN");
-
-        // Regel-Text
-        std::vector<std::string> rules = {
-            "ZIEL:",
-            " Schuetze alle Gegner ab und ueberlebe so lange wie moeglich",
-            " Sammle Coins um neue Avatare und Mods freizuschalten",
-            "",
-            "STEUERUNG SINGLEPLAYER:",
-            " Pfeiltasten Links/Rechts: Bewegen",
-            " Pfeil Hoch: Schiessen",
-            " P: Pause",
-            "",
-            "STEUERUNG MULTIPLAYER:",
-            " Player 1: A/D bewegen, W schiessen",
-            " Player 2: Pfeiltasten bewegen, Pfeil Hoch schiessen",
-            "",
-            "AVATAR-BONI:",
-            " Blau: Keine Boni (kostenlos)",
-            " Gruen: +1 Leben",
-            " Rot: +10% Projektilgeschwindigkeit",
-            " Gelb: +10% Bewegungsgeschwindigkeit",
-            " Lila: +10% Schussfrequenz",
-            "",
-            "POWER-UPS:",
-            " Schild: Schuetzt vor Treffern",
-            " Triple-Shot: Schiesst 3 Projektile",
-            " Zeitlupe: Verlangsamt Gegner"
-        };
 
-        int startY = 150;
-        for (size_t i = 0; i < rules.size(); i++) {
-            Color textColor = WHITE;
-            int fontSize = 18;
+        // Regeln sind statisch - nur einmal in den Cache zeichnen
+        Rectangle screenArea = { 0, 0, (float)GameConfig::SCREEN_WIDTH, (float)GameConfig::SCREEN_HEIGHT };
+        if (rulesCache.BeginUpdate(screenArea, 0)) {
+            RenderTitle("SPIELREGELN");
+
+            // Regel-Text
+            std::vector<std::string> rules = {
+                "ZIEL:",
+                " Schuetze alle Gegner ab und ueberlebe so lange wie moeglich",
+                " Sammle Coins um neue Avatare und Mods freizuschalten",
+                "",
+                "STEUERUNG SINGLEPLAYER:",
+                " Pfeiltasten Links/Rechts: Bewegen",
+                " Pfeil Hoch: Schiessen",
+                " P: Pause",
+                "",
+                "STEUERUNG MULTIPLAYER:",
+                " Player 1: A/D bewegen, W schiessen",
+                " Player 2: Pfeiltasten bewegen, Pfeil Hoch schiessen",
+                "",
+                "AVATAR-BONI:",
+                " Blau: Keine Boni (kostenlos)",
+                " Gruen: +1 Leben",
+                " Rot: +10% Projektilgeschwindigkeit",
+                " Gelb: +10% Bewegungsgeschwindigkeit",
+                " Lila: +10% Schussfrequenz",
+                "",
+                "POWER-UPS:",
+                " Schild: Schuetzt vor Treffern",
+                " Triple-Shot: Schiesst 3 Projektile",
+                " Zeitlupe: Verlangsamt Gegner"
+            };
+
+            int startY = 150;
+            for (size_t i = 0; i < rules.size(); i++) {
+                Color textColor = WHITE;
+                int fontSize = 18;
+
+                // berschriften hervorheben
+                if (rules[i].find(":") != std::string::npos && rules[i][0] != '') {
+                    textColor = YELLOW;
+                    fontSize = 22;
+                }
 
-            // berschriften hervorheben
-            if (rules[i].find(":") != std::string::npos && rules[i][0] != '') {
-                textColor = YELLOW;
-                fontSize = 22;
+                DrawText(rules[i].c_str(), 100, startY + i * 25, fontSize, textColor);
             }
 
-            DrawText(rules[i].c_str(), 100, startY + i * 25, fontSize, textColor);
-        }
+            // Zurck-Hinweis
+            const char* backText = "ENTER oder Mausklick zum Zurueckkehren";
+            int backWidth = MeasureText(backText, 20);
+            DrawText(backText, (GameConfig::SCREEN_WIDTH - backWidth) / 2,
+                GameConfig::SCREEN_HEIGHT - 80, 20, ORANGE);
 
-        // Zurck-Hinweis
-        const char* backText = "ENTER oder Mausklick zum Zurueckkehren";
-        int backWidth = MeasureText(backText, 20);
-        DrawText(backText, (GameConfig::SCREEN_WIDTH - backWidth) / 2,
-            GameConfig::SCREEN_HEIGHT - 80, 20, ORANGE);
+            rulesCache.EndUpdate();
+        }
+        rulesCache.Draw();
 
         EndDrawing();
     }
 
     // === Statistiken ===
     bool MenuSystem::UpdateStatistics(float deltaTime) {
-        // Statistiken laden (falls noch nicht geschehen)
-        if (saveSystem) {
+        // Statistiken erst beim Betreten laden, nicht in jedem Frame
+        if (saveSystem && !statisticsLoaded) {
             gameStats = saveSystem->LoadStatistics();
             highscores = saveSystem->LoadHighscores();
             bestMultiplayerScore = saveSystem->LoadBestMultiplayerScore();
+
+            // Verlauf der letzten Tage aus der Run-Historie (liest nur die noetigen Spalten)
+            RunFilter filter;
+            filter.since = (int64_t)time(nullptr) - (int64_t)GameConfig::STATISTICS_HISTORY_DAYS * 24 * 60 * 60;
+            filter.difficulty = selectedDifficulty;
+            avatarHistory = saveSystem->GetRunHistory().AggregateBy(COLUMN_AVATAR, 5, filter);
+
+            statisticsLoaded = true;
         }
 
-        return inputManager.GetNavigationInput() == InputManager::NAV_CONFIRM ||
-            inputManager.GetNavigationInput() == InputManager::NAV_BACK ||
-            inputManager.IsMouseClicked();
+        InputManager::NavInput navInput = inputManager->GetNavigationInput();
+        bool leave = navInput == InputManager::NAV_CONFIRM || navInput == InputManager::NAV_BACK ||
+            inputManager->IsMouseClicked();
+
+        // Beim naechsten Besuch neu laden (Werte koennen sich nach einer Runde geaendert haben)
+        if (leave) {
+            statisticsLoaded = false;
+        }
+        return leave;
     }
 
     void MenuSystem::RenderStatistics() {
@@ -181,29 +223,62 @@ namespace SpaceInvaders {
         ClearBackground(BLACK);
 
         RenderMenuBackground();
-        RenderTitle("STATISTIKEN");
 
-        RenderStatisticsContent();
+        // Inhalte nur neu zeichnen, wenn sich die geladenen Werte geaendert haben
+        Rectangle screenArea = { 0, 0, (float)GameConfig::SCREEN_WIDTH, (float)GameConfig::SCREEN_HEIGHT };
+        if (statisticsCache.BeginUpdate(screenArea, GetStatisticsKey())) {
+            RenderTitle("STATISTIKEN");
 
-        // Zurck-Hinweis
-        const char* backText = "ENTER oder Mausklick zum Zurueckkehren";
-        int backWidth = MeasureText(backText, 20);
-        DrawText(backText, (GameConfig::SCREEN_WIDTH - backWidth) / 2,
-            GameConfig::SCREEN_HEIGHT - 60, 20, ORANGE);
+            RenderStatisticsContent();
+
+            // Zurck-Hinweis
+            const char* backText = "ENTER oder Mausklick zum Zurueckkehren";
+            int backWidth = MeasureText(backText, 20);
+            DrawText(backText, (GameConfig::SCREEN_WIDTH - backWidth) / 2,
+                GameConfig::SCREEN_HEIGHT - 60, 20, ORANGE);
+
+            statisticsCache.EndUpdate();
+        }
+        statisticsCache.Draw();
 
         EndDrawing();
     }
 
+    uint64_t MenuSystem::GetStatisticsKey() const {
+        int historyRuns = 0;
+        int64_t historyScore = 0;
+        for (const RunAggregate& group : avatarHistory) {
+            historyRuns += group.runs;
+            historyScore += group.scoreSum;
+        }
+
+        return RenderCache::MakeKey({
+            gameStats.totalGamesPlayed,
+            gameStats.totalScore,
+            gameStats.totalCoinsEarned,
+            gameStats.totalEnemiesKilled,
+            gameStats.totalBossesDefeated,
+            (int)gameStats.totalPlayTime,
+            (int)highscores.size(),
+            highscores.empty() ? 0 : highscores.front().score,
+            highscores.empty() ? 0 : highscores.back().score,
+            bestMultiplayerScore,
+            historyRuns,
+            (int)historyScore,
+            (int)selectedDifficulty
+        });
+    }
+
     // === Schwierigkeitsauswahl ===
     MenuSystem::DifficultyResult MenuSystem::UpdateDifficultySelection(float deltaTime) {
         UpdateDifficultyMenuSelection(deltaTime);
 
-        if (inputManager.GetNavigationInput() == InputManager::NAV_CONFIRM) {
+        if (inputManager->GetNavigationInput() == InputManager::NAV_CONFIRM) {
             selectedDifficulty = (Difficulty)difficultySelection;
             return DIFF_CHOSEN;
         }
 
-        if (inputManager.GetNavigationInput() == InputManager::NAV_BACK) {
+        if (inputManager->GetNavigationInput() == InputManager::NAV_BACK) {
             return DIFF_BACK;
         }
 
@@ -262,8 +337,8 @@ namespace SpaceInvaders {
 
     // === GameOver Screen ===
     bool MenuSystem::UpdateGameOver(float deltaTime, int finalScore, bool isMultiplayer) {
-        return inputManager.GetNavigationInput() == InputManager::NAV_CONFIRM ||
-            inputManager.IsMouseClicked();
+        return inputManager->GetNavigationInput() == InputManager::NAV_CONFIRM ||
+            inputManager->IsMouseClicked();
     }
 
     void MenuSystem::RenderGameOver(int finalScore, bool isMultiplayer, int coinsEarned) {
@@ -278,6 +353,8 @@ namespace SpaceInvaders {
         int titleWidth = MeasureText(gameOverText, titleSize);
         DrawText(gameOverText, (GameConfig::SCREEN_WIDTH - titleWidth) / 2, 200, titleSize, RED);
 
+        MemoryTagScope memoryTag(MEMORY_STRINGS);
+
         // Score anzeigen
         std::string scoreText = isMultiplayer ?
             "Kombinierter Score: " + std::to_string(finalScore) :
@@ -303,11 +380,11 @@ namespace SpaceInvaders {
 
     // === Pause Screen ===
     MenuSystem::PauseResult MenuSystem::UpdatePause(float deltaTime) {
-        if (inputManager.IsPausePressed()) {
+        if (inputManager->IsPausePressed()) {
             return PAUSE_CONTINUE;
         }
 
-        if (IsKeyPressed(KEY_M)) {
+        if (inputManager->IsKeyPressed(KEY_M)) {
             return PAUSE_MAIN_MENU;
         }
 
@@ -381,7 +458,7 @@ namespace SpaceInvaders {
     void MenuSystem::UpdateMainMenuSelection(float deltaTime) {
         UpdateMenuButtonAnimations(mainMenuOptions, deltaTime);
 
-        auto navInput = inputManager.GetNavigationInput();
+        auto navInput = inputManager->GetNavigationInput();
         if (navInput == InputManager::NAV_UP) {
             mainMenuSelection = (mainMenuSelection - 1 + mainMenuOptions.size()) % mainMenuOptions.size();
         }
@@ -393,7 +470,7 @@ namespace SpaceInvaders {
     void MenuSystem::UpdateDifficultyMenuSelection(float deltaTime) {
         UpdateMenuButtonAnimations(difficultyOptions, deltaTime);
 
-        auto navInput = inputManager.GetNavigationInput();
+        auto navInput = inputManager->GetNavigationInput();
         if (navInput == InputManager::NAV_UP) {
             difficultySelection = (difficultySelection - 1 + difficultyOptions.size()) % difficultyOptions.size();
         }
@@ -441,7 +518,7 @@ namespace SpaceInvaders {
             }
 
             // Hover-Effekt fr Maus
-            if (inputManager.IsMouseOverRectangle(option.bounds)) {
+            if (inputManager->IsMouseOverRectangle(option.bounds)) {
                 textColor = ORANGE;
                 DrawRectangleRec(option.bounds, Fade(ORANGE, 0.1f));
             }
@@ -510,6 +587,7 @@ namespace SpaceInvaders {
             DrawText(TextFormat("%d", entry.score), x + 200, y + i * 30, 20, GREEN);
 
             // Avatar & Schwierigkeit
+            MemoryTagScope memoryTag(MEMORY_STRINGS);
             std::string details = GetAvatarName(entry.avatarUsed) + " / " + GetDifficultyName(entry.difficulty);
             DrawText(details.c_str(), x + 300, y + i * 30, 16, GRAY);
         }
@@ -540,14 +618,21 @@ namespace SpaceInvaders {
         DrawText(TextFormat("Spielzeit: %s", FormatPlayTime(gameStats.totalPlayTime).c_str()), x, currentY, 18, WHITE);
         currentY += lineHeight + 20;
 
-        // Avatar-Nutzung
-        DrawText("AVATAR-NUTZUNG:", x, currentY, 20, YELLOW);
+        // Avatare der letzten Tage auf der gewaehlten Schwierigkeit
+        DrawText(TextFormat("LETZTE %d TAGE (%s):", GameConfig::STATISTICS_HISTORY_DAYS,
+            GetDifficultyName(selectedDifficulty).c_str()), x, currentY, 20, YELLOW);
         currentY += 30;
 
-        std::vector<std::string> avatarNames = { "Blau", "Gruen", "Rot", "Gelb", "Lila" };
+        static const char* const avatarNames[] = { "Blau", "Gruen", "Rot", "Gelb", "Lila" };
         for (int i = 0; i < 5; i++) {
-            DrawText(TextFormat("%s: %dx", avatarNames[i].c_str(), gameStats.avatarUsageCount[i]),
-                x, currentY, 16, WHITE);
+            int runs = i < (int)avatarHistory.size() ? avatarHistory[i].runs : 0;
+            if (runs > 0) {
+                DrawText(TextFormat("%s: %dx, Schnitt %.0f", avatarNames[i], runs, avatarHistory[i].GetAverageScore()),
+                    x, currentY, 16, WHITE);
+            }
+            else {
+                DrawText(TextFormat("%s: -", avatarNames[i]), x, currentY, 16, GRAY);
+            }
             currentY += 20;
         }
     }
@@ -555,9 +640,9 @@ namespace SpaceInvaders {
     // === Button Hilfsfunktionen ===
     bool MenuSystem::HandleMenuOptionClick(std::vector<MenuOption>& options, int& selectedIndex) {
         for (size_t i = 0; i < options.size(); i++) {
-            if (inputManager.IsMouseOverRectangle(options[i].bounds)) {
+            if (inputManager->IsMouseOverRectangle(options[i].bounds)) {
                 selectedIndex = (int)i;
-                if (inputManager.IsMouseClicked()) {
+                if (inputManager->IsMouseClicked()) {
                     return true;
                 }
             }
@@ -567,8 +652,8 @@ namespace SpaceInvaders {
 
     void MenuSystem::UpdateMenuButtonAnimations(std::vector<MenuOption>& options, float deltaTime) {
         for (auto& option : options) {
-            bool isHovered = inputManager.IsMouseOverRectangle(option.bounds);
-            UpdateAnimatedButton(option.bounds, option.buttonState, WHITE, YELLOW, ORANGE, deltaTime);
+            bool isHovered = inputManager->IsMouseOverRectangle(option.bounds);
+            UpdateAnimatedButton(*inputManager, option.bounds, option.buttonState, WHITE, YELLOW, ORANGE);
         }
     }
 
@@ -595,6 +680,7 @@ namespace SpaceInvaders {
         int minutes = (int)((seconds - hours * 3600) / 60);
         int secs = (int)(seconds - hours * 3600 - minutes * 60);
 
+        MemoryTagScope memoryTag(MEMORY_STRINGS);
         std::ostringstream oss;
         oss << std::setfill('0') << std::setw(2) << hours << ":"
             << std::setfill('0') << std::setw(2) << minutes << ":"
@@ -4,6 +4,7 @@
 #include "GameConfig.h"
 #include "InputManager.h"
 #include "SaveSystem.h"
+#include "RenderCache.h"
 #include <vector>
 #include <string>
 
@@ -37,6 +38,8 @@ namespace SpaceInvaders {
 
         // === Initialisierung ===
         bool Initialize();
+        void SetSaveSystem(SaveSystem* system);
+        void SetInputManager(const InputManager* input);
 
         // === Hauptmen ===
         enum MainMenuResult {
@@ -50,7 +53,7 @@ namespace SpaceInvaders {
         };
 
         MainMenuResult UpdateMainMenu(float deltaTime, int coins);
-        void RenderMainMenu(int coins);
+        void RenderMainMenu(int coins, bool canResumeRun);
 
         // === Regeln ===
         bool UpdateRules(float deltaTime);
@@ -88,7 +91,7 @@ namespace SpaceInvaders {
 
     private:
         // === Input & Save System ===
-        InputManager inputManager;
+        const InputManager* inputManager;  // gehrt Game, Snapshot des aktuellen Frames
         SaveSystem* saveSystem;
 
         // === Hauptmen State ===
@@ -104,6 +107,13 @@ namespace SpaceInvaders {
         GameStatistics gameStats;
         std::vector<HighscoreEntry> highscores;
         int bestMultiplayerScore;
+        std::vector<RunAggregate> avatarHistory;  // je Avatar, letzte Tage, gewaehlte Schwierigkeit
+        bool statisticsLoaded;  // einmal pro Besuch des Screens laden
+
+        // === Gecachte statische Bildschirme ===
+        RenderCache rulesCache;
+        RenderCache statisticsCache;
+        uint64_t GetStatisticsKey() const;
 
         // === Private Hilfsfunktionen ===
         void InitializeMainMenu();
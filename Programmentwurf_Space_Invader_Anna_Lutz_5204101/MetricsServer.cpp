@@ -0,0 +1,349 @@
+#include "MetricsServer.h"
+#include "MemoryTracker.h"
+#include "Tracer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace SpaceInvaders {
+
+    namespace {
+
+#ifdef _WIN32
+        using SocketHandle = SOCKET;
+        const SocketHandle INVALID_HANDLE = INVALID_SOCKET;
+
+        void CloseSocket(SocketHandle socket) {
+            closesocket(socket);
+        }
+
+        void SetSocketTimeouts(SocketHandle socket, int milliseconds) {
+            DWORD timeout = (DWORD)milliseconds;
+            setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+            setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, (const char*)&timeout, sizeof(timeout));
+        }
+
+        const int SEND_FLAGS = 0;
+#else
+        using SocketHandle = int;
+        const SocketHandle INVALID_HANDLE = -1;
+
+        void CloseSocket(SocketHandle socket) {
+            close(socket);
+        }
+
+        void SetSocketTimeouts(SocketHandle socket, int milliseconds) {
+            timeval timeout{ milliseconds / 1000, (milliseconds % 1000) * 1000 };
+            setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        }
+
+        // Abgebrochene Verbindung soll kein SIGPIPE ausloesen
+        const int SEND_FLAGS = MSG_NOSIGNAL;
+#endif
+
+        bool SendAll(SocketHandle socket, const char* data, size_t length) {
+            while (length > 0) {
+                int sent = (int)send(socket, data, (int)length, SEND_FLAGS);
+                if (sent <= 0) return false; // Fehler oder Timeout
+                data += sent;
+                length -= (size_t)sent;
+            }
+            return true;
+        }
+
+        const char* const stateNames[] = {
+            "MAINMENU", "SINGLEPLAYER_SETUP", "MULTIPLAYER_SETUP", "DIFFICULTY_SELECTION",
+            "STATISTICS", "RULES", "GAME", "GAMEOVER", "PAUSE"
+        };
+
+        const char* const entityNames[] = {
+            "player", "enemy", "bullet", "enemy_bullet", "powerup", "explosion", "boss", "particle"
+        };
+
+        const char* const memoryTagNames[] = {
+            "general", "gameplay", "textures", "menus", "save", "strings", "audio"
+        };
+
+        void AppendLine(std::string& out, const char* format, ...) {
+            char line[256];
+            va_list args;
+            va_start(args, format);
+            std::vsnprintf(line, sizeof(line), format, args);
+            va_end(args);
+            out += line;
+        }
+
+        float Percentile(const std::vector<float>& sorted, float quantile) {
+            if (sorted.empty()) return 0.0f;
+            size_t index = (size_t)(quantile * (sorted.size() - 1) + 0.5f);
+            return sorted[std::min(index, sorted.size() - 1)];
+        }
+
+        void StoreMax(std::atomic<float>& target, float value) {
+            float current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+
+    } // namespace
+
+    // === Singleton ===
+    MetricsServer& MetricsServer::GetInstance() {
+        static MetricsServer instance;
+        return instance;
+    }
+
+    MetricsServer::MetricsServer()
+        : frameCount(0)
+        , updateTimeMs(0.0f)
+        , renderTimeMs(0.0f)
+        , frameAllocations(0)
+        , gameState(STATE_MAINMENU)
+        , saveWrites(0)
+        , saveWriteFailures(0)
+        , lastSaveWriteMs(0.0f)
+        , maxSaveWriteMs(0.0f)
+        , running(false)
+    {
+        for (auto& frameTime : frameTimes) frameTime.store(0.0f, std::memory_order_relaxed);
+        for (auto& count : entityCounts) count.store(0, std::memory_order_relaxed);
+    }
+
+    MetricsServer::~MetricsServer() {
+        Stop();
+    }
+
+    // === Thread-Steuerung ===
+    bool MetricsServer::Start(uint16_t port) {
+        if (running.exchange(true)) return false;
+
+        // Ein fehlgeschlagener Start hat den Thread bereits beendet
+        if (worker.joinable()) {
+            worker.join();
+        }
+
+        worker = std::thread(&MetricsServer::Run, this, port);
+        return true;
+    }
+
+    void MetricsServer::Stop() {
+        running.store(false);
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    bool MetricsServer::IsRunning() const {
+        return running.load();
+    }
+
+    // === Veroeffentlichen (Haupt-Thread) ===
+    void MetricsServer::PublishFrame(float frameTimeMs, float updateMs, float renderMs, size_t allocations) {
+        size_t index = frameCount.load(std::memory_order_relaxed);
+        frameTimes[index & (FRAME_WINDOW - 1)].store(frameTimeMs, std::memory_order_relaxed);
+        frameCount.store(index + 1, std::memory_order_release);
+
+        updateTimeMs.store(updateMs, std::memory_order_relaxed);
+        renderTimeMs.store(renderMs, std::memory_order_relaxed);
+        frameAllocations.store(allocations, std::memory_order_relaxed);
+    }
+
+    void MetricsServer::PublishEntityCount(MetricsEntityType type, size_t count) {
+        entityCounts[type].store(count, std::memory_order_relaxed);
+    }
+
+    void MetricsServer::PublishGameState(GameState state) {
+        gameState.store(state, std::memory_order_relaxed);
+    }
+
+    // === Veroeffentlichen (Save-System) ===
+    void MetricsServer::RecordSaveWrite(float durationMs, bool success) {
+        saveWrites.fetch_add(1, std::memory_order_relaxed);
+        if (!success) {
+            saveWriteFailures.fetch_add(1, std::memory_order_relaxed);
+        }
+        lastSaveWriteMs.store(durationMs, std::memory_order_relaxed);
+        StoreMax(maxSaveWriteMs, durationMs);
+    }
+
+    // === Bericht (Prometheus-Textformat) ===
+    std::string MetricsServer::BuildReport() const {
+        std::string out;
+        out.reserve(4096);
+
+        // Frame-Zeiten des Fensters kopieren und sortieren
+        size_t count = frameCount.load(std::memory_order_acquire);
+        size_t window = std::min(count, FRAME_WINDOW);
+        std::vector<float> sorted;
+        sorted.reserve(window);
+        float sum = 0.0f;
+        for (size_t i = count - window; i < count; i++) {
+            float frameTime = frameTimes[i & (FRAME_WINDOW - 1)].load(std::memory_order_relaxed);
+            sorted.push_back(frameTime);
+            sum += frameTime;
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        const float quantiles[] = { 0.5f, 0.9f, 0.99f };
+
+        out += "# HELP spaceinvaders_frame_time_ms Frame-Zeit ueber die letzten Frames.\n";
+        out += "# TYPE spaceinvaders_frame_time_ms summary\n";
+        for (float quantile : quantiles) {
+            AppendLine(out, "spaceinvaders_frame_time_ms{quantile=\"%.2f\"} %.3f\n", quantile, Percentile(sorted, quantile));
+        }
+        AppendLine(out, "spaceinvaders_frame_time_ms_sum %.3f\n", sum);
+        AppendLine(out, "spaceinvaders_frame_time_ms_count %zu\n", window);
+
+        // FPS-Perzentile: langsame Frames bestimmen die niedrigen FPS-Quantile
+        out += "# HELP spaceinvaders_fps Bilder pro Sekunde ueber die letzten Frames.\n";
+        out += "# TYPE spaceinvaders_fps gauge\n";
+        for (float quantile : quantiles) {
+            float frameTime = Percentile(sorted, quantile);
+            AppendLine(out, "spaceinvaders_fps{quantile=\"%.2f\"} %.2f\n", 1.0f - quantile,
+                frameTime > 0.0f ? 1000.0f / frameTime : 0.0f);
+        }
+        AppendLine(out, "spaceinvaders_fps_average %.2f\n", sum > 0.0f ? 1000.0f * window / sum : 0.0f);
+
+        out += "# TYPE spaceinvaders_frames_total counter\n";
+        AppendLine(out, "spaceinvaders_frames_total %zu\n", count);
+
+        out += "# HELP spaceinvaders_update_time_ms Dauer von Game::Update im letzten Frame.\n";
+        out += "# TYPE spaceinvaders_update_time_ms gauge\n";
+        AppendLine(out, "spaceinvaders_update_time_ms %.3f\n", updateTimeMs.load(std::memory_order_relaxed));
+        out += "# HELP spaceinvaders_render_time_ms Dauer von Game::Render im letzten Frame (inkl. VSync).\n";
+        out += "# TYPE spaceinvaders_render_time_ms gauge\n";
+        AppendLine(out, "spaceinvaders_render_time_ms %.3f\n", renderTimeMs.load(std::memory_order_relaxed));
+
+        // Entities
+        out += "# TYPE spaceinvaders_entities gauge\n";
+        for (int type = 0; type < METRICS_ENTITY_TYPE_COUNT; type++) {
+            AppendLine(out, "spaceinvaders_entities{type=\"%s\"} %zu\n", entityNames[type],
+                entityCounts[type].load(std::memory_order_relaxed));
+        }
+
+        // Allokator
+        out += "# TYPE spaceinvaders_heap_live_bytes gauge\n";
+        for (int tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+            AppendLine(out, "spaceinvaders_heap_live_bytes{subsystem=\"%s\"} %zu\n", memoryTagNames[tag],
+                MemoryTracker::GetLiveBytes((MemoryTag)tag));
+        }
+        out += "# TYPE spaceinvaders_heap_peak_bytes gauge\n";
+        AppendLine(out, "spaceinvaders_heap_peak_bytes %zu\n", MemoryTracker::GetPeakBytes());
+        out += "# TYPE spaceinvaders_heap_allocations_total counter\n";
+        AppendLine(out, "spaceinvaders_heap_allocations_total %zu\n", MemoryTracker::GetAllocationCount());
+        out += "# TYPE spaceinvaders_heap_allocations_last_frame gauge\n";
+        AppendLine(out, "spaceinvaders_heap_allocations_last_frame %zu\n", frameAllocations.load(std::memory_order_relaxed));
+
+        // Save-System
+        out += "# TYPE spaceinvaders_save_writes_total counter\n";
+        AppendLine(out, "spaceinvaders_save_writes_total %zu\n", saveWrites.load(std::memory_order_relaxed));
+        out += "# TYPE spaceinvaders_save_write_failures_total counter\n";
+        AppendLine(out, "spaceinvaders_save_write_failures_total %zu\n", saveWriteFailures.load(std::memory_order_relaxed));
+        out += "# TYPE spaceinvaders_save_write_latency_ms gauge\n";
+        AppendLine(out, "spaceinvaders_save_write_latency_ms{kind=\"last\"} %.3f\n", lastSaveWriteMs.load(std::memory_order_relaxed));
+        AppendLine(out, "spaceinvaders_save_write_latency_ms{kind=\"max\"} %.3f\n", maxSaveWriteMs.load(std::memory_order_relaxed));
+
+        // GameState als Info-Metrik (genau ein Zustand hat den Wert 1)
+        int state = gameState.load(std::memory_order_relaxed);
+        out += "# TYPE spaceinvaders_game_state gauge\n";
+        for (int i = 0; i < (int)(sizeof(stateNames) / sizeof(stateNames[0])); i++) {
+            AppendLine(out, "spaceinvaders_game_state{state=\"%s\"} %d\n", stateNames[i], i == state ? 1 : 0);
+        }
+
+        return out;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void MetricsServer::Run(uint16_t port) {
+        Tracer::GetInstance().SetThreadName("MetricsServer");
+
+#ifdef _WIN32
+        WSADATA wsaData;
+        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+            Logger::Warning("Metrik-Endpunkt: Winsock konnte nicht gestartet werden.");
+            running.store(false);
+            return;
+        }
+#endif
+
+        SocketHandle listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+        int reuse = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+
+        // Nur lokal erreichbar: der Flotten-Agent laeuft auf demselben Automaten
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (listener == INVALID_HANDLE ||
+            bind(listener, (const sockaddr*)&address, sizeof(address)) != 0 ||
+            listen(listener, 4) != 0) {
+            Logger::Warning("Metrik-Endpunkt konnte Port %d nicht belegen.", (int)port);
+            if (listener != INVALID_HANDLE) CloseSocket(listener);
+#ifdef _WIN32
+            WSACleanup();
+#endif
+            running.store(false);
+            return;
+        }
+
+        Logger::Info("Metrik-Endpunkt aktiv: http://127.0.0.1:%d/metrics", (int)port);
+
+        while (running.load()) {
+            // Kurzes Timeout, damit Stop() nicht auf die naechste Anfrage warten muss
+            fd_set readSet;
+            FD_ZERO(&readSet);
+            FD_SET(listener, &readSet);
+            timeval timeout{ 0, 250000 };
+
+            if (select((int)listener + 1, &readSet, nullptr, nullptr, &timeout) <= 0) continue;
+
+            SocketHandle client = accept(listener, nullptr, nullptr);
+            if (client == INVALID_HANDLE) continue;
+
+            // Ein stummer Client darf den Worker (und damit Stop()) nicht blockieren
+            SetSocketTimeouts(client, CLIENT_TIMEOUT_MS);
+
+            // Anfrage nur lesen, jeder Pfad liefert die Metriken
+            char request[1024];
+            if (recv(client, request, sizeof(request), 0) <= 0) {
+                CloseSocket(client);
+                continue;
+            }
+
+            std::string body = BuildReport();
+            char header[160];
+            int headerLength = std::snprintf(header, sizeof(header),
+                "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                body.size());
+
+            if (SendAll(client, header, (size_t)headerLength)) {
+                SendAll(client, body.c_str(), body.size());
+            }
+            CloseSocket(client);
+        }
+
+        CloseSocket(listener);
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
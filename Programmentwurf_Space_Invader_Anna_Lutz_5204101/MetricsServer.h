@@ -0,0 +1,92 @@
+#pragma once
+
+#include "GameConfig.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace SpaceInvaders {
+
+    // === Entity-Typen fuer die Metriken ===
+    enum MetricsEntityType : uint8_t {
+        METRICS_PLAYERS,
+        METRICS_ENEMIES,
+        METRICS_BULLETS,
+        METRICS_ENEMY_BULLETS,
+        METRICS_POWERUPS,
+        METRICS_EXPLOSIONS,
+        METRICS_BOSSES,
+        METRICS_PARTICLES,
+        METRICS_ENTITY_TYPE_COUNT
+    };
+
+    /**
+     * @brief Lokaler Metrik-Endpunkt fuer den Flotten-Agenten
+     *
+     * Der Haupt-Thread veroeffentlicht pro Frame nur ein paar relaxed-
+     * Atomics (Frame-, Update- und Render-Zeit, Entities, GameState), das
+     * Save-System die Schreiblatenz. Ein Hintergrund-Thread lauscht auf
+     * 127.0.0.1:METRICS_PORT und baut bei jeder HTTP-Anfrage daraus einen
+     * Bericht im Prometheus-Textformat, inklusive Frame-Zeit-Perzentilen
+     * ueber die letzten FRAME_WINDOW Frames und den Werten des MemoryTracker.
+     */
+    class MetricsServer {
+    public:
+        // === Singleton Pattern ===
+        static MetricsServer& GetInstance();
+        ~MetricsServer();
+
+        // === Thread-Steuerung ===
+        bool Start(uint16_t port);
+        void Stop();
+        bool IsRunning() const;
+
+        // === Veroeffentlichen (Haupt-Thread) ===
+        void PublishFrame(float frameTimeMs, float updateMs, float renderMs, size_t allocations);
+        void PublishEntityCount(MetricsEntityType type, size_t count);
+        void PublishGameState(GameState state);
+
+        // === Veroeffentlichen (Save-System, beliebiger Thread) ===
+        void RecordSaveWrite(float durationMs, bool success);
+
+        // === Bericht ===
+        std::string BuildReport() const;
+
+        // === Constants ===
+        static inline const size_t FRAME_WINDOW = 1024; // Zweierpotenz, ca. 17 s bei 60 FPS
+        static const int CLIENT_TIMEOUT_MS = 500;       // Lesen/Schreiben pro Anfrage, danach wird getrennt
+
+    private:
+        // === Singleton - Private Konstruktor ===
+        MetricsServer();
+        MetricsServer(const MetricsServer&) = delete;
+        MetricsServer& operator=(const MetricsServer&) = delete;
+
+        // === Private Hilfsfunktionen ===
+        void Run(uint16_t port);
+
+        // === Frame-Zeiten (Ringpuffer) ===
+        std::array<std::atomic<float>, FRAME_WINDOW> frameTimes;
+        std::atomic<size_t> frameCount;
+        std::atomic<float> updateTimeMs;
+        std::atomic<float> renderTimeMs;
+        std::atomic<size_t> frameAllocations;
+
+        // === Spielzustand ===
+        std::array<std::atomic<size_t>, METRICS_ENTITY_TYPE_COUNT> entityCounts;
+        std::atomic<int> gameState;
+
+        // === Save-System ===
+        std::atomic<size_t> saveWrites;
+        std::atomic<size_t> saveWriteFailures;
+        std::atomic<float> lastSaveWriteMs;
+        std::atomic<float> maxSaveWriteMs;
+
+        // === Thread ===
+        std::thread worker;
+        std::atomic<bool> running;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
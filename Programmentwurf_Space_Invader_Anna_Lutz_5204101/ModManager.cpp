@@ -1,73 +1,71 @@
 #include "ModManager.h"
-#include "TextureManager.h"
-#include <fstream>
-#include <iostream>
 
 namespace SpaceInvaders {
 
+    namespace {
+
+        // Reihenfolge = ModType
+        constexpr CatalogEntry MOD_TABLE[] = {
+            { "Kein Mod",        "Normales Spiel ohne besondere Modifikationen", "mod_none",       0 },
+            { "Schnellfeuer",    "Startet mit erhoehter Schussfrequenz",         "mod_fastfire",   GameConfig::MOD_COST },
+            { "Schild",          "Startet mit aktivem Schutzschild",             "mod_shield",     GameConfig::MOD_COST },
+            { "Dreifach-Schuss", "Startet mit Dreifach-Schuss Faehigkeit",       "mod_tripleshot", GameConfig::MOD_COST },
+            { "Zeitlupe",        "Startet mit aktivierter Zeitlupe",             "mod_slowmo",     GameConfig::MOD_COST },
+        };
+
+        constexpr CatalogLayout MOD_LAYOUT = { 96.0f, 160.0f, 150.0f, 14, 16, true };
+
+    } // namespace
+
     // === Konstruktor ===
     ModManager::ModManager()
-        : currentSelection(0)
+        : catalog(MOD_TABLE, SaveContainer::SECTION_MOD_UNLOCKS, MOD_LAYOUT)
+        , currentSelection(0)
         , selectedMod(MOD_NONE)
         , modConfirmed(false)
         , notEnoughCoinsTimer(0.0f)
+        , inputManager(nullptr)
     {
     }
 
     // === Initialisierung ===
     bool ModManager::Initialize() {
-        InitializeModData();
-        LoadModUnlocks();
+        catalog.LoadUnlocks();
         return true;
     }
 
-    void ModManager::LoadModUnlocks() {
-        std::ifstream file(GameConfig::MOD_UNLOCKS_FILE);
-
-        // Standardmig alle gesperrt auer MOD_NONE
-        for (auto& mod : mods) {
-            mod.isUnlocked = (mod.type == MOD_NONE);
-        }
-
-        if (file.is_open()) {
-            int modType;
-            while (file >> modType) {
-                if (modType >= 0 && modType < MOD_COUNT) {
-                    mods[modType].isUnlocked = true;
-                }
-            }
-            file.close();
-        }
+    void ModManager::SetSaveSystem(SaveSystem* system) {
+        catalog.SetSaveSystem(system);
     }
 
-    void ModManager::SaveModUnlocks() {
-        std::ofstream file(GameConfig::MOD_UNLOCKS_FILE);
-        if (file.is_open()) {
-            for (const auto& mod : mods) {
-                if (mod.isUnlocked) {
-                    file << (int)mod.type << "\n";
-                }
-            }
-            file.close();
-        }
+    void ModManager::SetInputManager(const InputManager* input) {
+        inputManager = input;
     }
 
     // === Mod-Auswahl ===
     ModManager::SelectionResult ModManager::UpdateModSelection(float deltaTime, int& coins) {
-        UpdateButtonAnimations(deltaTime);
-
         if (notEnoughCoinsTimer > 0) {
             notEnoughCoinsTimer -= deltaTime;
         }
 
-        HandleInput(coins);
+        switch (catalog.HandleShopInput(*inputManager, currentSelection, coins)) {
+        case ModCatalog::CHOOSE_CONFIRMED:
+            selectedMod = ModCatalog::GetType(currentSelection);
+            modConfirmed = true;
+            break;
+        case ModCatalog::CHOOSE_NOT_ENOUGH_COINS:
+            notEnoughCoinsTimer = 2.0f;
+            break;
+        default:
+            break;
+        }
 
         if (modConfirmed) {
             return MOD_CHOSEN;
         }
 
         // Prfen auf Zurck-Input
-        if (inputManager.GetNavigationInput() == InputManager::NAV_BACK) {
+        if (inputManager->GetNavigationInput() == InputManager::NAV_BACK) {
             return BACK_PRESSED;
         }
 
@@ -84,13 +82,11 @@ namespace SpaceInvaders {
         DrawText(title, (GameConfig::SCREEN_WIDTH - titleWidth) / 2, 50, 40, WHITE);
 
         // Coins anzeigen
-        RenderCoinDisplay(coins);
+        ModCatalog::RenderCoinDisplay(coins);
 
-        // Mod-Grid rendern
-        RenderModGrid();
-
-        // Beschreibung des aktuell ausgewhlten Mods
-        RenderModDescription(mods[currentSelection].type);
+        // Mod-Grid und Beschreibung des aktuell ausgewhlten Mods
+        catalog.RenderGrid(currentSelection, catalog.GetHoveredIndex(*inputManager), YELLOW);
+        catalog.RenderDescription(currentSelection);
 
         // Anweisungen
         DrawText("Pfeiltasten: Navigieren | ENTER: Auswaehlen",
@@ -118,281 +114,9 @@ namespace SpaceInvaders {
         notEnoughCoinsTimer = 0.0f;
     }
 
-    // === Mod-Informationen ===
-    const ModInfo& ModManager::GetModInfo(ModType type) const {
-        return mods[(int)type];
-    }
-
-    std::string ModManager::GetModDescription(ModType type) const {
-        return mods[(int)type].description;
-    }
-
-    bool ModManager::IsModUnlocked(ModType type) const {
-        return mods[(int)type].isUnlocked;
-    }
-
-    bool ModManager::CanAfford(ModType type, int coins) const {
-        return coins >= mods[(int)type].cost;
-    }
-
-    // === Mod kaufen ===
-    bool ModManager::PurchaseMod(ModType type, int& coins) {
-        if (IsModUnlocked(type)) return true;
-
-        if (CanAfford(type, coins)) {
-            coins -= mods[(int)type].cost;
-            mods[(int)type].isUnlocked = true;
-            SaveModUnlocks();
-            return true;
-        }
-
-        return false;
-    }
-
-    // === Private Hilfsfunktionen ===
-    void ModManager::InitializeModData() {
-        mods.resize(MOD_COUNT);
-
-        // Kein Mod (kostenlos)
-        mods[MOD_NONE] = {
-            MOD_NONE,
-            "Kein Mod",
-            "Normales Spiel ohne besondere Modifikationen",
-            0,
-            true, // Immer freigeschaltet
-            {}
-        };
-
-        // FastFire Mod
-        mods[MOD_FASTFIRE] = {
-            MOD_FASTFIRE,
-            "Schnellfeuer",
-            "Startet mit erhoehter Schussfrequenz",
-            GameConfig::MOD_COST,
-            false,
-            {}
-        };
-
-        // Shield Mod
-        mods[MOD_SHIELD] = {
-            MOD_SHIELD,
-            "Schild",
-            "Startet mit aktivem Schutzschild",
-            GameConfig::MOD_COST,
-            false,
-            {}
-        };
-
-        // TripleShot Mod
-        mods[MOD_TRIPLESHOT] = {
-            MOD_TRIPLESHOT,
-            "Dreifach-Schuss",
-            "Startet mit Dreifach-Schuss Faehigkeit",
-            GameConfig::MOD_COST,
-            false,
-            {}
-        };
-
-        // SlowMo Mod
-        mods[MOD_SLOWMO] = {
-            MOD_SLOWMO,
-            "Zeitlupe",
-            "Startet mit aktivierter Zeitlupe",
-            GameConfig::MOD_COST,
-            false,
-            {}
-        };
-    }
-
-    void ModManager::HandleInput(int& coins) {
-        auto navInput = inputManager.GetNavigationInput();
-
-        switch (navInput) {
-        case InputManager::NAV_LEFT:
-            currentSelection = (currentSelection - 1 + MOD_COUNT) % MOD_COUNT;
-            break;
-
-        case InputManager::NAV_RIGHT:
-            currentSelection = (currentSelection + 1) % MOD_COUNT;
-            break;
-
-        case InputManager::NAV_CONFIRM: {
-            ModType selectedType = mods[currentSelection].type;
-
-            if (IsModUnlocked(selectedType)) {
-                selectedMod = selectedType;
-                modConfirmed = true;
-            }
-            else if (PurchaseMod(selectedType, coins)) {
-                selectedMod = selectedType;
-                modConfirmed = true;
-            }
-            else {
-                notEnoughCoinsTimer = 2.0f;
-            }
-            break;
-        }
-
-        default:
-            break;
-        }
-
-        // Maus-Input fr Mod-Karten
-        for (int i = 0; i < MOD_COUNT; i++) {
-            Rectangle modRect = GetModRect(i);
-            if (UpdateAnimatedButton(modRect, mods[i].buttonState, WHITE, YELLOW, ORANGE, GetFrameTime())) {
-                currentSelection = i;
-                ModType selectedType = mods[i].type;
-
-                if (IsModUnlocked(selectedType)) {
-                    selectedMod = selectedType;
-                    modConfirmed = true;
-                }
-                else if (PurchaseMod(selectedType, coins)) {
-                    selectedMod = selectedType;
-                    modConfirmed = true;
-                }
-                else {
-                    notEnoughCoinsTimer = 2.0f;
-                }
-            }
-        }
-    }
-
-    void ModManager::RenderModGrid() {
-        const float modSize = 96.0f;
-        const float spacing = 160.0f;
-        const float startX = (GameConfig::SCREEN_WIDTH - (MOD_COUNT * spacing - (spacing - modSize))) / 2;
-        const float startY = 150.0f;
-
-        for (int i = 0; i < MOD_COUNT; i++) {
-            Rectangle modRect = {
-                startX + i * spacing,
-                startY,
-                modSize,
-                modSize
-            };
-
-            bool isSelected = (i == currentSelection);
-            bool isHovered = inputManager.IsMouseOverRectangle(modRect);
-
-            RenderModCard(mods[i], modRect, isSelected, isHovered);
-        }
-    }
-
-    void ModManager::RenderModCard(const ModInfo& mod, Rectangle rect, bool isSelected, bool isHovered) {
-        auto& textureManager = TextureManager::GetInstance();
-
-        // Rahmen-Farbe bestimmen
-        Color frameColor = WHITE;
-        float frameThickness = 2.0f;
-
-        if (mod.isUnlocked) {
-            if (isSelected) {
-                frameColor = YELLOW;
-                frameThickness = 4.0f;
-
-                // Leuchtender Effekt fr ausgewhlte Mods
-                DrawRectangleRec({ rect.x - 5, rect.y - 5, rect.width + 10, rect.height + 10 },
-                    Fade(YELLOW, 0.3f));
-            }
-            else if (isHovered) {
-                frameColor = LIGHTGRAY;
-                frameThickness = 3.0f;
-            }
-        }
-        else {
-            frameColor = DARKGRAY;
-        }
-
-        // Hintergrund
-        DrawRectangleRec(rect, Fade(BLACK, 0.8f));
-
-        // Mod-Icon
-        Texture2D modTexture = textureManager.GetModIconTexture(mod.type);
-        Color tint = mod.isUnlocked ? WHITE : Fade(GRAY, 0.5f);
-        TextureManager::DrawTextureScaled(modTexture, rect.x + 10, rect.y + 10, rect.width - 20, rect.height - 20, tint);
-
-        // Rahmen
-        DrawRectangleLinesEx(rect, frameThickness, frameColor);
-
-        // Schloss-Symbol fr gesperrte Mods
-        if (!mod.isUnlocked) {
-            DrawText("LOCKED", rect.x + 15, rect.y + rect.height - 25, 16, RED);
-
-            // Kosten anzeigen
-            auto& coinTexture = textureManager.GetCoinTexture();
-            TextureManager::DrawTextureScaled(coinTexture, rect.x + 5, rect.y + 5, 20, 20);
-            DrawText(TextFormat("%d", mod.cost), rect.x + 30, rect.y + 5, 16, YELLOW);
-        }
-
-        // Name unter dem Mod
-        const char* name = mod.name.c_str();
-        int nameWidth = MeasureText(name, 14);
-        DrawText(name, rect.x + (rect.width - nameWidth) / 2, rect.y + rect.height + 5, 14, WHITE);
-    }
-
-    void ModManager::RenderModDescription(ModType type) {
-        const ModInfo& mod = mods[(int)type];
-
-        // Beschreibungs-Box
-        Rectangle descBox = { 50, 350, GameConfig::SCREEN_WIDTH - 100, 100 };
-        DrawRectangleRec(descBox, Fade(DARKGRAY, 0.8f));
-        DrawRectangleLinesEx(descBox, 2, WHITE);
-
-        // Titel
-        DrawText(mod.name.c_str(), descBox.x + 20, descBox.y + 20, 24, YELLOW);
-
-        // Beschreibung
-        DrawText(mod.description.c_str(), descBox.x + 20, descBox.y + 50, 18, WHITE);
-
-        // Status
-        if (mod.isUnlocked) {
-            DrawText("FREIGESCHALTET", descBox.x + 20, descBox.y + 75, 16, GREEN);
-        }
-        else {
-            DrawText(TextFormat("Kosten: %d Coins", mod.cost), descBox.x + 20, descBox.y + 75, 16, ORANGE);
-        }
-    }
-
-    void ModManager::RenderCoinDisplay(int coins) {
-        auto& textureManager = TextureManager::GetInstance();
-        auto& coinTexture = textureManager.GetCoinTexture();
-
-        int x = GameConfig::SCREEN_WIDTH - 150;
-        int y = 20;
-        int fontSize = 30;
-
-        // Coins-Text
-        const char* coinText = TextFormat("%d", coins);
-        int textWidth = MeasureText(coinText, fontSize);
-        DrawText(coinText, x, y, fontSize, YELLOW);
-
-        // Coin-Icon
-        TextureManager::DrawTextureScaled(coinTexture,
-            x + textWidth + 10, y - 3,
-            fontSize + 6, fontSize + 6);
-    }
-
-    Rectangle ModManager::GetModRect(int index) {
-        const float modSize = 96.0f;
-        const float spacing = 160.0f;
-        const float startX = (GameConfig::SCREEN_WIDTH - (MOD_COUNT * spacing - (spacing - modSize))) / 2;
-        const float startY = 150.0f;
-
-        return {
-            startX + index * spacing,
-            startY,
-            modSize,
-            modSize
-        };
-    }
-
-    void ModManager::UpdateButtonAnimations(float deltaTime) {
-        for (auto& mod : mods) {
-            // Animation fr Hover-Effekte wird automatisch in UpdateAnimatedButton behandelt
-            // Hier knnten zustzliche Animationen hinzugefgt werden
-        }
+    // === Katalog ===
+    const ModManager::ModCatalog& ModManager::GetCatalog() const {
+        return catalog;
     }
 
 } // namespace SpaceInvaders
\ No newline at end of file
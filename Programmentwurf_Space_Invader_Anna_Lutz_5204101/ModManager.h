@@ -3,42 +3,34 @@
 #include "raylib.h"
 #include "GameConfig.h"
 #include "InputManager.h"
-#include <vector>
-#include <string>
+#include "SaveSystem.h"
+#include "UnlockCatalog.h"
 
 namespace SpaceInvaders {
 
-    /**
-     * @brief Mod-Informations-Struktur
-     */
-    struct ModInfo {
-        ModType type;
-        std::string name;
-        std::string description;
-        int cost;
-        bool isUnlocked;
-        ButtonState buttonState;
-    };
-
     /**
      * @brief ModManager - Verwaltet Modifikator-Auswahl und -Freischaltung
      *
      * Zustndig fr:
-     * - Mod-Freischaltung mit Coins
      * - Auswahl-Interface vor Spielstart
-     * - Mod-Informationen und Beschreibungen
-     * - Speichern/Laden der freigeschalteten Mods
+     * - Kauf, Freischaltung und Grid ber den Mod-Katalog
+     *   (Tabelle in ModManager.cpp)
      */
     class ModManager {
     public:
+        // === Constants ===
+        static const int MOD_COUNT = 5;
+
+        using ModCatalog = UnlockCatalog<ModType, MOD_COUNT>;
+
         // === Konstruktor & Destruktor ===
         ModManager();
         ~ModManager() = default;
 
         // === Initialisierung ===
         bool Initialize();
-        void LoadModUnlocks();
-        void SaveModUnlocks();
+        void SetSaveSystem(SaveSystem* system);
+        void SetInputManager(const InputManager* input);
 
         // === Mod-Auswahl ===
         enum SelectionResult {
@@ -52,21 +44,12 @@ namespace SpaceInvaders {
         ModType GetSelectedMod() const;
         void ResetSelection();
 
-        // === Mod-Informationen ===
-        const ModInfo& GetModInfo(ModType type) const;
-        std::string GetModDescription(ModType type) const;
-        bool IsModUnlocked(ModType type) const;
-        bool CanAfford(ModType type, int coins) const;
-
-        // === Mod kaufen ===
-        bool PurchaseMod(ModType type, int& coins);
-
-        // === Constants ===
-        static const int MOD_COUNT = 5;
+        // === Katalog (Namen, Kosten, Freischaltung) ===
+        const ModCatalog& GetCatalog() const;
 
     private:
-        // === Mod-Daten ===
-        std::vector<ModInfo> mods;
+        // === Mod-Katalog ===
+        ModCatalog catalog;
 
         // === Selection State ===
         int currentSelection;
@@ -75,19 +58,7 @@ namespace SpaceInvaders {
         float notEnoughCoinsTimer;
 
         // === Input ===
-        InputManager inputManager;
-
-        // === Private Hilfsfunktionen ===
-        void InitializeModData();
-        void HandleInput(int& coins);
-        void RenderModGrid();
-        void RenderModCard(const ModInfo& mod, Rectangle rect, bool isSelected, bool isHovered);
-        void RenderModDescription(ModType type);
-        void RenderCoinDisplay(int coins);
-        Rectangle GetModRect(int index);
-
-        // === Animation ===
-        void UpdateButtonAnimations(float deltaTime);
+        const InputManager* inputManager;  // gehrt Game, Snapshot des aktuellen Frames
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "MusicStreamer.h"
+#include "GameConfig.h"
+#include "Tracer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        uint32_t ReadLittleEndian(const uint8_t* bytes, int count) {
+            uint32_t value = 0;
+            for (int i = count - 1; i >= 0; i--) {
+                value = (value << 8) | bytes[i];
+            }
+            return value;
+        }
+
+    } // namespace
+
+    // === Konstruktor & Destruktor ===
+    MusicStreamer::MusicStreamer()
+        : dataStart(0)
+        , dataFrames(0)
+        , framesLeft(0)
+        , fileChannels(0)
+        , ring(RING_FRAMES * 2, 0.0f)
+        , chunk(CHUNK_FRAMES * 2, 0)
+        , writeFrame(0)
+        , readFrame(0)
+        , underruns(0)
+        , running(false)
+    {
+    }
+
+    MusicStreamer::~MusicStreamer() {
+        Stop();
+    }
+
+    // === Thread-Steuerung ===
+    bool MusicStreamer::Start(const std::string& filename) {
+        if (running.load()) return false;
+        if (!OpenWave(filename)) return false;
+
+        // Ring vor dem ersten Abspielen komplett fuellen
+        writeFrame.store(0);
+        readFrame.store(0);
+        while (FillRing()) {}
+
+        running.store(true);
+        worker = std::thread(&MusicStreamer::Run, this);
+        return true;
+    }
+
+    void MusicStreamer::Stop() {
+        running.store(false);
+        if (worker.joinable()) {
+            worker.join();
+        }
+        if (file.is_open()) {
+            file.close();
+        }
+    }
+
+    bool MusicStreamer::IsRunning() const {
+        return running.load();
+    }
+
+    // === Lesen ===
+    size_t MusicStreamer::Read(float* out, size_t frames) {
+        size_t read = readFrame.load(std::memory_order_relaxed);
+        size_t available = writeFrame.load(std::memory_order_acquire) - read;
+        size_t count = std::min(frames, available);
+
+        // Hoechstens zwei Abschnitte, falls der Bereich ueber das Ring-Ende geht
+        size_t first = std::min(count, RING_FRAMES - (read & (RING_FRAMES - 1)));
+        std::memcpy(out, &ring[(read & (RING_FRAMES - 1)) * 2], first * 2 * sizeof(float));
+        std::memcpy(out + first * 2, &ring[0], (count - first) * 2 * sizeof(float));
+
+        readFrame.store(read + count, std::memory_order_release);
+        if (count < frames) {
+            underruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    // === Statistik ===
+    size_t MusicStreamer::GetUnderrunCount() const {
+        return underruns.load(std::memory_order_relaxed);
+    }
+
+    // === Private Hilfsfunktionen ===
+    bool MusicStreamer::OpenWave(const std::string& filename) {
+        file.open(filename, std::ios::binary);
+        if (!file) {
+            Logger::Info("Audio: keine Musik gefunden (%s)", filename.c_str());
+            return false;
+        }
+
+        uint8_t header[12];
+        if (!file.read((char*)header, sizeof(header)) ||
+            std::memcmp(header, "RIFF", 4) != 0 || std::memcmp(header + 8, "WAVE", 4) != 0) {
+            Logger::Warning("Audio: %s ist keine WAV-Datei", filename.c_str());
+            file.close();
+            return false;
+        }
+
+        // Chunks durchgehen bis "data", "fmt " muss davor stehen
+        bool formatValid = false;
+        uint8_t chunkHeader[8];
+        while (file.read((char*)chunkHeader, sizeof(chunkHeader))) {
+            uint32_t size = ReadLittleEndian(chunkHeader + 4, 4);
+
+            if (std::memcmp(chunkHeader, "fmt ", 4) == 0 && size >= 16) {
+                uint8_t format[16];
+                file.read((char*)format, sizeof(format));
+                file.seekg(size - 16 + (size & 1), std::ios::cur);
+
+                uint32_t encoding = ReadLittleEndian(format, 2);
+                fileChannels = (int)ReadLittleEndian(format + 2, 2);
+                uint32_t sampleRate = ReadLittleEndian(format + 4, 4);
+                uint32_t bitsPerSample = ReadLittleEndian(format + 14, 2);
+
+                formatValid = encoding == 1 && bitsPerSample == 16 &&
+                    (fileChannels == 1 || fileChannels == 2) &&
+                    sampleRate == (uint32_t)GameConfig::AUDIO_SAMPLE_RATE;
+                if (!formatValid) {
+                    Logger::Warning("Audio: %s muss 16-Bit-PCM mit %d Hz sein (ist %u Bit, %u Hz, %d Kanaele)",
+                        filename.c_str(), GameConfig::AUDIO_SAMPLE_RATE, bitsPerSample, sampleRate, fileChannels);
+                    break;
+                }
+            }
+            else if (std::memcmp(chunkHeader, "data", 4) == 0 && formatValid) {
+                dataStart = file.tellg();
+                dataFrames = size / (uint32_t)(fileChannels * sizeof(int16_t));
+                framesLeft = dataFrames;
+                return dataFrames > 0;
+            }
+            else {
+                // Chunks sind auf gerade Laengen aufgefuellt
+                file.seekg(size + (size & 1), std::ios::cur);
+            }
+        }
+
+        file.close();
+        return false;
+    }
+
+    bool MusicStreamer::FillRing() {
+        size_t write = writeFrame.load(std::memory_order_relaxed);
+        size_t space = RING_FRAMES - (write - readFrame.load(std::memory_order_acquire));
+        if (space < CHUNK_FRAMES) return false;
+
+        // Am Dateiende von vorn beginnen
+        if (framesLeft == 0) {
+            file.clear();
+            file.seekg(dataStart);
+            framesLeft = dataFrames;
+        }
+
+        size_t frames = std::min<size_t>(CHUNK_FRAMES, framesLeft);
+        file.read((char*)chunk.data(), frames * fileChannels * sizeof(int16_t));
+        frames = (size_t)file.gcount() / (fileChannels * sizeof(int16_t));
+        if (frames == 0) {
+            framesLeft = 0;  // Datei kuerzer als angegeben, beim naechsten Mal von vorn
+            return false;
+        }
+        framesLeft -= (uint32_t)frames;
+
+        const float scale = 1.0f / 32768.0f;
+        for (size_t i = 0; i < frames; i++) {
+            float* target = &ring[((write + i) & (RING_FRAMES - 1)) * 2];
+            if (fileChannels == 2) {
+                target[0] = chunk[i * 2] * scale;
+                target[1] = chunk[i * 2 + 1] * scale;
+            }
+            else {
+                target[0] = target[1] = chunk[i] * scale;
+            }
+        }
+
+        writeFrame.store(write + frames, std::memory_order_release);
+        return true;
+    }
+
+    void MusicStreamer::Run() {
+        Tracer::GetInstance().SetThreadName("MusicStreamer");
+
+        while (running.load(std::memory_order_relaxed)) {
+            bool filled = false;
+            {
+                TraceScope trace("MusicStreamer::Fill");
+                while (running.load(std::memory_order_relaxed) && FillRing()) {
+                    filled = true;
+                }
+            }
+
+            // Ein Block reicht fuer ca. 90 ms, so oft muss nicht nachgesehen werden
+            if (!filled) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        }
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
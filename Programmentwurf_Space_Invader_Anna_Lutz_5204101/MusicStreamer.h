@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Streamt Hintergrundmusik blockweise von der Platte
+     *
+     * Ein eigener Thread liest unkomprimiertes 16-Bit-WAV in Bloecken von
+     * CHUNK_FRAMES, wandelt es in Stereo-floats um und schreibt es in einen
+     * Ringpuffer (ein Produzent, ein Konsument, lock-frei). Der Audio-Thread
+     * holt sich daraus mit Read genau so viel, wie er gerade mischt; am
+     * Dateiende beginnt die Musik von vorn.
+     *
+     * Die Datei muss mit AUDIO_SAMPLE_RATE vorliegen, resampelt wird nicht.
+     * Kommt der Lese-Thread nicht hinterher, liefert Read weniger Frames
+     * und zaehlt einen Unterlauf, der Rest bleibt still.
+     */
+    class MusicStreamer {
+    public:
+        // === Konstruktor & Destruktor ===
+        MusicStreamer();
+        ~MusicStreamer();
+
+        // === Thread-Steuerung (Haupt-Thread) ===
+        bool Start(const std::string& filename);
+        void Stop();
+        bool IsRunning() const;
+
+        // === Lesen (Audio-Thread, lock-frei) ===
+        size_t Read(float* out, size_t frames);  // Stereo interleaved, Rueckgabe = gelesene Frames
+
+        // === Statistik ===
+        size_t GetUnderrunCount() const;
+
+        // === Constants ===
+        static constexpr size_t RING_FRAMES = 32768;  // Zweierpotenz, ca. 0.75 s bei 44.1 kHz
+        static constexpr size_t CHUNK_FRAMES = 4096;
+
+    private:
+        // === Datei ===
+        std::ifstream file;
+        std::streamoff dataStart;
+        uint32_t dataFrames;
+        uint32_t framesLeft;
+        int fileChannels;
+
+        // === Ringpuffer (Stereo-Frames) ===
+        std::vector<float> ring;
+        std::vector<int16_t> chunk;
+        alignas(64) std::atomic<size_t> writeFrame;
+        alignas(64) std::atomic<size_t> readFrame;
+        std::atomic<size_t> underruns;
+
+        // === Thread ===
+        std::thread worker;
+        std::atomic<bool> running;
+
+        // === Private Hilfsfunktionen ===
+        bool OpenWave(const std::string& filename);
+        bool FillRing();  // false = Ring voll
+        void Run();
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
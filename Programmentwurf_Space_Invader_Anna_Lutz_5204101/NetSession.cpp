@@ -0,0 +1,365 @@
+#include "NetSession.h"
+#include "Logger.h"
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <mstcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace SpaceInvaders {
+
+    namespace {
+
+#ifdef _WIN32
+        using SocketHandle = SOCKET;
+        using AddressLength = int;
+        const SocketHandle INVALID_HANDLE = INVALID_SOCKET;
+
+        void CloseSocket(SocketHandle socket) {
+            closesocket(socket);
+        }
+#else
+        using SocketHandle = int;
+        using AddressLength = socklen_t;
+        const SocketHandle INVALID_HANDLE = -1;
+
+        void CloseSocket(SocketHandle socket) {
+            close(socket);
+        }
+#endif
+
+        // Magic (4) + Version (1) + Typ (1)
+        const size_t HEADER_SIZE = 6;
+        const size_t WELCOME_SIZE = 10;
+        const size_t INPUT_HEADER_SIZE = 17;
+        const size_t MAX_PACKET_SIZE = HEADER_SIZE + INPUT_HEADER_SIZE + NetSession::MAX_PACKET_INPUTS;
+
+        // === Little-Endian-Felder ===
+        void Put32(uint8_t* target, uint32_t value) {
+            for (int i = 0; i < 4; i++) target[i] = (uint8_t)(value >> (8 * i));
+        }
+
+        uint32_t Get32(const uint8_t* source) {
+            uint32_t value = 0;
+            for (int i = 0; i < 4; i++) value |= (uint32_t)source[i] << (8 * i);
+            return value;
+        }
+
+        void Put64(uint8_t* target, uint64_t value) {
+            Put32(target, (uint32_t)value);
+            Put32(target + 4, (uint32_t)(value >> 32));
+        }
+
+        uint64_t Get64(const uint8_t* source) {
+            return (uint64_t)Get32(source) | ((uint64_t)Get32(source + 4) << 32);
+        }
+
+    } // namespace
+
+    // === Konstruktor & Destruktor ===
+    NetSession::NetSession()
+        : socketHandle((intptr_t)INVALID_HANDLE)
+        , host(false)
+        , connected(false)
+        , peerKnown(false)
+        , peerAddress(0)
+        , peerPort(0)
+        , lastReceive(std::chrono::steady_clock::now())
+    {
+    }
+
+    NetSession::~NetSession() {
+        Close();
+    }
+
+    // === Verbindung ===
+    bool NetSession::Host(uint16_t port, const NetMatchSettings& matchSettings) {
+        host = true;
+        settings = matchSettings;
+        if (!Open(port)) return false;
+
+        Logger::Info("Netzwerk: warte auf Port %d auf den zweiten Spieler...", (int)port);
+        return true;
+    }
+
+    bool NetSession::Join(const std::string& address, uint16_t port) {
+        host = false;
+        if (!Open(0)) return false;
+
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+
+        addrinfo* result = nullptr;
+        if (getaddrinfo(address.c_str(), nullptr, &hints, &result) != 0 || !result) {
+            Logger::Error("Netzwerk: Adresse '%s' konnte nicht aufgeloest werden.", address.c_str());
+            Close();
+            return false;
+        }
+
+        peerAddress = ntohl(((const sockaddr_in*)result->ai_addr)->sin_addr.s_addr);
+        peerPort = port;
+        peerKnown = true;
+        freeaddrinfo(result);
+
+        Logger::Info("Netzwerk: verbinde mit %s:%d...", address.c_str(), (int)port);
+        return true;
+    }
+
+    bool NetSession::WaitForPeer(float timeoutSeconds) {
+        if ((SocketHandle)socketHandle == INVALID_HANDLE) return false;
+
+        auto start = std::chrono::steady_clock::now();
+        auto lastHello = start - std::chrono::seconds(1);
+        uint8_t buffer[MAX_PACKET_SIZE];
+
+        while (std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() < timeoutSeconds) {
+            // Client wiederholt HELLO, bis das WELCOME ankommt (UDP kann verlieren)
+            auto now = std::chrono::steady_clock::now();
+            if (!host && now - lastHello >= std::chrono::milliseconds(100)) {
+                Send(PACKET_HELLO, nullptr, 0);
+                lastHello = now;
+            }
+
+            PacketType type;
+            size_t length;
+            while (Receive(buffer, sizeof(buffer), type, length)) {
+                const uint8_t* payload = buffer + HEADER_SIZE;
+
+                if (host && type == PACKET_HELLO) {
+                    SendWelcome();
+                    connected = true;
+                }
+                else if (!host && type == PACKET_WELCOME && length >= WELCOME_SIZE) {
+                    settings.seed = Get64(payload);
+                    settings.difficulty = payload[8] <= DIFF_HARD ? (Difficulty)payload[8] : DIFF_MEDIUM;
+                    settings.inputDelay = payload[9];
+                    connected = true;
+                }
+            }
+
+            if (connected) {
+                Logger::Info("Netzwerk: verbunden (Seed %llu, Eingabe-Verzoegerung %d Frames).",
+                    (unsigned long long)settings.seed, settings.inputDelay);
+                ResetReceiveTimer();
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        Logger::Error("Netzwerk: keine Antwort der Gegenseite nach %.0f s.", timeoutSeconds);
+        return false;
+    }
+
+    void NetSession::Close() {
+        if ((SocketHandle)socketHandle == INVALID_HANDLE) return;
+
+        // Gegenseite nicht erst ins Timeout laufen lassen
+        if (connected) {
+            Send(PACKET_BYE, nullptr, 0);
+        }
+
+        CloseSocket((SocketHandle)socketHandle);
+        socketHandle = (intptr_t)INVALID_HANDLE;
+        connected = false;
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    bool NetSession::IsConnected() const {
+        return connected;
+    }
+
+    bool NetSession::IsHost() const {
+        return host;
+    }
+
+    int NetSession::GetLocalPlayer() const {
+        return host ? 0 : 1;
+    }
+
+    const NetMatchSettings& NetSession::GetSettings() const {
+        return settings;
+    }
+
+    float NetSession::GetSecondsSinceReceive() const {
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - lastReceive).count();
+    }
+
+    void NetSession::ResetReceiveTimer() {
+        lastReceive = std::chrono::steady_clock::now();
+    }
+
+    // === Eingaben ===
+    void NetSession::SendInputs(const NetInputPacket& packet) {
+        if (!connected) return;
+
+        uint8_t payload[INPUT_HEADER_SIZE + MAX_PACKET_INPUTS];
+        size_t count = packet.inputCount < MAX_PACKET_INPUTS ? packet.inputCount : MAX_PACKET_INPUTS;
+        Put32(payload, packet.firstFrame);
+        Put32(payload + 4, packet.ackFrame);
+        Put32(payload + 8, packet.checksumFrame);
+        Put32(payload + 12, packet.checksum);
+        payload[16] = (uint8_t)count;
+        for (size_t i = 0; i < count; i++) {
+            payload[INPUT_HEADER_SIZE + i] = packet.inputs[i];
+        }
+        Send(PACKET_INPUT, payload, INPUT_HEADER_SIZE + count);
+    }
+
+    bool NetSession::ReceiveInputs(NetInputPacket& packet) {
+        if (!connected) return false;
+
+        uint8_t buffer[MAX_PACKET_SIZE];
+        PacketType type;
+        size_t length;
+        while (Receive(buffer, sizeof(buffer), type, length)) {
+            const uint8_t* payload = buffer + HEADER_SIZE;
+
+            switch (type) {
+            case PACKET_HELLO:
+                // Unser WELCOME ging verloren, der Client fragt noch einmal
+                if (host) SendWelcome();
+                break;
+
+            case PACKET_BYE:
+                Logger::Info("Netzwerk: Gegenseite hat die Partie verlassen.");
+                connected = false;
+                return false;
+
+            case PACKET_INPUT:
+                if (length < INPUT_HEADER_SIZE || length < INPUT_HEADER_SIZE + payload[16]) break;
+                packet.firstFrame = Get32(payload);
+                packet.ackFrame = Get32(payload + 4);
+                packet.checksumFrame = Get32(payload + 8);
+                packet.checksum = Get32(payload + 12);
+                packet.inputCount = payload[16] < MAX_PACKET_INPUTS ? payload[16] : (uint8_t)MAX_PACKET_INPUTS;
+                for (int i = 0; i < packet.inputCount; i++) {
+                    packet.inputs[i] = payload[INPUT_HEADER_SIZE + i];
+                }
+                return true;
+
+            default:
+                break;
+            }
+        }
+        return false;
+    }
+
+    // === Private Hilfsfunktionen ===
+    bool NetSession::Open(uint16_t port) {
+#ifdef _WIN32
+        WSADATA wsaData;
+        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+            Logger::Error("Netzwerk: Winsock konnte nicht gestartet werden.");
+            return false;
+        }
+#endif
+
+        SocketHandle handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+        // Host auf allen Schnittstellen, Client auf einem freien Port
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+        if (handle == INVALID_HANDLE || bind(handle, (const sockaddr*)&address, sizeof(address)) != 0) {
+            Logger::Error("Netzwerk: UDP-Port %d konnte nicht belegt werden.", (int)port);
+            if (handle != INVALID_HANDLE) CloseSocket(handle);
+#ifdef _WIN32
+            WSACleanup();
+#endif
+            return false;
+        }
+
+        // Nicht blockierend: der Haupt-Thread liest einmal pro Frame alles Angekommene
+#ifdef _WIN32
+        u_long nonBlocking = 1;
+        ioctlsocket(handle, FIONBIO, &nonBlocking);
+
+        // Sonst meldet recvfrom nach einem ICMP "Port unreachable" WSAECONNRESET
+        BOOL reportReset = FALSE;
+        DWORD bytesReturned = 0;
+        WSAIoctl(handle, SIO_UDP_CONNRESET, &reportReset, sizeof(reportReset), nullptr, 0, &bytesReturned, nullptr, nullptr);
+#else
+        fcntl(handle, F_SETFL, fcntl(handle, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+        socketHandle = (intptr_t)handle;
+        return true;
+    }
+
+    void NetSession::Send(PacketType type, const uint8_t* payload, size_t length) {
+        if (!peerKnown || length > MAX_PACKET_SIZE - HEADER_SIZE) return;
+
+        uint8_t buffer[MAX_PACKET_SIZE];
+        Put32(buffer, MAGIC);
+        buffer[4] = VERSION;
+        buffer[5] = type;
+        for (size_t i = 0; i < length; i++) {
+            buffer[HEADER_SIZE + i] = payload[i];
+        }
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(peerPort);
+        address.sin_addr.s_addr = htonl(peerAddress);
+
+        // Verlorene Pakete sind eingeplant, Fehler werden nicht wiederholt
+        sendto((SocketHandle)socketHandle, (const char*)buffer, (int)(HEADER_SIZE + length), 0,
+            (const sockaddr*)&address, sizeof(address));
+    }
+
+    void NetSession::SendWelcome() {
+        uint8_t welcome[WELCOME_SIZE];
+        Put64(welcome, settings.seed);
+        welcome[8] = (uint8_t)settings.difficulty;
+        welcome[9] = (uint8_t)settings.inputDelay;
+        Send(PACKET_WELCOME, welcome, sizeof(welcome));
+    }
+
+    bool NetSession::Receive(uint8_t* buffer, size_t capacity, PacketType& type, size_t& payloadLength) {
+        while (true) {
+            sockaddr_in from{};
+            AddressLength fromLength = sizeof(from);
+            int received = (int)recvfrom((SocketHandle)socketHandle, (char*)buffer, (int)capacity, 0,
+                (sockaddr*)&from, &fromLength);
+            if (received < 0) return false;  // nichts mehr da
+
+            if ((size_t)received < HEADER_SIZE || Get32(buffer) != MAGIC || buffer[4] != VERSION) continue;
+
+            uint32_t fromAddress = ntohl(from.sin_addr.s_addr);
+            uint16_t fromPort = ntohs(from.sin_port);
+
+            // Der Host uebernimmt den ersten Absender eines HELLO als Gegenseite
+            if (!peerKnown) {
+                if (!host || buffer[5] != PACKET_HELLO) continue;
+                peerAddress = fromAddress;
+                peerPort = fromPort;
+                peerKnown = true;
+            }
+            else if (fromAddress != peerAddress || fromPort != peerPort) {
+                continue;
+            }
+
+            lastReceive = std::chrono::steady_clock::now();
+            type = (PacketType)buffer[5];
+            payloadLength = (size_t)received - HEADER_SIZE;
+            return true;
+        }
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
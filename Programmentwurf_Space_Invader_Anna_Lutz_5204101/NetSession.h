@@ -0,0 +1,101 @@
+#pragma once
+
+#include "GameConfig.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Vom Host festgelegte Parameter einer Netzwerk-Partie
+     */
+    struct NetMatchSettings {
+        uint64_t seed = 0;
+        Difficulty difficulty = DIFF_MEDIUM;
+        int inputDelay = GameConfig::NET_INPUT_DELAY;
+    };
+
+    /**
+     * @brief Eingaben eines Spielers ab firstFrame plus Quittung und Pruefsumme
+     *
+     * Jedes Paket wiederholt alle noch nicht quittierten Eingaben, verlorene
+     * Pakete muessen also nie einzeln nachgefordert werden.
+     */
+    struct NetInputPacket {
+        uint32_t firstFrame;
+        uint32_t ackFrame;        // erster Frame, dessen Eingabe der Gegenseite noch fehlt
+        uint32_t checksumFrame;   // 0 = keine Pruefsumme enthalten
+        uint32_t checksum;
+        uint8_t inputCount;
+        uint8_t inputs[64];
+    };
+
+    /**
+     * @brief UDP-Verbindung zwischen genau zwei Spielinstanzen
+     *
+     * Der Host wartet auf einem Port, der Client meldet sich mit HELLO und
+     * bekommt per WELCOME Seed, Schwierigkeitsgrad und Eingabe-Verzoegerung.
+     * Danach laufen nur noch Eingabe-Pakete, der Socket ist nicht blockierend
+     * und wird einmal pro Frame vom Haupt-Thread gelesen.
+     *
+     * Alle Felder werden explizit little endian geschrieben, beide Seiten
+     * duerfen also auch auf verschiedenen Rechnern laufen.
+     */
+    class NetSession {
+    public:
+        // === Konstruktor & Destruktor ===
+        NetSession();
+        ~NetSession();
+
+        NetSession(const NetSession&) = delete;
+        NetSession& operator=(const NetSession&) = delete;
+
+        // === Verbindung ===
+        bool Host(uint16_t port, const NetMatchSettings& matchSettings);
+        bool Join(const std::string& address, uint16_t port);
+        bool WaitForPeer(float timeoutSeconds);  // blockiert bis zum Handshake
+        void Close();
+
+        bool IsConnected() const;
+        bool IsHost() const;
+        int GetLocalPlayer() const;              // Host = Player 1, Client = Player 2
+        const NetMatchSettings& GetSettings() const;
+        float GetSecondsSinceReceive() const;
+        void ResetReceiveTimer();
+
+        // === Eingaben ===
+        void SendInputs(const NetInputPacket& packet);
+        bool ReceiveInputs(NetInputPacket& packet);  // nicht blockierend
+
+        // === Constants ===
+        static const uint32_t MAGIC = 0x544E4953;   // "SINT" little endian
+        // Bit 7: Festkomma-Simulation, beide Seiten muessen gleich rechnen
+        static const uint8_t VERSION = GameConfig::FIXED_POINT_SIMULATION ? 0x83 : 0x03;
+        static const int MAX_PACKET_INPUTS = sizeof(NetInputPacket::inputs);
+
+    private:
+        enum PacketType : uint8_t {
+            PACKET_HELLO,
+            PACKET_WELCOME,
+            PACKET_INPUT,
+            PACKET_BYE
+        };
+
+        intptr_t socketHandle;
+        bool host;
+        bool connected;
+        bool peerKnown;
+        uint32_t peerAddress;  // IPv4, Host-Byte-Order
+        uint16_t peerPort;
+        NetMatchSettings settings;
+        std::chrono::steady_clock::time_point lastReceive;
+
+        // === Private Hilfsfunktionen ===
+        bool Open(uint16_t port);
+        void Send(PacketType type, const uint8_t* payload, size_t length);
+        void SendWelcome();
+        bool Receive(uint8_t* buffer, size_t capacity, PacketType& type, size_t& payloadLength);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
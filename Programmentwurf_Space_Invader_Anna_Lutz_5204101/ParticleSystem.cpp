@@ -0,0 +1,153 @@
+#include "ParticleSystem.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+namespace SpaceInvaders {
+
+    // === Konstruktor ===
+    ParticleSystem::ParticleSystem()
+        : positionX(CAPACITY)
+        , positionY(CAPACITY)
+        , velocityX(CAPACITY)
+        , velocityY(CAPACITY)
+        , drag(CAPACITY)
+        , gravity(CAPACITY)
+        , life(CAPACITY)
+        , inverseLifetime(CAPACITY)
+        , size(CAPACITY)
+        , color(CAPACITY)
+        , count(0)
+        , randomState(0x9E3779B9u)
+    {
+    }
+
+    // === Erzeugen & Update ===
+    void ParticleSystem::Emit(ParticlePreset preset, Vector2 position) {
+        const ParticleEmitterPreset& emitter = PARTICLE_PRESETS[preset];
+        size_t emitCount = std::min<size_t>(emitter.count, CAPACITY - count);
+
+        for (size_t n = 0; n < emitCount; n++) {
+            size_t i = count++;
+            float angle = emitter.direction + RandomRange(-0.5f, 0.5f) * emitter.spread;
+            float speed = RandomRange(emitter.minSpeed, emitter.maxSpeed);
+            float lifetime = RandomRange(emitter.minLifetime, emitter.maxLifetime);
+            float blend = RandomRange(0.0f, 1.0f);
+            const Color& from = emitter.colors[0];
+            const Color& to = emitter.colors[1];
+
+            positionX[i] = position.x;
+            positionY[i] = position.y;
+            velocityX[i] = cosf(angle) * speed;
+            velocityY[i] = sinf(angle) * speed;
+            drag[i] = emitter.drag;
+            gravity[i] = emitter.gravity;
+            life[i] = lifetime;
+            inverseLifetime[i] = 1.0f / lifetime;
+            size[i] = RandomRange(emitter.minSize, emitter.maxSize);
+            color[i] = {
+                (unsigned char)(from.r + (to.r - from.r) * blend),
+                (unsigned char)(from.g + (to.g - from.g) * blend),
+                (unsigned char)(from.b + (to.b - from.b) * blend),
+                255
+            };
+        }
+    }
+
+    void ParticleSystem::Update(float deltaTime) {
+        // Je Schleife nur wenige Arrays und keine Verzweigung: so bleiben die
+        // Alias-Pruefungen des Compilers klein und jede Schleife wird vektorisiert
+        float* px = positionX.data();
+        float* py = positionY.data();
+        float* vx = velocityX.data();
+        float* vy = velocityY.data();
+        const float* damping = drag.data();
+        const float* fall = gravity.data();
+        float* remaining = life.data();
+        const size_t n = count;
+
+        for (size_t i = 0; i < n; i++) {
+            vx[i] -= vx[i] * damping[i] * deltaTime;
+        }
+        for (size_t i = 0; i < n; i++) {
+            vy[i] += (fall[i] - vy[i] * damping[i]) * deltaTime;
+        }
+        for (size_t i = 0; i < n; i++) {
+            px[i] += vx[i] * deltaTime;
+        }
+        for (size_t i = 0; i < n; i++) {
+            py[i] += vy[i] * deltaTime;
+        }
+        for (size_t i = 0; i < n; i++) {
+            remaining[i] -= deltaTime;
+        }
+
+        // Abgelaufene Partikel durch das letzte ersetzen (Reihenfolge egal)
+        for (size_t i = 0; i < count;) {
+            if (life[i] > 0.0f) {
+                i++;
+                continue;
+            }
+
+            size_t last = --count;
+            positionX[i] = positionX[last];
+            positionY[i] = positionY[last];
+            velocityX[i] = velocityX[last];
+            velocityY[i] = velocityY[last];
+            drag[i] = drag[last];
+            gravity[i] = gravity[last];
+            life[i] = life[last];
+            inverseLifetime[i] = inverseLifetime[last];
+            size[i] = size[last];
+            color[i] = color[last];
+        }
+    }
+
+    void ParticleSystem::Clear() {
+        count = 0;
+    }
+
+    // === Render ===
+    void ParticleSystem::Render() const {
+        if (count == 0) return;
+
+        // Ein Batch fuer alle Partikel, rlgl teilt ihn selbst an der Puffergrenze.
+        // Die Standard-Textur ist 1x1 weiss, Texturkoordinaten sind egal.
+        BeginBlendMode(BLEND_ADDITIVE);
+        rlSetTexture(rlGetTextureIdDefault());
+        rlBegin(RL_QUADS);
+
+        for (size_t i = 0; i < count; i++) {
+            float alpha = std::min(life[i] * inverseLifetime[i], 1.0f);
+            float half = size[i] * 0.5f;
+            float left = positionX[i] - half;
+            float top = positionY[i] - half;
+            float right = positionX[i] + half;
+            float bottom = positionY[i] + half;
+
+            rlColor4ub(color[i].r, color[i].g, color[i].b, (unsigned char)(alpha * 255.0f));
+            rlVertex2f(left, top);
+            rlVertex2f(left, bottom);
+            rlVertex2f(right, bottom);
+            rlVertex2f(right, top);
+        }
+
+        rlEnd();
+        rlSetTexture(0);
+        EndBlendMode();
+    }
+
+    // === Getters ===
+    size_t ParticleSystem::GetCount() const {
+        return count;
+    }
+
+    // === Zufall ===
+    float ParticleSystem::RandomRange(float min, float max) {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+        return min + (max - min) * (float)(randomState >> 8) * (1.0f / 16777216.0f);
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    // === Emitter-Vorlagen (Index in PARTICLE_PRESETS) ===
+    enum ParticlePreset : uint8_t {
+        PARTICLES_ENEMY_DEATH,
+        PARTICLES_BOSS_DEATH,
+        PARTICLES_BULLET_TRAIL,
+        PARTICLES_POWERUP_PICKUP,
+        PARTICLE_PRESET_COUNT
+    };
+
+    /**
+     * @brief Gemeinsame Daten eines Emitters (Flyweight wie die Archetypen)
+     *
+     * Jedes Partikel bekommt Geschwindigkeit, Lebensdauer, Groesse und Farbe
+     * zufaellig zwischen den Grenzen. Winkel im Bogenmass, 0 = rechts,
+     * PI / 2 = nach unten; spread ist die volle Breite des Faechers.
+     */
+    struct ParticleEmitterPreset {
+        uint16_t count;
+        float direction;
+        float spread;
+        float minSpeed, maxSpeed;
+        float minLifetime, maxLifetime;
+        float minSize, maxSize;
+        float drag;         // Anteil der Geschwindigkeit, der pro Sekunde verloren geht
+        float gravity;      // px/s^2 nach unten
+        Color colors[2];
+    };
+
+    inline constexpr ParticleEmitterPreset PARTICLE_PRESETS[] = {
+        // ENEMY_DEATH: Funken in alle Richtungen
+        { 48, 0.0f, 2.0f * PI, 60.0f, 260.0f, 0.35f, 0.9f, 2.0f, 4.0f, 2.5f, 0.0f, { ORANGE, YELLOW } },
+        // BOSS_DEATH: viele Truemmer, die langsam nach unten fallen
+        { 600, 0.0f, 2.0f * PI, 80.0f, 520.0f, 0.8f, 2.0f, 2.0f, 6.0f, 1.2f, 120.0f, { RED, ORANGE } },
+        // BULLET_TRAIL: kurzer Schweif gegen die Flugrichtung
+        { 1, PI / 2.0f, 0.6f, 10.0f, 40.0f, 0.15f, 0.3f, 1.5f, 2.5f, 4.0f, 0.0f, { SKYBLUE, WHITE } },
+        // POWERUP_PICKUP: gleichmaessiger Ring
+        { 64, 0.0f, 2.0f * PI, 120.0f, 160.0f, 0.4f, 0.6f, 2.0f, 3.0f, 1.5f, 0.0f, { GOLD, WHITE } }
+    };
+
+    static_assert(sizeof(PARTICLE_PRESETS) / sizeof(PARTICLE_PRESETS[0]) == PARTICLE_PRESET_COUNT,
+        "PARTICLE_PRESETS braucht einen Eintrag pro ParticlePreset");
+
+    /**
+     * @brief Partikel fuer Explosionen, Schweife und Truemmer
+     *
+     * Datenorientiert: jede Eigenschaft liegt in einem eigenen Array
+     * (Structure of Arrays), alle Arrays werden im Konstruktor einmal auf
+     * CAPACITY angelegt. Update ist eine verzweigungsfreie Schleife ueber
+     * zusammenhaengende floats, die der Compiler vektorisiert; abgelaufene
+     * Partikel werden danach per Swap-Remove entfernt. Ist das Budget voll,
+     * werden neue Partikel verworfen - die Kosten pro Frame bleiben begrenzt
+     * und im laufenden Spiel wird nichts allokiert.
+     *
+     * Rein optisch: eigener Zufallsgenerator, nicht Teil der Snapshots,
+     * die Simulation (GameRandom, Replays, Rollback) bleibt unberuehrt.
+     * Render zeichnet alle Partikel als Quads in einem rlgl-Batch.
+     */
+    class ParticleSystem {
+    public:
+        ParticleSystem();
+
+        // === Erzeugen & Update ===
+        void Emit(ParticlePreset preset, Vector2 position);
+        void Update(float deltaTime);
+        void Clear();
+
+        // === Render ===
+        void Render() const;
+
+        // === Getters ===
+        size_t GetCount() const;
+
+        // === Constants ===
+        static const size_t CAPACITY = 50000;
+
+    private:
+        // === Structure of Arrays ===
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> drag;
+        std::vector<float> gravity;
+        std::vector<float> life;             // Restzeit in Sekunden
+        std::vector<float> inverseLifetime;  // fuer die Ausblendung
+        std::vector<float> size;
+        std::vector<Color> color;
+        size_t count;
+
+        // === Zufall (xorshift32, nur Optik) ===
+        uint32_t randomState;
+        float RandomRange(float min, float max);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "Player.h"
 #include "TextureManager.h"
+#include "DifficultyProfile.h"
+#include <algorithm>
+#include <cstring>
 
 namespace SpaceInvaders {
 
@@ -8,7 +11,7 @@ namespace SpaceInvaders {
     const float Player::AVATAR_HEIGHT = 120.0f;
 
     // === Konstruktor ===
-    Player::Player(AvatarType avatarType, Vector2 startPosition)
+    Player::Player(AvatarType avatarType, SimVector2 startPosition)
         : avatarType(avatarType)
         , position(startPosition)
         , lives(3)
@@ -16,10 +19,10 @@ namespace SpaceInvaders {
         , score(0)
         , shootRequested(false)
         , shootCooldown(0.3f)
-        , shootTimer(0.0f)
+        , lastShotTick(TimerWheel::GetGameTimers().GetCurrentTick())
         , shieldStrength(0)
         , startMod(MOD_NONE)
-        , movementSpeed(320.0f)
+        , movementSpeed(320)
     {
         CalculateAvatarBonuses();
         UpdateBounds();
@@ -29,31 +32,39 @@ namespace SpaceInvaders {
         lives = maxLives;
     }
 
-    // === Update ===
-    void Player::Update(float deltaTime, Difficulty difficulty) {
-        // Basis-Werte nach Schwierigkeitsgrad anpassen
-        float baseSpeed = GameConfig::GetPlayerMovementSpeed(difficulty);
-        movementSpeed = baseSpeed * movementMultiplier;
-
-        float baseCooldown = GameConfig::GetPlayerShootCooldown(difficulty);
-        shootCooldown = baseCooldown / fireRateMultiplier;
+    // === Destruktor ===
+    Player::~Player() {
+        // Ausstehende PowerUp-Ablufe verweisen auf diesen Spieler
+        StopPowerUp(shieldState);
+        StopPowerUp(tripleShotState);
+        StopPowerUp(fastFireState);
+        StopPowerUp(homingState);
+        StopPowerUp(laserState);
+    }
 
-        // PowerUps aktualisieren
-        UpdatePowerUps(deltaTime);
-        UpdateShootCooldown(deltaTime);
+    // === Update ===
+    template <typename Profile>
+    void Player::Update() {
+        // Basis-Werte des Schwierigkeitsgrads sind Compile-Zeit-Konstanten
+        movementSpeed = SimScalar(Profile::VALUES.playerMovementSpeed * movementMultiplier);
+        shootCooldown = Profile::VALUES.playerShootCooldown / fireRateMultiplier;
 
         // Position-Bounds aktualisieren
         UpdateBounds();
         ClampPosition();
     }
 
+    template void Player::Update<EasyProfile>();
+    template void Player::Update<MediumProfile>();
+    template void Player::Update<HardProfile>();
+
     // === Render ===
     void Player::Render() const {
         auto& textureManager = TextureManager::GetInstance();
         Texture2D avatarTexture = textureManager.GetAvatarTexture(avatarType);
 
         TextureManager::DrawTextureScaled(avatarTexture,
-            position.x, position.y,
+            ToFloat(position.x), ToFloat(position.y),
             AVATAR_WIDTH, AVATAR_HEIGHT);
     }
 
@@ -61,8 +72,8 @@ namespace SpaceInvaders {
         if (!HasShield()) return;
 
         Vector2 center = {
-            position.x + AVATAR_WIDTH / 2,
-            position.y + AVATAR_HEIGHT / 2
+            ToFloat(position.x) + AVATAR_WIDTH / 2,
+            ToFloat(position.y) + AVATAR_HEIGHT / 2
         };
 
         float outerRadius = AVATAR_WIDTH * 0.7f;
@@ -81,48 +92,52 @@ namespace SpaceInvaders {
     }
 
     // === Input Handling ===
-    void Player::HandleInput(bool leftPressed, bool rightPressed, bool shootPressed) {
+    void Player::HandleInput(bool leftPressed, bool rightPressed, bool shootPressed, float deltaTime) {
         // Bewegung
+        SimScalar step = movementSpeed * SimScalar(deltaTime);
         if (leftPressed) {
-            position.x -= movementSpeed * GetFrameTime();
+            position.x -= step;
         }
         if (rightPressed) {
-            position.x += movementSpeed * GetFrameTime();
+            position.x += step;
         }
 
         // Schieen
         if (shootPressed && CanShoot()) {
             shootRequested = true;
-            shootTimer = 0.0f;
+            lastShotTick = TimerWheel::GetGameTimers().GetCurrentTick();
         }
     }
 
     // === Position & Bounds ===
-    void Player::SetPosition(Vector2 newPosition) {
+    void Player::SetPosition(SimVector2 newPosition) {
         position = newPosition;
         UpdateBounds();
     }
 
-    Vector2 Player::GetPosition() const {
+    SimVector2 Player::GetPosition() const {
         return position;
     }
 
-    Rectangle Player::GetBounds() const {
+    SimRect Player::GetBounds() const {
         return bounds;
     }
 
     void Player::UpdateBounds() {
-        bounds = { position.x, position.y, AVATAR_WIDTH, AVATAR_HEIGHT };
+        bounds = { position.x, position.y, SimScalar(AVATAR_WIDTH), SimScalar(AVATAR_HEIGHT) };
     }
 
     void Player::ClampPosition() {
+        SimScalar maxX = SimScalar(GameConfig::SCREEN_WIDTH - AVATAR_WIDTH);
+        SimScalar maxY = SimScalar(GameConfig::SCREEN_HEIGHT - AVATAR_HEIGHT);
+
         if (position.x < 0) position.x = 0;
-        if (position.x > GameConfig::SCREEN_WIDTH - AVATAR_WIDTH) {
-            position.x = GameConfig::SCREEN_WIDTH - AVATAR_WIDTH;
+        if (position.x > maxX) {
+            position.x = maxX;
         }
         if (position.y < 0) position.y = 0;
-        if (position.y > GameConfig::SCREEN_HEIGHT - AVATAR_HEIGHT) {
-            position.y = GameConfig::SCREEN_HEIGHT - AVATAR_HEIGHT;
+        if (position.y > maxY) {
+            position.y = maxY;
         }
         UpdateBounds();
     }
@@ -137,11 +152,9 @@ namespace SpaceInvaders {
     }
 
     bool Player::CanShoot() const {
-        return shootTimer >= shootCooldown;
-    }
-
-    void Player::UpdateShootCooldown(float deltaTime) {
-        shootTimer += deltaTime;
+        // Cooldown als Tick-Vergleich, kein eigener Timer pro Frame
+        uint64_t elapsed = TimerWheel::GetGameTimers().GetTicksSince(lastShotTick);
+        return elapsed >= TimerWheel::SecondsToTicks(shootCooldown);
     }
 
     // === Health & Score ===
@@ -169,17 +182,19 @@ namespace SpaceInvaders {
         }
     }
 
-    void Player::Reset(Vector2 newPosition) {
+    void Player::Reset(SimVector2 newPosition) {
         position = newPosition;
         lives = maxLives;
         score = 0;
         shootRequested = false;
-        shootTimer = 0.0f;
+        lastShotTick = TimerWheel::GetGameTimers().GetCurrentTick();
 
         // PowerUps zurcksetzen
-        shieldState = {};
-        tripleShotState = {};
-        fastFireState = {};
+        StopPowerUp(shieldState);
+        StopPowerUp(tripleShotState);
+        StopPowerUp(fastFireState);
+        StopPowerUp(homingState);
+        StopPowerUp(laserState);
         shieldStrength = 0;
 
         UpdateBounds();
@@ -219,49 +234,24 @@ namespace SpaceInvaders {
 
     // === PowerUp System ===
     void Player::ActivateShield(int strength, float duration) {
-        shieldState.isActive = true;
-        shieldState.timer = 0.0f;
-        shieldState.duration = duration;
         shieldStrength = strength;
+        StartPowerUp(shieldState, duration);
     }
 
     void Player::ActivateTripleShot(float duration) {
-        tripleShotState.isActive = true;
-        tripleShotState.timer = 0.0f;
-        tripleShotState.duration = duration;
+        StartPowerUp(tripleShotState, duration);
     }
 
     void Player::ActivateFastFire(float duration) {
-        fastFireState.isActive = true;
-        fastFireState.timer = 0.0f;
-        fastFireState.duration = duration;
-    }
-
-    void Player::UpdatePowerUps(float deltaTime) {
-        // Shield Update
-        if (shieldState.isActive) {
-            shieldState.timer += deltaTime;
-            if (shieldState.timer >= shieldState.duration || shieldStrength <= 0) {
-                shieldState.isActive = false;
-                shieldStrength = 0;
-            }
-        }
+        StartPowerUp(fastFireState, duration);
+    }
 
-        // TripleShot Update
-        if (tripleShotState.isActive) {
-            tripleShotState.timer += deltaTime;
-            if (tripleShotState.timer >= tripleShotState.duration) {
-                tripleShotState.isActive = false;
-            }
-        }
+    void Player::ActivateHoming(float duration) {
+        StartPowerUp(homingState, duration);
+    }
 
-        // FastFire Update
-        if (fastFireState.isActive) {
-            fastFireState.timer += deltaTime;
-            if (fastFireState.timer >= fastFireState.duration) {
-                fastFireState.isActive = false;
-            }
-        }
+    void Player::ActivateLaser(float duration) {
+        StartPowerUp(laserState, duration);
     }
 
     // === PowerUp Queries ===
@@ -277,20 +267,36 @@ namespace SpaceInvaders {
         return fastFireState.isActive;
     }
 
+    bool Player::IsHomingActive() const {
+        return homingState.isActive;
+    }
+
+    bool Player::IsLaserActive() const {
+        return laserState.isActive;
+    }
+
     int Player::GetShieldStrength() const {
-        return shieldStrength;
+        return HasShield() ? shieldStrength : 0;
     }
 
     float Player::GetShieldTimer() const {
-        return shieldState.isActive ? shieldState.timer : 0.0f;
+        return GetPowerUpElapsed(shieldState);
     }
 
     float Player::GetTripleShotTimer() const {
-        return tripleShotState.isActive ? tripleShotState.timer : 0.0f;
+        return GetPowerUpElapsed(tripleShotState);
     }
 
     float Player::GetFastFireTimer() const {
-        return fastFireState.isActive ? fastFireState.timer : 0.0f;
+        return GetPowerUpElapsed(fastFireState);
+    }
+
+    float Player::GetHomingTimer() const {
+        return GetPowerUpElapsed(homingState);
+    }
+
+    float Player::GetLaserTimer() const {
+        return GetPowerUpElapsed(laserState);
     }
 
     void Player::HitShield() {
@@ -325,6 +331,50 @@ namespace SpaceInvaders {
         return startMod;
     }
 
+    // === Snapshot ===
+    Player::State Player::CaptureState() const {
+        State state = {};
+        std::strncpy(state.name, playerName.c_str(), sizeof(state.name) - 1);
+        state.position = position;
+        state.lives = lives;
+        state.maxLives = maxLives;
+        state.score = score;
+        state.shieldStrength = shieldStrength;
+        state.shootCooldown = shootCooldown;
+        state.movementSpeed = movementSpeed;
+        state.ticksSinceShot = (uint32_t)std::min<uint64_t>(
+            TimerWheel::GetGameTimers().GetTicksSince(lastShotTick), UINT32_MAX);
+        state.shield = CapturePowerUp(shieldState);
+        state.tripleShot = CapturePowerUp(tripleShotState);
+        state.fastFire = CapturePowerUp(fastFireState);
+        state.homing = CapturePowerUp(homingState);
+        state.laser = CapturePowerUp(laserState);
+        state.avatarType = (uint8_t)avatarType;
+        state.startMod = (uint8_t)startMod;
+        return state;
+    }
+
+    void Player::RestoreState(const State& state) {
+        playerName.assign(state.name, std::find(state.name, state.name + sizeof(state.name), '\0'));
+        startMod = (ModType)state.startMod;
+        position = state.position;
+        lives = state.lives;
+        maxLives = state.maxLives;
+        score = state.score;
+        shieldStrength = state.shieldStrength;
+        shootCooldown = state.shootCooldown;
+        movementSpeed = state.movementSpeed;
+        shootRequested = false;
+        lastShotTick = TimerWheel::GetGameTimers().GetCurrentTick() - state.ticksSinceShot;
+
+        RestorePowerUp(shieldState, state.shield);
+        RestorePowerUp(tripleShotState, state.tripleShot);
+        RestorePowerUp(fastFireState, state.fastFire);
+        RestorePowerUp(homingState, state.homing);
+        RestorePowerUp(laserState, state.laser);
+        UpdateBounds();
+    }
+
     // === Private Hilfsfunktionen ===
     void Player::CalculateAvatarBonuses() {
         // Standard-Werte
@@ -361,4 +411,47 @@ namespace SpaceInvaders {
         }
     }
 
+    void Player::StartPowerUp(PowerUpState& state, float duration) {
+        SchedulePowerUpExpiry(state, TimerWheel::SecondsToTicks(duration));
+        state.duration = duration;
+    }
+
+    void Player::SchedulePowerUpExpiry(PowerUpState& state, uint32_t ticks) {
+        auto& timers = TimerWheel::GetGameTimers();
+        timers.Cancel(state.expiry);
+
+        state.isActive = true;
+
+        // Ablauf einmal einplanen statt pro Frame hochzuzhlen
+        PowerUpState* target = &state;
+        state.expiry = timers.ScheduleTicks(ticks, [target]() {
+            target->isActive = false;
+            target->expiry = TimerWheel::INVALID_HANDLE;
+        });
+    }
+
+    void Player::StopPowerUp(PowerUpState& state) {
+        TimerWheel::GetGameTimers().Cancel(state.expiry);
+        state = {};
+    }
+
+    float Player::GetPowerUpElapsed(const PowerUpState& state) const {
+        if (!state.isActive) return 0.0f;
+        return state.duration - TimerWheel::GetGameTimers().GetRemainingSeconds(state.expiry);
+    }
+
+    Player::State::TimedPowerUp Player::CapturePowerUp(const PowerUpState& state) const {
+        if (!state.isActive) return { 0.0f, 0 };
+        return { state.duration, TimerWheel::GetGameTimers().GetRemainingTicks(state.expiry) };
+    }
+
+    void Player::RestorePowerUp(PowerUpState& state, const State::TimedPowerUp& saved) {
+        StopPowerUp(state);
+        if (saved.remainingTicks == 0) return;
+
+        // Mit den Rest-Ticks neu einplanen, die Gesamtdauer bleibt fuer die Anzeige erhalten
+        SchedulePowerUpExpiry(state, saved.remainingTicks);
+        state.duration = saved.duration;
+    }
+
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -2,7 +2,10 @@
 
 #include "raylib.h"
 #include "GameConfig.h"
+#include "TimerWheel.h"
+#include "SimMath.h"
 #include <string>
+#include <cstdint>
 
 namespace SpaceInvaders {
 
@@ -18,25 +21,27 @@ namespace SpaceInvaders {
     class Player {
     public:
         // === Konstruktor & Destruktor ===
-        Player(AvatarType avatarType, Vector2 startPosition);
-        ~Player() = default;
+        Player(AvatarType avatarType, SimVector2 startPosition);
+        ~Player();
+        Player(const Player&) = delete;
+        Player& operator=(const Player&) = delete;
 
         // === Update & Render ===
-        void Update(float deltaTime, Difficulty difficulty);
+        template <typename Profile>
+        void Update();  // Profile = DifficultyProfile<...>
         void Render() const;
         void RenderShield() const;
 
         // === Movement & Input ===
-        void HandleInput(bool leftPressed, bool rightPressed, bool shootPressed);
-        void SetPosition(Vector2 newPosition);
-        Vector2 GetPosition() const;
-        Rectangle GetBounds() const;
+        void HandleInput(bool leftPressed, bool rightPressed, bool shootPressed, float deltaTime);
+        void SetPosition(SimVector2 newPosition);
+        SimVector2 GetPosition() const;
+        SimRect GetBounds() const;
 
         // === Shooting System ===
         bool WantsToShoot();
         void ResetShootRequest();
         bool CanShoot() const;
-        void UpdateShootCooldown(float deltaTime);
 
         // === Health & Score ===
         int GetLives() const;
@@ -44,7 +49,7 @@ namespace SpaceInvaders {
         void AddScore(int points);
         void LoseLife();
         void GainLife();
-        void Reset(Vector2 newPosition);
+        void Reset(SimVector2 newPosition);
 
         // === Player Info ===
         void SetName(const std::string& name);
@@ -61,16 +66,21 @@ namespace SpaceInvaders {
         void ActivateShield(int strength, float duration);
         void ActivateTripleShot(float duration);
         void ActivateFastFire(float duration);
-        void UpdatePowerUps(float deltaTime);
+        void ActivateHoming(float duration);
+        void ActivateLaser(float duration);
 
         // === PowerUp Queries ===
         bool HasShield() const;
         bool IsTripleShotActive() const;
         bool IsFastFireActive() const;
+        bool IsHomingActive() const;
+        bool IsLaserActive() const;
         int GetShieldStrength() const;
         float GetShieldTimer() const;
         float GetTripleShotTimer() const;
         float GetFastFireTimer() const;
+        float GetHomingTimer() const;
+        float GetLaserTimer() const;
 
         // === PowerUp Events ===
         void HitShield(); // Reduziert Shield-Strke bei Treffer
@@ -79,6 +89,35 @@ namespace SpaceInvaders {
         void ApplyStartMod(ModType mod);
         ModType GetStartMod() const;
 
+        // === Snapshot (POD, Timer als Rest-Ticks, Avatar-Boni werden neu berechnet) ===
+        struct State {
+            struct TimedPowerUp {
+                float duration;
+                uint32_t remainingTicks;  // 0 = inaktiv
+            };
+
+            char name[16];
+            SimVector2 position;
+            int32_t lives;
+            int32_t maxLives;
+            int32_t score;
+            int32_t shieldStrength;
+            float shootCooldown;
+            SimScalar movementSpeed;
+            uint32_t ticksSinceShot;
+            TimedPowerUp shield;
+            TimedPowerUp tripleShot;
+            TimedPowerUp fastFire;
+            TimedPowerUp homing;
+            TimedPowerUp laser;
+            uint8_t avatarType;
+            uint8_t startMod;
+            uint8_t reserved[2];  // kein implizites Padding
+        };
+
+        State CaptureState() const;
+        void RestoreState(const State& state);  // Avatar muss schon im Konstruktor stimmen
+
         // === Constants ===
         static const float AVATAR_WIDTH;
         static const float AVATAR_HEIGHT;
@@ -90,9 +129,9 @@ namespace SpaceInvaders {
         ModType startMod;
 
         // === Position & Movement ===
-        Vector2 position;
-        float movementSpeed;
-        Rectangle bounds;
+        SimVector2 position;
+        SimScalar movementSpeed;
+        SimRect bounds;
 
         // === Health & Score ===
         int lives;
@@ -102,18 +141,20 @@ namespace SpaceInvaders {
         // === Shooting ===
         bool shootRequested;
         float shootCooldown;
-        float shootTimer;
+        uint64_t lastShotTick;
 
-        // === PowerUp States ===
+        // === PowerUp States (Ablauf ueber das TimerWheel) ===
         struct PowerUpState {
             bool isActive = false;
-            float timer = 0.0f;
             float duration = 0.0f;
+            TimerWheel::Handle expiry = TimerWheel::INVALID_HANDLE;
         };
 
         PowerUpState shieldState;
         PowerUpState tripleShotState;
         PowerUpState fastFireState;
+        PowerUpState homingState;
+        PowerUpState laserState;
         int shieldStrength;
 
         // === Avatar-spezifische Multiplikatoren ===
@@ -126,6 +167,12 @@ namespace SpaceInvaders {
         void CalculateAvatarBonuses();
         void UpdateBounds();
         void ClampPosition();
+        void StartPowerUp(PowerUpState& state, float duration);
+        void SchedulePowerUpExpiry(PowerUpState& state, uint32_t ticks);
+        void StopPowerUp(PowerUpState& state);
+        float GetPowerUpElapsed(const PowerUpState& state) const;
+        State::TimedPowerUp CapturePowerUp(const PowerUpState& state) const;
+        void RestorePowerUp(PowerUpState& state, const State::TimedPowerUp& saved);
     };
 
 } // namespace SpaceInvaders
\ No newline at end of file
@@ -9,25 +9,39 @@ namespace SpaceInvaders {
     const float PowerUp::DEFAULT_SPEED = 120.0f;
 
     // === Konstruktor ===
-    PowerUp::PowerUp(Vector2 startPosition, PowerUpType type)
+    PowerUp::PowerUp(SimVector2 startPosition, PowerUpType type)
         : powerUpType(type)
         , position(startPosition)
-        , speed(DEFAULT_SPEED)
-        , size(DEFAULT_SIZE)
+        , speed(SimScalar(DEFAULT_SPEED))
+        , size(SimScalar(DEFAULT_SIZE))
         , active(true)
-        , animationTimer(0.0f)
-        , rotationAngle(0.0f)
-        , pulseScale(1.0f)
-        , glowIntensity(0.5f)
+        , animationTimer(0)
+        , pulseScale(1)
     {
     }
 
+    PowerUp::PowerUp(const State& state)
+        : powerUpType((PowerUpType)state.powerUpType)
+        , position(state.position)
+        , speed(state.speed)
+        , size(state.size)
+        , active(state.active)
+        , animationTimer(state.animationTimer)
+        , pulseScale(state.pulseScale)
+    {
+    }
+
+    // === Snapshot ===
+    PowerUp::State PowerUp::CaptureState() const {
+        return { position, speed, size, animationTimer, pulseScale, (uint8_t)powerUpType, active, {} };
+    }
+
     // === Update ===
     void PowerUp::Update(float deltaTime) {
         if (!active) return;
 
         // Nach unten fallen
-        position.y += speed * deltaTime;
+        position.y += speed * SimScalar(deltaTime);
 
         // Animation aktualisieren
         UpdateAnimation(deltaTime);
@@ -51,28 +65,19 @@ namespace SpaceInvaders {
 
     // === Animation ===
     void PowerUp::UpdateAnimation(float deltaTime) {
-        animationTimer += deltaTime;
-
-        // Rotation
-        rotationAngle += 120.0f * deltaTime; // 120 Grad pro Sekunde
-        if (rotationAngle >= 360.0f) {
-            rotationAngle -= 360.0f;
-        }
+        animationTimer += SimScalar(deltaTime);
 
-        // Pulsierender Effekt
-        pulseScale = 1.0f + 0.1f * sinf(animationTimer * 4.0f);
-
-        // Glow-Intensitt
-        glowIntensity = 0.3f + 0.3f * sinf(animationTimer * 3.0f);
+        // Pulsierender Effekt (verndert die Kollisionsbox, daher Simulations-Trigonometrie)
+        pulseScale = SimScalar(1) + SimScalar(0.1f) * SimMath::Sin(animationTimer * 4);
     }
 
     // === Getters ===
-    Vector2 PowerUp::GetPosition() const {
+    SimVector2 PowerUp::GetPosition() const {
         return position;
     }
 
-    Rectangle PowerUp::GetBounds() const {
-        float actualSize = size * pulseScale;
+    SimRect PowerUp::GetBounds() const {
+        SimScalar actualSize = size * pulseScale;
         return {
             position.x - actualSize / 2,
             position.y - actualSize / 2,
@@ -85,7 +90,7 @@ namespace SpaceInvaders {
         return powerUpType;
     }
 
-    float PowerUp::GetSize() const {
+    SimScalar PowerUp::GetSize() const {
         return size * pulseScale;
     }
 
@@ -108,13 +113,25 @@ namespace SpaceInvaders {
         case POWERUP_SHIELD:     return SKYBLUE;
         case POWERUP_TRIPLESHOT: return ORANGE;
         case POWERUP_SLOWMO:     return PURPLE;
+        case POWERUP_HOMING:     return LIME;
+        case POWERUP_LASER:      return RED;
         default:                 return WHITE;
         }
     }
 
+    float PowerUp::GetRotationAngle() const {
+        // 120 Grad pro Sekunde
+        return fmodf(ToFloat(animationTimer) * 120.0f, 360.0f);
+    }
+
+    float PowerUp::GetGlowIntensity() const {
+        return 0.3f + 0.3f * sinf(ToFloat(animationTimer) * 3.0f);
+    }
+
     void PowerUp::RenderGlowEffect() const {
-        Vector2 center = position;
-        float actualSize = size * pulseScale;
+        Vector2 center = ToVector2(position);
+        float actualSize = ToFloat(GetSize());
+        float glowIntensity = GetGlowIntensity();
         Color glowColor = GetPowerUpColor();
 
         // uerer Glow (gro und transparent)
@@ -136,23 +153,32 @@ namespace SpaceInvaders {
         case POWERUP_SHIELD:     modType = MOD_SHIELD; break;
         case POWERUP_TRIPLESHOT: modType = MOD_TRIPLESHOT; break;
         case POWERUP_SLOWMO:     modType = MOD_SLOWMO; break;
+        case POWERUP_HOMING:
+        case POWERUP_LASER: {
+            // Keine Mod-Textur vorhanden, Buchstabe statt Icon
+            const char* glyph = powerUpType == POWERUP_HOMING ? "H" : "L";
+            int fontSize = (int)(ToFloat(GetSize()) * 0.6f);
+            DrawText(glyph, (int)(ToFloat(position.x) - MeasureText(glyph, fontSize) / 2.0f),
+                (int)(ToFloat(position.y) - fontSize / 2.0f), fontSize, WHITE);
+            return;
+        }
         default: return;
         }
 
         Texture2D iconTexture = textureManager.GetModIconTexture(modType);
-        float actualSize = size * pulseScale;
+        float actualSize = ToFloat(GetSize());
 
         // Icon mit Rotation rendern
         Rectangle source = { 0, 0, (float)iconTexture.width, (float)iconTexture.height };
         Rectangle dest = {
-            position.x,
-            position.y,
+            ToFloat(position.x),
+            ToFloat(position.y),
             actualSize,
             actualSize
         };
         Vector2 origin = { actualSize / 2, actualSize / 2 };
 
-        DrawTexturePro(iconTexture, source, dest, origin, rotationAngle, WHITE);
+        DrawTexturePro(iconTexture, source, dest, origin, GetRotationAngle(), WHITE);
     }
 
 } // namespace SpaceInvaders
\ No newline at end of file
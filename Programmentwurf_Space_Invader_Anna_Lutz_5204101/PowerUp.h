@@ -2,6 +2,8 @@
 
 #include "raylib.h"
 #include "GameConfig.h"
+#include "SimMath.h"
+#include <cstdint>
 
 namespace SpaceInvaders {
 
@@ -14,18 +16,33 @@ namespace SpaceInvaders {
     class PowerUp {
     public:
         // === Konstruktor & Destruktor ===
-        PowerUp(Vector2 startPosition, PowerUpType type);
+        PowerUp(SimVector2 startPosition, PowerUpType type);
         ~PowerUp() = default;
 
+        // === Snapshot (POD, Rotation und Glow werden aus animationTimer abgeleitet) ===
+        struct State {
+            SimVector2 position;
+            SimScalar speed;
+            SimScalar size;
+            SimScalar animationTimer;
+            SimScalar pulseScale;
+            uint8_t powerUpType;
+            bool active;
+            uint8_t reserved[2];  // kein implizites Padding
+        };
+
+        explicit PowerUp(const State& state);
+        State CaptureState() const;
+
         // === Update & Render ===
         void Update(float deltaTime);
         void Render() const;
 
         // === Getters ===
-        Vector2 GetPosition() const;
-        Rectangle GetBounds() const;
+        SimVector2 GetPosition() const;
+        SimRect GetBounds() const;
         PowerUpType GetType() const;
-        float GetSize() const;
+        SimScalar GetSize() const;
 
         // === Collision & Cleanup ===
         bool IsOffScreen() const;
@@ -42,19 +59,19 @@ namespace SpaceInvaders {
     private:
         // === Eigenschaften ===
         PowerUpType powerUpType;
-        Vector2 position;
-        float speed;
-        float size;
+        SimVector2 position;
+        SimScalar speed;
+        SimScalar size;
         bool active;
 
-        // === Animation ===
-        float animationTimer;
-        float rotationAngle;
-        float pulseScale;
-        float glowIntensity;
+        // === Animation (pulseScale wirkt auf die Kollisionsbox) ===
+        SimScalar animationTimer;
+        SimScalar pulseScale;
 
         // === Private Hilfsfunktionen ===
         Color GetPowerUpColor() const;
+        float GetRotationAngle() const;
+        float GetGlowIntensity() const;
         void RenderGlowEffect() const;
         void RenderIcon() const;
     };
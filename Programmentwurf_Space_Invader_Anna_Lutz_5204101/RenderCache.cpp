@@ -0,0 +1,118 @@
+#include "RenderCache.h"
+#include "rlgl.h"
+
+namespace SpaceInvaders {
+
+    // === Konstruktor ===
+    RenderCache::RenderCache()
+        : target{}
+        , cachedArea{ 0, 0, 0, 0 }
+        , cachedKey(0)
+        , loaded(false)
+        , valid(false)
+        , updating(false)
+    {
+    }
+
+    // === Destruktor ===
+    RenderCache::~RenderCache() {
+        Unload();
+    }
+
+    // === Aufbau ===
+    bool RenderCache::BeginUpdate(Rectangle area, uint64_t stateKey) {
+        bool sameArea = cachedArea.x == area.x && cachedArea.y == area.y &&
+            cachedArea.width == area.width && cachedArea.height == area.height;
+
+        if (valid && sameArea && cachedKey == stateKey) {
+            return false; // Cache ist aktuell, nichts zu zeichnen
+        }
+
+        EnsureTarget((int)area.width, (int)area.height);
+        cachedArea = area;
+        cachedKey = stateKey;
+
+        BeginTextureMode(target);
+        ClearBackground(BLANK);
+
+        // Premultiplied speichern: BLEND_ALPHA wuerde auch den Alpha-Kanal mit
+        // sich selbst multiplizieren (a*a) und Draw() blendet danach ein zweites Mal
+        rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+            RL_FUNC_ADD, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+
+        // Bildschirm-Koordinaten in den Cache-Bereich verschieben
+        Camera2D camera = { { -area.x, -area.y }, { 0.0f, 0.0f }, 0.0f, 1.0f };
+        BeginMode2D(camera);
+
+        updating = true;
+        return true;
+    }
+
+    void RenderCache::EndUpdate() {
+        if (!updating) return;
+
+        EndMode2D();
+        EndBlendMode();
+        EndTextureMode();
+
+        updating = false;
+        valid = true;
+    }
+
+    // === Ausgabe ===
+    void RenderCache::Draw(Color tint) const {
+        if (!valid) return;
+
+        // Inhalt liegt premultiplied vor, also auch den Tint vormultiplizieren
+        Color premultiplied = {
+            (unsigned char)(tint.r * tint.a / 255), (unsigned char)(tint.g * tint.a / 255),
+            (unsigned char)(tint.b * tint.a / 255), tint.a };
+
+        // RenderTexture ist vertikal gespiegelt (OpenGL-Koordinaten)
+        Rectangle source = { 0, 0, (float)target.texture.width, -(float)target.texture.height };
+        BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+        DrawTextureRec(target.texture, source, { cachedArea.x, cachedArea.y }, premultiplied);
+        EndBlendMode();
+    }
+
+    // === Verwaltung ===
+    void RenderCache::Invalidate() {
+        valid = false;
+    }
+
+    void RenderCache::Unload() {
+        // Nach CloseWindow() existiert kein GL-Kontext mehr
+        if (loaded && IsWindowReady()) {
+            UnloadRenderTexture(target);
+        }
+        target = {};
+        loaded = false;
+        valid = false;
+    }
+
+    bool RenderCache::IsValid() const {
+        return valid;
+    }
+
+    uint64_t RenderCache::MakeKey(std::initializer_list<int> values) {
+        uint64_t hash = 1469598103934665603ULL;
+        for (int value : values) {
+            hash ^= (uint64_t)(uint32_t)value;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void RenderCache::EnsureTarget(int width, int height) {
+        if (loaded && target.texture.width == width && target.texture.height == height) {
+            return;
+        }
+
+        Unload();
+        target = LoadRenderTexture(width, height);
+        loaded = true;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <initializer_list>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Gecachte Render-Ebene fuer statische Bildschirme
+     *
+     * Zeichnet einen Bildschirmbereich einmal in eine RenderTexture2D und
+     * blendet danach nur noch die fertige Textur ein. Neu gezeichnet wird
+     * erst, wenn sich der State-Key aendert (Auswahl, Hover, Unlocks, Coins)
+     * oder Invalidate() aufgerufen wird.
+     *
+     * Verwendung:
+     *   if (cache.BeginUpdate(area, key)) {
+     *       ... statische Inhalte in Bildschirm-Koordinaten zeichnen ...
+     *       cache.EndUpdate();
+     *   }
+     *   cache.Draw();
+     */
+    class RenderCache {
+    public:
+        // === Konstruktor & Destruktor ===
+        RenderCache();
+        ~RenderCache();
+
+        RenderCache(const RenderCache&) = delete;
+        RenderCache& operator=(const RenderCache&) = delete;
+
+        // === Aufbau ===
+        bool BeginUpdate(Rectangle area, uint64_t stateKey);
+        void EndUpdate();
+
+        // === Ausgabe ===
+        void Draw(Color tint = WHITE) const;
+
+        // === Verwaltung ===
+        void Invalidate();
+        void Unload();
+        bool IsValid() const;
+
+        // === State-Key Hilfsfunktion (FNV-1a ueber alle Werte) ===
+        static uint64_t MakeKey(std::initializer_list<int> values);
+
+    private:
+        RenderTexture2D target;
+        Rectangle cachedArea;
+        uint64_t cachedKey;
+        bool loaded;
+        bool valid;
+        bool updating;
+
+        // === Private Hilfsfunktionen ===
+        void EnsureTarget(int width, int height);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
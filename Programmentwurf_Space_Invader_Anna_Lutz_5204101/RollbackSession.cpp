@@ -0,0 +1,192 @@
+#include "RollbackSession.h"
+#include "GameSnapshot.h"
+#include "Logger.h"
+#include "Tracer.h"
+#include <algorithm>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        const uint32_t NO_FRAME = UINT32_MAX;
+
+    } // namespace
+
+    // === Konstruktor ===
+    RollbackSession::RollbackSession(NetSession& session, int inputDelay, uint8_t idleInput, Callbacks callbacks)
+        : session(session)
+        , callbacks(std::move(callbacks))
+        , localPlayer(session.GetLocalPlayer())
+        , inputDelay((uint32_t)std::clamp(inputDelay, 0, MAX_INPUT_DELAY))
+        , currentFrame(0)
+        , rollbackFrame(NO_FRAME)
+        , resimulating(false)
+        , nextChecksumFrame(GameConfig::NET_CHECKSUM_INTERVAL)
+        , comparedChecksumFrame(0)
+    {
+        // Die ersten inputDelay Frames laufen auf beiden Seiten ohne Eingabe
+        localInputs.fill(idleInput);
+        remoteInputs.fill(idleInput);
+        usedRemoteInputs.fill(idleInput);
+        localInputEnd = this->inputDelay;
+        remoteInputEnd = this->inputDelay;
+        remoteAck = this->inputDelay;
+    }
+
+    // === Pro Render-Frame ===
+    bool RollbackSession::Update(uint8_t localInput) {
+        TraceScope trace("RollbackSession::Update");
+
+        ReceiveRemoteInputs();
+        if (rollbackFrame < currentFrame) {
+            Rollback();
+        }
+        rollbackFrame = NO_FRAME;
+
+        // Gegenseite zu weit zurueck: warten statt immer weiter zu raten
+        if (currentFrame >= remoteInputEnd + GameConfig::NET_MAX_ROLLBACK_FRAMES) {
+            statistics.stalledFrames++;
+            SendLocalInputs();
+            return false;
+        }
+
+        // Lokale Eingabe gilt erst inputDelay Frames spaeter
+        localInputs[localInputEnd % HISTORY_FRAMES] = localInput;
+        localInputEnd++;
+
+        SimulateFrame(currentFrame);
+        currentFrame++;
+
+        UpdateChecksums();
+        SendLocalInputs();
+        return true;
+    }
+
+    // === Zustand ===
+    uint32_t RollbackSession::GetFrame() const {
+        return currentFrame;
+    }
+
+    uint32_t RollbackSession::GetConfirmedFrame() const {
+        return std::min(currentFrame, remoteInputEnd);
+    }
+
+    const RollbackSession::Statistics& RollbackSession::GetStatistics() const {
+        return statistics;
+    }
+
+    bool RollbackSession::IsResimulating() const {
+        return resimulating;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void RollbackSession::ReceiveRemoteInputs() {
+        NetInputPacket packet;
+        while (session.ReceiveInputs(packet)) {
+            remoteAck = std::clamp(packet.ackFrame, remoteAck, localInputEnd);
+
+            for (uint32_t i = 0; i < packet.inputCount; i++) {
+                uint32_t frame = packet.firstFrame + i;
+                if (frame < remoteInputEnd) continue;  // schon bekannt (Wiederholung)
+                if (frame > remoteInputEnd || frame >= currentFrame + HISTORY_FRAMES / 2) break;
+
+                uint8_t input = packet.inputs[i];
+                remoteInputs[frame % HISTORY_FRAMES] = input;
+                remoteInputEnd++;
+
+                // Frame lief schon mit einer anderen Vorhersage
+                if (frame < currentFrame && input != usedRemoteInputs[frame % HISTORY_FRAMES]) {
+                    rollbackFrame = std::min(rollbackFrame, frame);
+                }
+            }
+
+            if (packet.checksumFrame > comparedChecksumFrame) {
+                remoteChecksum = { packet.checksumFrame, packet.checksum };
+                CompareChecksums();
+            }
+        }
+    }
+
+    void RollbackSession::Rollback() {
+        TraceScope trace("RollbackSession::Rollback");
+
+        // Zustand vor dem ersten falschen Frame laden und bis heute nachrechnen
+        uint32_t frames = currentFrame - rollbackFrame;
+        callbacks.loadState(states[rollbackFrame % HISTORY_FRAMES]);
+        resimulating = true;
+        for (uint32_t frame = rollbackFrame; frame < currentFrame; frame++) {
+            SimulateFrame(frame);
+        }
+        resimulating = false;
+
+        statistics.rollbacks++;
+        statistics.resimulatedFrames += frames;
+        statistics.longestRollback = std::max(statistics.longestRollback, frames);
+    }
+
+    void RollbackSession::SimulateFrame(uint32_t frame) {
+        uint32_t slot = frame % HISTORY_FRAMES;
+        callbacks.saveState(states[slot]);
+
+        uint8_t inputs[2];
+        inputs[localPlayer] = localInputs[slot];
+        inputs[1 - localPlayer] = usedRemoteInputs[slot] = GetRemoteInput(frame);
+        callbacks.advanceFrame(inputs);
+    }
+
+    void RollbackSession::UpdateChecksums() {
+        // Zustand vor nextChecksumFrame steht fest, sobald alle Eingaben davor bestaetigt sind
+        while (nextChecksumFrame < currentFrame && nextChecksumFrame <= remoteInputEnd) {
+            ChecksumEntry entry = { nextChecksumFrame,
+                GameSnapshot::Checksum(states[nextChecksumFrame % HISTORY_FRAMES]) };
+            localChecksums[(nextChecksumFrame / GameConfig::NET_CHECKSUM_INTERVAL) % localChecksums.size()] = entry;
+            nextChecksumFrame += GameConfig::NET_CHECKSUM_INTERVAL;
+            CompareChecksums();
+        }
+    }
+
+    void RollbackSession::CompareChecksums() {
+        if (remoteChecksum.frame <= comparedChecksumFrame) return;
+
+        const ChecksumEntry& local =
+            localChecksums[(remoteChecksum.frame / GameConfig::NET_CHECKSUM_INTERVAL) % localChecksums.size()];
+        if (local.frame != remoteChecksum.frame) return;  // eigene Pruefsumme kommt noch
+
+        comparedChecksumFrame = remoteChecksum.frame;
+        if (local.checksum != remoteChecksum.checksum) {
+            statistics.desyncs++;
+            Logger::Warning("Netzwerk: Desync bei Frame %u (lokal %08X, Gegenseite %08X)",
+                local.frame, local.checksum, remoteChecksum.checksum);
+        }
+    }
+
+    void RollbackSession::SendLocalInputs() {
+        // Alles ab der letzten Quittung wiederholen, so ueberstehen Eingaben Paketverluste
+        NetInputPacket packet;
+        packet.firstFrame = remoteAck;
+        packet.ackFrame = remoteInputEnd;
+        packet.inputCount = (uint8_t)std::min<uint32_t>(localInputEnd - remoteAck, NetSession::MAX_PACKET_INPUTS);
+        for (uint32_t i = 0; i < packet.inputCount; i++) {
+            packet.inputs[i] = localInputs[(remoteAck + i) % HISTORY_FRAMES];
+        }
+
+        // Juengste eigene Pruefsumme mitschicken
+        packet.checksumFrame = 0;
+        packet.checksum = 0;
+        if (nextChecksumFrame > (uint32_t)GameConfig::NET_CHECKSUM_INTERVAL) {
+            uint32_t frame = nextChecksumFrame - GameConfig::NET_CHECKSUM_INTERVAL;
+            const ChecksumEntry& entry = localChecksums[(frame / GameConfig::NET_CHECKSUM_INTERVAL) % localChecksums.size()];
+            packet.checksumFrame = entry.frame;
+            packet.checksum = entry.checksum;
+        }
+
+        session.SendInputs(packet);
+    }
+
+    uint8_t RollbackSession::GetRemoteInput(uint32_t frame) const {
+        // Vorhersage: letzte bestaetigte Eingabe der Gegenseite wiederholen
+        uint32_t source = frame < remoteInputEnd ? frame : remoteInputEnd - 1;
+        return remoteInputs[(source + HISTORY_FRAMES) % HISTORY_FRAMES];
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "NetSession.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Rollback-Netcode fuer zwei Spieler (Eingabe-Vorhersage + Neusimulation)
+     *
+     * Lokale Eingaben wirken inputDelay Frames spaeter und werden sofort
+     * verschickt. Fehlt die Eingabe der Gegenseite fuer einen Frame, wird
+     * ihre letzte bekannte Eingabe wiederholt. Kommt spaeter eine andere
+     * Eingabe an, wird der Snapshot vor dem falsch vorhergesagten Frame
+     * geladen und bis zum aktuellen Frame neu simuliert - alles innerhalb
+     * eines Render-Frames.
+     *
+     * Die Simulation selbst kennt die Klasse nur ueber drei Callbacks
+     * (Snapshot sichern, laden, einen Frame mit beiden Eingaben rechnen).
+     * Liegt die Gegenseite mehr als NET_MAX_ROLLBACK_FRAMES zurueck, wird
+     * gewartet statt weiter vorherzusagen.
+     *
+     * Alle NET_CHECKSUM_INTERVAL Frames tauschen beide Seiten die Pruefsumme
+     * eines bestaetigten Snapshots aus, Abweichungen werden gemeldet.
+     */
+    class RollbackSession {
+    public:
+        struct Callbacks {
+            std::function<void(std::vector<uint8_t>& out)> saveState;
+            std::function<void(const std::vector<uint8_t>& state)> loadState;
+            std::function<void(const uint8_t inputs[2])> advanceFrame;  // Index = Spieler
+        };
+
+        struct Statistics {
+            uint32_t rollbacks = 0;
+            uint32_t resimulatedFrames = 0;
+            uint32_t longestRollback = 0;
+            uint32_t stalledFrames = 0;
+            uint32_t desyncs = 0;
+        };
+
+        // === Konstruktor ===
+        RollbackSession(NetSession& session, int inputDelay, uint8_t idleInput, Callbacks callbacks);
+
+        // === Pro Render-Frame ===
+        bool Update(uint8_t localInput);  // false = Frame ausgesetzt (Gegenseite zu weit zurueck)
+
+        // === Zustand ===
+        uint32_t GetFrame() const;           // naechster zu simulierender Frame
+        uint32_t GetConfirmedFrame() const;  // bis hierhin stehen beide Eingaben fest
+        const Statistics& GetStatistics() const;
+        bool IsResimulating() const;         // true waehrend ein Rollback Frames nachrechnet
+
+        // === Constants ===
+        static const uint32_t HISTORY_FRAMES = 128;  // Zweierpotenz, deutlich ueber Rollback + Verzoegerung
+        static const int MAX_INPUT_DELAY = 15;
+
+    private:
+        struct ChecksumEntry {
+            uint32_t frame = 0;  // 0 = leer
+            uint32_t checksum = 0;
+        };
+
+        NetSession& session;
+        Callbacks callbacks;
+        int localPlayer;
+        uint32_t inputDelay;
+
+        uint32_t currentFrame;
+        uint32_t localInputEnd;   // lokale Eingaben liegen fuer alle Frames davor vor
+        uint32_t remoteInputEnd;  // bestaetigte Eingaben der Gegenseite bis davor
+        uint32_t remoteAck;       // so weit hat die Gegenseite unsere Eingaben
+        uint32_t rollbackFrame;   // fruehester falsch vorhergesagter Frame
+        bool resimulating;
+
+        std::array<uint8_t, HISTORY_FRAMES> localInputs;
+        std::array<uint8_t, HISTORY_FRAMES> remoteInputs;
+        std::array<uint8_t, HISTORY_FRAMES> usedRemoteInputs;  // so wurde simuliert
+        std::array<std::vector<uint8_t>, HISTORY_FRAMES> states;  // Zustand vor dem Frame
+
+        std::array<ChecksumEntry, 8> localChecksums;
+        ChecksumEntry remoteChecksum;      // wartet ggf. auf die eigene Pruefsumme
+        uint32_t nextChecksumFrame;
+        uint32_t comparedChecksumFrame;
+
+        Statistics statistics;
+
+        // === Private Hilfsfunktionen ===
+        void ReceiveRemoteInputs();
+        void Rollback();
+        void SimulateFrame(uint32_t frame);
+        void UpdateChecksums();
+        void CompareChecksums();
+        void SendLocalInputs();
+        uint8_t GetRemoteInput(uint32_t frame) const;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,501 @@
+#include "RunHistory.h"
+#include "SaveContainer.h"
+#include "MemoryTracker.h"
+#include "Tracer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <utility>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        enum ColumnType : uint8_t {
+            TYPE_I64 = 1,
+            TYPE_I32 = 2,
+            TYPE_F32 = 3,
+            TYPE_U8 = 4
+        };
+
+        struct ColumnInfo {
+            const char* name;
+            ColumnType type;
+            uint8_t width;
+        };
+
+        // Reihenfolge = RunColumn
+        constexpr ColumnInfo COLUMNS[COLUMN_COUNT] = {
+            { "timestamp",  TYPE_I64, 8 },
+            { "score",      TYPE_I32, 4 },
+            { "duration",   TYPE_F32, 4 },
+            { "kills",      TYPE_I32, 4 },
+            { "bosses",     TYPE_I32, 4 },
+            { "avatar",     TYPE_U8,  1 },
+            { "mod",        TYPE_U8,  1 },
+            { "difficulty", TYPE_U8,  1 },
+            { "cause",      TYPE_U8,  1 },
+        };
+
+        // Spalten-Header: Magic (u32) | Typ (u8) | Breite (u8) | Version (u16), danach nur Werte
+        // (Plattform-Byte-Reihenfolge, damit ein Block ohne Umwandlung gelesen werden kann)
+        const size_t COLUMN_HEADER_SIZE = 8;
+
+        const char* const difficultyNames[] = { "Leicht", "Mittel", "Schwer" };
+        const char* const avatarNames[] = { "Blau", "Gruen", "Rot", "Gelb", "Lila" };
+
+        template <typename T>
+        void AppendValue(std::vector<uint8_t>& out, T value) {
+            const uint8_t* bytes = (const uint8_t*)&value;
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        bool TakeValue(const std::vector<uint8_t>& in, size_t& offset, T& value) {
+            if (offset + sizeof(T) > in.size()) return false;
+            std::memcpy(&value, in.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        /**
+         * @brief Spalten eines Blocks, die jede Abfrage summiert
+         */
+        struct BlockValues {
+            std::vector<int32_t> scores;
+            std::vector<float> durations;
+            std::vector<int32_t> kills;
+            std::vector<int32_t> bosses;
+        };
+
+        // Keine Verzweigung pro Zeile: nicht ausgewaehlte Zeilen zaehlen mit Gewicht 0
+        void AccumulateBlock(const uint8_t* mask, size_t rows, const BlockValues& values, RunAggregate& out) {
+            int runs = 0;
+            int64_t scoreSum = 0;
+            int32_t bestScore = out.bestScore;
+            float durationSum = 0.0f;
+            int64_t killSum = 0;
+            int bossRuns = 0;
+
+            for (size_t i = 0; i < rows; i++) {
+                int selected = mask[i];
+                runs += selected;
+                scoreSum += (int64_t)selected * values.scores[i];
+                bestScore = std::max(bestScore, selected ? values.scores[i] : bestScore);
+                durationSum += selected * values.durations[i];
+                killSum += (int64_t)selected * values.kills[i];
+                bossRuns += selected & (values.bosses[i] > 0);
+            }
+
+            out.runs += runs;
+            out.scoreSum += scoreSum;
+            out.bestScore = bestScore;
+            out.durationSum += durationSum;
+            out.killSum += killSum;
+            out.bossRuns += bossRuns;
+        }
+
+    } // namespace
+
+    // === Konstruktor ===
+    RunHistory::RunHistory(const std::string& folder)
+        : folder(folder)
+        , rowCount(0)
+        , readOnly(false)
+    {
+    }
+
+    // === Datei-Operationen ===
+    bool RunHistory::Open() {
+        TraceScope trace("RunHistory::Open");
+
+        std::error_code ec;
+        std::filesystem::create_directories(folder, ec);
+        if (ec) {
+            Logger::Error("Run-Historie: Ordner %s nicht anlegbar: %s", folder.c_str(), ec.message().c_str());
+            return false;
+        }
+
+        // Vollstaendig sind nur Zeilen, die in allen Spalten stehen
+        size_t completeRows = SIZE_MAX;
+        for (int column = 0; column < COLUMN_COUNT; column++) {
+            completeRows = std::min(completeRows, PrepareColumn(column));
+        }
+
+        if (!ReadIndex() || rowCount > completeRows) {
+            Logger::Warning("Run-Historie: Index fehlt oder passt nicht, wird aus den Spalten neu aufgebaut");
+            RebuildIndex(completeRows);
+            WriteIndex();
+        }
+
+        // Angefangene Zeilen eines abgebrochenen Append abschneiden
+        for (int column = 0; column < COLUMN_COUNT; column++) {
+            uintmax_t expectedSize = COLUMN_HEADER_SIZE + rowCount * GetColumnWidth(column);
+            if (std::filesystem::file_size(GetColumnPath(column), ec) > expectedSize) {
+                std::filesystem::resize_file(GetColumnPath(column), expectedSize, ec);
+            }
+        }
+
+        Logger::Info("Run-Historie: %zu Runden in %zu Bloecken", rowCount, blocks.size());
+        return true;
+    }
+
+    bool RunHistory::OpenReadOnly() {
+        TraceScope trace("RunHistory::OpenReadOnly");
+        readOnly = true;
+
+        // Das Spiel kann gerade anhaengen: nur lesen, fehlende Spalten zaehlen als leer
+        size_t completeRows = SIZE_MAX;
+        for (int column = 0; column < COLUMN_COUNT; column++) {
+            size_t rows;
+            if (!InspectColumn(column, rows)) {
+                rows = 0;
+            }
+            completeRows = std::min(completeRows, rows);
+        }
+
+        // Ohne gueltigen Index nur im Speicher neu aufbauen
+        if (!ReadIndex() || rowCount > completeRows) {
+            RebuildIndex(completeRows);
+        }
+
+        Logger::Info("Run-Historie (nur lesen): %zu Runden in %zu Bloecken", rowCount, blocks.size());
+        return true;
+    }
+
+    bool RunHistory::Append(const RunRecord& record) {
+        TraceScope trace("RunHistory::Append");
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (readOnly) {
+            Logger::Error("Run-Historie: nur zum Lesen geoeffnet");
+            return false;
+        }
+
+        // Werte in Spaltenreihenfolge
+        const void* values[COLUMN_COUNT] = {
+            &record.timestamp, &record.score, &record.duration, &record.enemiesKilled,
+            &record.bossesDefeated, &record.avatar, &record.mod, &record.difficulty, &record.cause
+        };
+
+        // An die Zeilenzahl des Index schreiben, nicht ans Dateiende: Reste eines
+        // fehlgeschlagenen Append werden so ueberschrieben
+        for (int column = 0; column < COLUMN_COUNT; column++) {
+            FILE* file = std::fopen(GetColumnPath(column).c_str(), "r+b");
+            bool ok = file && std::fseek(file, (long)(COLUMN_HEADER_SIZE + rowCount * GetColumnWidth(column)), SEEK_SET) == 0;
+            ok = ok && std::fwrite(values[column], GetColumnWidth(column), 1, file) == 1;
+            ok = ok && std::fflush(file) == 0;
+            ok = ok && SaveContainer::SyncFile(file) == 0; // Erst auf Platte, dann Index
+            if (file) {
+                ok = (std::fclose(file) == 0) && ok;
+            }
+
+            if (!ok) {
+                Logger::Error("Run-Historie: Spalte %s nicht schreibbar", COLUMNS[column].name);
+                return false;
+            }
+        }
+
+        if (rowCount % BLOCK_ROWS == 0) {
+            blocks.push_back({ record.timestamp, record.timestamp });
+        }
+        else {
+            BlockRange& block = blocks.back();
+            block.minTimestamp = std::min(block.minTimestamp, record.timestamp);
+            block.maxTimestamp = std::max(block.maxTimestamp, record.timestamp);
+        }
+        rowCount++;
+
+        // Erst der neue Index macht die Zeile sichtbar
+        return WriteIndex();
+    }
+
+    size_t RunHistory::GetRowCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return rowCount;
+    }
+
+    // === Abfragen ===
+    RunAggregate RunHistory::Aggregate(const RunFilter& filter) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<RunAggregate> groups(1);
+        Scan(filter, -1, groups);
+        return groups[0];
+    }
+
+    std::vector<RunAggregate> RunHistory::AggregateBy(RunColumn groupColumn, int groupCount, const RunFilter& filter) const {
+        std::vector<RunAggregate> groups;
+        if (COLUMNS[groupColumn].type != TYPE_U8) {
+            Logger::Error("Run-Historie: nach Spalte %s kann nicht gruppiert werden", COLUMNS[groupColumn].name);
+            return groups;
+        }
+
+        groups.resize(std::max(groupCount, 0));
+        std::lock_guard<std::mutex> lock(mutex);
+        Scan(filter, groupColumn, groups);
+        return groups;
+    }
+
+    // === Bericht ===
+    bool RunHistory::WriteReport(std::ostream& out, const RunFilter& filter) const {
+        out << "difficulty,avatar,runs,score_mean,score_best,duration_mean,kills_mean,boss_runs\n";
+
+        for (int difficulty = 0; difficulty < 3; difficulty++) {
+            if (filter.difficulty >= 0 && filter.difficulty != difficulty) continue;
+
+            RunFilter difficultyFilter = filter;
+            difficultyFilter.difficulty = difficulty;
+            std::vector<RunAggregate> avatars = AggregateBy(COLUMN_AVATAR, 5, difficultyFilter);
+
+            for (int avatar = 0; avatar < (int)avatars.size(); avatar++) {
+                const RunAggregate& group = avatars[avatar];
+                if (group.runs == 0) continue;
+
+                out << difficultyNames[difficulty] << ','
+                    << avatarNames[avatar] << ','
+                    << group.runs << ','
+                    << group.GetAverageScore() << ','
+                    << group.bestScore << ','
+                    << group.GetAverageDuration() << ','
+                    << (float)group.killSum / group.runs << ','
+                    << group.bossRuns << '\n';
+            }
+        }
+
+        return (bool)out;
+    }
+
+    // === Private Hilfsfunktionen ===
+    std::string RunHistory::GetColumnPath(int column) const {
+        return folder + COLUMNS[column].name + ".col";
+    }
+
+    std::string RunHistory::GetIndexPath() const {
+        return folder + "index.bin";
+    }
+
+    // Index: Magic (u32) | Version (u16) | Spalten (u16) | Zeilen (u64) | Blockgroesse (u32) |
+    //        Bloecke (u32) | je Block min/max Zeitstempel (2x i64) | CRC32 (u32)
+    bool RunHistory::ReadIndex() {
+        std::ifstream file(GetIndexPath(), std::ios::binary);
+        if (!file) return false;
+
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (data.size() < sizeof(uint32_t)) return false;
+
+        uint32_t storedCrc;
+        size_t crcOffset = data.size() - sizeof(uint32_t);
+        std::memcpy(&storedCrc, data.data() + crcOffset, sizeof(uint32_t));
+        if (SaveContainer::Crc32(data.data(), crcOffset) != storedCrc) return false;
+
+        size_t offset = 0;
+        uint32_t magic, blockRows, blockCount;
+        uint16_t version, columnCount;
+        uint64_t rows;
+        if (!TakeValue(data, offset, magic) || !TakeValue(data, offset, version) ||
+            !TakeValue(data, offset, columnCount) || !TakeValue(data, offset, rows) ||
+            !TakeValue(data, offset, blockRows) || !TakeValue(data, offset, blockCount)) {
+            return false;
+        }
+
+        if (magic != INDEX_MAGIC || version != VERSION || columnCount != COLUMN_COUNT ||
+            blockRows != BLOCK_ROWS || blockCount != (rows + BLOCK_ROWS - 1) / BLOCK_ROWS) {
+            return false;
+        }
+
+        std::vector<BlockRange> ranges(blockCount);
+        for (BlockRange& range : ranges) {
+            if (!TakeValue(data, offset, range.minTimestamp) || !TakeValue(data, offset, range.maxTimestamp)) {
+                return false;
+            }
+        }
+
+        rowCount = (size_t)rows;
+        blocks = std::move(ranges);
+        return true;
+    }
+
+    bool RunHistory::WriteIndex() const {
+        std::vector<uint8_t> data;
+        AppendValue(data, INDEX_MAGIC);
+        AppendValue(data, VERSION);
+        AppendValue(data, (uint16_t)COLUMN_COUNT);
+        AppendValue(data, (uint64_t)rowCount);
+        AppendValue(data, (uint32_t)BLOCK_ROWS);
+        AppendValue(data, (uint32_t)blocks.size());
+        for (const BlockRange& range : blocks) {
+            AppendValue(data, range.minTimestamp);
+            AppendValue(data, range.maxTimestamp);
+        }
+        AppendValue(data, SaveContainer::Crc32(data.data(), data.size()));
+
+        // Neuer Index erst komplett daneben schreiben und synchronisieren, dann atomar ersetzen
+        std::string tempPath = GetIndexPath() + ".tmp";
+        if (!SaveContainer::WriteDurable(tempPath, data)) {
+            Logger::Error("Run-Historie: Index nicht schreibbar");
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, GetIndexPath(), ec);
+        if (ec) {
+            Logger::Error("Run-Historie: Index nicht ersetzbar: %s", ec.message().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool RunHistory::InspectColumn(int column, size_t& rows) const {
+        const ColumnInfo& info = COLUMNS[column];
+        rows = 0;
+
+        std::ifstream file(GetColumnPath(column), std::ios::binary | std::ios::ate);
+        if (!file) return false;
+
+        size_t size = (size_t)file.tellg();
+        uint8_t header[COLUMN_HEADER_SIZE] = {};
+        file.seekg(0);
+        file.read((char*)header, sizeof(header));
+
+        uint32_t magic;
+        uint16_t version;
+        std::memcpy(&magic, header, sizeof(magic));
+        std::memcpy(&version, header + 6, sizeof(version));
+        if (!file || magic != COLUMN_MAGIC || header[4] != info.type || header[5] != info.width || version != VERSION) {
+            return false;
+        }
+
+        rows = (size - COLUMN_HEADER_SIZE) / info.width;
+        return true;
+    }
+
+    size_t RunHistory::PrepareColumn(int column) const {
+        const ColumnInfo& info = COLUMNS[column];
+        std::string path = GetColumnPath(column);
+
+        size_t rows;
+        if (InspectColumn(column, rows)) {
+            return rows;
+        }
+
+        std::error_code ec;
+        if (std::filesystem::exists(path, ec)) {
+            Logger::Warning("Run-Historie: Spalte %s unbekannt, wird neu angelegt", info.name);
+        }
+
+        std::vector<uint8_t> header;
+        AppendValue(header, COLUMN_MAGIC);
+        AppendValue(header, (uint8_t)info.type);
+        AppendValue(header, info.width);
+        AppendValue(header, VERSION);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write((const char*)header.data(), header.size());
+        return 0;
+    }
+
+    void RunHistory::RebuildIndex(size_t rows) {
+        rowCount = 0;
+        blocks.clear();
+
+        std::ifstream file(GetColumnPath(COLUMN_TIMESTAMP), std::ios::binary);
+        std::vector<int64_t> timestamps(BLOCK_ROWS);
+
+        for (size_t first = 0; first < rows; first += BLOCK_ROWS) {
+            size_t count = std::min(BLOCK_ROWS, rows - first);
+            if (!ReadColumnBlock(file, COLUMN_TIMESTAMP, first, count, timestamps.data())) break;
+
+            auto range = std::minmax_element(timestamps.begin(), timestamps.begin() + count);
+            blocks.push_back({ *range.first, *range.second });
+            rowCount = first + count;
+        }
+    }
+
+    bool RunHistory::ReadColumnBlock(std::ifstream& file, int column, size_t firstRow, size_t rows, void* out) const {
+        size_t width = GetColumnWidth(column);
+        file.seekg(COLUMN_HEADER_SIZE + firstRow * width);
+        file.read((char*)out, rows * width);
+        return (bool)file;
+    }
+
+    void RunHistory::Scan(const RunFilter& filter, int groupColumn, std::vector<RunAggregate>& groups) const {
+        TraceScope trace("RunHistory::Scan");
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
+        // Filter auf Byte-Spalten (Avatar, Mod, Schwierigkeit, Ursache)
+        const std::pair<int, int> byteFilters[] = {
+            { COLUMN_AVATAR, filter.avatar },
+            { COLUMN_MOD, filter.mod },
+            { COLUMN_DIFFICULTY, filter.difficulty },
+            { COLUMN_CAUSE, filter.cause }
+        };
+
+        std::ifstream files[COLUMN_COUNT];
+        for (int column = 0; column < COLUMN_COUNT; column++) {
+            files[column].open(GetColumnPath(column), std::ios::binary);
+        }
+
+        std::vector<int64_t> timestamps(BLOCK_ROWS);
+        std::vector<uint8_t> selection(BLOCK_ROWS);
+        std::vector<uint8_t> byteColumn(BLOCK_ROWS);
+        std::vector<uint8_t> groupKeys(BLOCK_ROWS);
+        std::vector<uint8_t> groupMask(BLOCK_ROWS);
+        BlockValues values = { std::vector<int32_t>(BLOCK_ROWS), std::vector<float>(BLOCK_ROWS),
+            std::vector<int32_t>(BLOCK_ROWS), std::vector<int32_t>(BLOCK_ROWS) };
+
+        for (size_t block = 0; block < blocks.size(); block++) {
+            // Zone Map: Block liegt komplett vor dem Zeitraum
+            if (blocks[block].maxTimestamp < filter.since) continue;
+
+            size_t first = block * BLOCK_ROWS;
+            size_t rows = std::min(BLOCK_ROWS, rowCount - first);
+            std::fill(selection.begin(), selection.begin() + rows, 1);
+
+            // Zeitstempel nur lesen, wenn der Block teilweise vor dem Zeitraum liegt
+            if (blocks[block].minTimestamp < filter.since) {
+                if (!ReadColumnBlock(files[COLUMN_TIMESTAMP], COLUMN_TIMESTAMP, first, rows, timestamps.data())) return;
+                for (size_t i = 0; i < rows; i++) {
+                    selection[i] = timestamps[i] >= filter.since;
+                }
+            }
+
+            for (const auto& byteFilter : byteFilters) {
+                if (byteFilter.second < 0) continue;
+                if (!ReadColumnBlock(files[byteFilter.first], byteFilter.first, first, rows, byteColumn.data())) return;
+                for (size_t i = 0; i < rows; i++) {
+                    selection[i] &= byteColumn[i] == byteFilter.second;
+                }
+            }
+
+            if (!ReadColumnBlock(files[COLUMN_SCORE], COLUMN_SCORE, first, rows, values.scores.data()) ||
+                !ReadColumnBlock(files[COLUMN_DURATION], COLUMN_DURATION, first, rows, values.durations.data()) ||
+                !ReadColumnBlock(files[COLUMN_KILLS], COLUMN_KILLS, first, rows, values.kills.data()) ||
+                !ReadColumnBlock(files[COLUMN_BOSSES], COLUMN_BOSSES, first, rows, values.bosses.data())) {
+                Logger::Error("Run-Historie: Spalten kuerzer als der Index");
+                return;
+            }
+
+            if (groupColumn < 0) {
+                AccumulateBlock(selection.data(), rows, values, groups[0]);
+                continue;
+            }
+
+            // Pro Gruppe eine eigene Maske, damit auch hier jede Schleife linear bleibt
+            if (!ReadColumnBlock(files[groupColumn], groupColumn, first, rows, groupKeys.data())) return;
+            for (size_t group = 0; group < groups.size(); group++) {
+                for (size_t i = 0; i < rows; i++) {
+                    groupMask[i] = selection[i] & (groupKeys[i] == group);
+                }
+                AccumulateBlock(groupMask.data(), rows, values, groups[group]);
+            }
+        }
+    }
+
+    size_t RunHistory::GetColumnWidth(int column) {
+        return COLUMNS[column].width;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
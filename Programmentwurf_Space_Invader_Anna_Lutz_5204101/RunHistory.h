@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Eine abgeschlossene Singleplayer-Runde
+     */
+    struct RunRecord {
+        int64_t timestamp;        // Unix-Sekunden bei Rundenende
+        int32_t score;
+        float duration;           // Sekunden
+        int32_t enemiesKilled;
+        int32_t bossesDefeated;
+        uint8_t avatar;           // AvatarType
+        uint8_t mod;              // ModType
+        uint8_t difficulty;       // Difficulty
+        uint8_t cause;            // HitCause des letzten Lebensverlusts
+    };
+
+    /**
+     * @brief Spalten der Run-Historie (eine Datei pro Spalte)
+     */
+    enum RunColumn {
+        COLUMN_TIMESTAMP,
+        COLUMN_SCORE,
+        COLUMN_DURATION,
+        COLUMN_KILLS,
+        COLUMN_BOSSES,
+        COLUMN_AVATAR,
+        COLUMN_MOD,
+        COLUMN_DIFFICULTY,
+        COLUMN_CAUSE,
+        COLUMN_COUNT
+    };
+
+    /**
+     * @brief Filter fuer Abfragen (-1 = alle)
+     */
+    struct RunFilter {
+        int64_t since = 0;        // nur Runden mit timestamp >= since
+        int avatar = -1;
+        int mod = -1;
+        int difficulty = -1;
+        int cause = -1;
+    };
+
+    /**
+     * @brief Summen ueber alle Runden einer Abfrage bzw. Gruppe
+     */
+    struct RunAggregate {
+        int runs = 0;
+        int64_t scoreSum = 0;
+        int32_t bestScore = 0;
+        double durationSum = 0.0;
+        int64_t killSum = 0;
+        int bossRuns = 0;         // Runden mit mindestens einem besiegten Boss
+
+        float GetAverageScore() const { return runs > 0 ? (float)scoreSum / runs : 0.0f; }
+        float GetAverageDuration() const { return runs > 0 ? (float)(durationSum / runs) : 0.0f; }
+    };
+
+    /**
+     * @brief Spaltenweise gespeicherte Historie aller Singleplayer-Runden
+     *
+     * Jede Spalte liegt in einer eigenen Datei (runs/<name>.col) als
+     * Array fester Breite hinter einem kurzen Header mit Typ und Breite.
+     * Eine neue Runde haengt an jede Spalte einen Wert an. Erst danach
+     * wird der kleine Index (index.bin) atomar ersetzt: Zeilenzahl plus
+     * kleinster/groesster Zeitstempel je Block von BLOCK_ROWS Zeilen.
+     * Zeilen hinter der Zeilenzahl im Index stammen aus einem
+     * abgebrochenen Schreibvorgang und werden beim Oeffnen abgeschnitten.
+     * Spalten werden vor dem Index per fsync festgeschrieben, damit der
+     * Index nie Zeilen zaehlt, die noch nicht auf der Platte liegen.
+     *
+     * OpenReadOnly() ist fuer Auswertungen neben dem laufenden Spiel:
+     * es legt nichts an, schneidet nichts ab und schreibt keinen Index.
+     * Append() laeuft im Spiel auf dem Save-Writer, Abfragen vom Menue
+     * warten per Mutex, bis die Zeile samt Index geschrieben ist.
+     *
+     * Abfragen lesen blockweise nur die Spalten, die Filter und Summen
+     * brauchen. Bloecke, deren Zeitstempel alle vor RunFilter::since
+     * liegen, werden anhand des Index gar nicht erst gelesen. Innerhalb
+     * eines Blocks laufen Filter und Summen als einfache Schleifen ueber
+     * zusammenhaengende Arrays (Auswahlmaske statt Verzweigung), die der
+     * Compiler vektorisieren kann.
+     */
+    class RunHistory {
+    public:
+        // === Konstruktor ===
+        explicit RunHistory(const std::string& folder);
+
+        // === Datei-Operationen ===
+        bool Open();
+        bool OpenReadOnly();
+        bool Append(const RunRecord& record);
+        size_t GetRowCount() const;
+
+        // === Abfragen ===
+        RunAggregate Aggregate(const RunFilter& filter) const;
+        std::vector<RunAggregate> AggregateBy(RunColumn groupColumn, int groupCount, const RunFilter& filter) const;
+
+        // === Bericht (CSV: Schwierigkeit x Avatar) ===
+        bool WriteReport(std::ostream& out, const RunFilter& filter) const;
+
+        // === Constants ===
+        static const uint32_t COLUMN_MAGIC = 0x43524953; // "SIRC" little endian
+        static const uint32_t INDEX_MAGIC = 0x49524953;  // "SIRI" little endian
+        static const uint16_t VERSION = 1;
+        static constexpr size_t BLOCK_ROWS = 1024;
+
+    private:
+        /**
+         * @brief Zeitspanne eines Blocks (Zone Map)
+         */
+        struct BlockRange {
+            int64_t minTimestamp;
+            int64_t maxTimestamp;
+        };
+
+        std::string folder;
+        size_t rowCount;
+        std::vector<BlockRange> blocks;
+        bool readOnly;
+        mutable std::mutex mutex;  // Append vs. Abfragen
+
+        // === Private Hilfsfunktionen ===
+        std::string GetColumnPath(int column) const;
+        std::string GetIndexPath() const;
+        bool ReadIndex();
+        bool WriteIndex() const;
+        bool InspectColumn(int column, size_t& rows) const;
+        size_t PrepareColumn(int column) const;  // legt fehlende/fremde Dateien neu an
+        void RebuildIndex(size_t rows);
+        bool ReadColumnBlock(std::ifstream& file, int column, size_t firstRow, size_t rows, void* out) const;
+
+        void Scan(const RunFilter& filter, int groupColumn, std::vector<RunAggregate>& groups) const;
+
+        static size_t GetColumnWidth(int column);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
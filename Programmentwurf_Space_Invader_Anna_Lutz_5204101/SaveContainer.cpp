@@ -0,0 +1,436 @@
+#include "SaveContainer.h"
+#include "Tracer.h"
+#include "FlightRecorder.h"
+#include "MetricsServer.h"
+#include "Logger.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // === Header-Groessen ===
+        const size_t FILE_HEADER_SIZE = 8;     // Magic + Version + Anzahl
+        const size_t SECTION_HEADER_SIZE = 12; // ID + reserviert + Laenge + CRC
+
+        uint16_t ReadLE16(const uint8_t* p) {
+            return (uint16_t)(p[0] | (p[1] << 8));
+        }
+
+        uint32_t ReadLE32(const uint8_t* p) {
+            return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        }
+
+        void AppendLE16(std::vector<uint8_t>& out, uint16_t value) {
+            out.push_back((uint8_t)(value & 0xFF));
+            out.push_back((uint8_t)(value >> 8));
+        }
+
+        void AppendLE32(std::vector<uint8_t>& out, uint32_t value) {
+            for (int i = 0; i < 4; i++) {
+                out.push_back((uint8_t)((value >> (i * 8)) & 0xFF));
+            }
+        }
+
+    } // namespace
+
+    // === Destruktor ===
+    SaveContainer::~SaveContainer() {
+        // Eingereihtes Abbild wird vor dem Beenden noch geschrieben
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopWriter = true;
+        }
+        queueChanged.notify_all();
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
+
+    // === Datei-Operationen ===
+    bool SaveContainer::Open(const std::string& path) {
+        TraceScope trace("SaveContainer::Open", path.c_str());
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        filePath = path;
+        sections.clear();
+
+        // Vollstaendiges Journal = Commit wurde geschrieben, aber nicht mehr umbenannt
+        std::string journalPath = path + ".tmp";
+        std::error_code ec;
+        if (std::filesystem::exists(journalPath, ec)) {
+            std::map<uint16_t, std::vector<uint8_t>> journalSections;
+            if (ReadImage(journalPath, journalSections, true)) {
+                sections = std::move(journalSections);
+                std::filesystem::rename(journalPath, path, ec);
+                Logger::Info("Save-Journal wiederhergestellt.");
+                return FinishIO(FlightRecorder::SAVE_OPEN, start, true);
+            }
+
+            // Abgebrochener Commit - alter Stand bleibt gueltig
+            std::filesystem::remove(journalPath, ec);
+        }
+
+        return FinishIO(FlightRecorder::SAVE_OPEN, start, ReadImage(path, sections, false));
+    }
+
+    bool SaveContainer::Commit() {
+        TraceScope trace("SaveContainer::Commit", filePath.c_str());
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        std::vector<uint8_t> image = BuildImage();
+        return FinishIO(FlightRecorder::SAVE_COMMIT, start, WriteImage(image, ++nextSequence));
+    }
+
+    void SaveContainer::CommitInBackground() {
+        TraceScope trace("SaveContainer::CommitInBackground", filePath.c_str());
+
+        // Nur das Abbild entsteht hier, fsync und rename uebernimmt der Writer
+        std::vector<uint8_t> image = BuildImage();
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            queuedImage = std::move(image); // ein noch wartendes aelteres Abbild ist damit ueberholt
+            queuedSequence = ++nextSequence;
+            StartWriter();
+        }
+        queueChanged.notify_all();
+    }
+
+    void SaveContainer::QueueBackgroundTask(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            queuedTasks.push_back(std::move(task));
+            StartWriter();
+        }
+        queueChanged.notify_all();
+    }
+
+    void SaveContainer::WaitForBackgroundWrites() {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueChanged.wait(lock, [this]() { return queuedSequence == 0 && queuedTasks.empty() && !writing; });
+        }
+        ReportPendingIO();
+    }
+
+    void SaveContainer::ReportPendingIO() {
+        std::vector<IOResult> results;
+        {
+            std::lock_guard<std::mutex> lock(ioMutex);
+            if (pendingIO.empty()) return;
+            results.swap(pendingIO);
+        }
+
+        for (const IOResult& result : results) {
+            FlightRecorder::GetInstance().RecordSaveIO((FlightRecorder::SaveOperation)result.operation,
+                result.success, result.durationMs);
+        }
+    }
+
+    // === Sektionen ===
+    const std::vector<uint8_t>* SaveContainer::GetSection(uint16_t id) const {
+        auto it = sections.find(id);
+        return it != sections.end() ? &it->second : nullptr;
+    }
+
+    bool SaveContainer::SetSection(uint16_t id, const std::vector<uint8_t>& data) {
+        auto it = sections.find(id);
+        if (it != sections.end() && it->second == data) {
+            return false; // Unveraendert - kein Commit noetig
+        }
+
+        sections[id] = data;
+        return true;
+    }
+
+    bool SaveContainer::HasSection(uint16_t id) const {
+        return sections.find(id) != sections.end();
+    }
+
+    int SaveContainer::GetCommitCount() const {
+        return commitCount;
+    }
+
+    // === CRC32 ===
+    uint32_t SaveContainer::Crc32(const uint8_t* data, size_t length) {
+        // Thread-sichere Initialisierung (Save-Container und Run-Historie hashen auf Workern)
+        static const std::array<uint32_t, 256> table = []() {
+            std::array<uint32_t, 256> result = {};
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                result[i] = c;
+            }
+            return result;
+        }();
+
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < length; i++) {
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return crc ^ 0xFFFFFFFFu;
+    }
+
+    // === Private Hilfsfunktionen ===
+    bool SaveContainer::ReadImage(const std::string& path,
+        std::map<uint16_t, std::vector<uint8_t>>& outSections, bool strict) const {
+
+        // Ganze Datei mit einem Lesezugriff holen
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+
+        std::streamsize size = file.tellg();
+        if (size < (std::streamsize)FILE_HEADER_SIZE) return false;
+
+        std::vector<uint8_t> image((size_t)size);
+        file.seekg(0);
+        if (!file.read((char*)image.data(), size)) return false;
+
+        if (ReadLE32(&image[0]) != MAGIC || ReadLE16(&image[4]) > VERSION) {
+            Logger::Error("Unbekanntes Save-Format: %s", path.c_str());
+            return false;
+        }
+
+        uint16_t sectionCount = ReadLE16(&image[6]);
+        size_t offset = FILE_HEADER_SIZE;
+
+        for (uint16_t i = 0; i < sectionCount; i++) {
+            if (offset + SECTION_HEADER_SIZE > image.size()) return false;
+
+            uint16_t id = ReadLE16(&image[offset]);
+            uint32_t length = ReadLE32(&image[offset + 4]);
+            uint32_t crc = ReadLE32(&image[offset + 8]);
+            offset += SECTION_HEADER_SIZE;
+
+            if (offset + length > image.size()) return false;
+
+            const uint8_t* payload = image.data() + offset;
+            if (Crc32(payload, length) != crc) {
+                Logger::Warning("Save-Sektion %u beschaedigt (CRC)", (unsigned)id);
+                if (strict) return false;
+            }
+            else {
+                outSections[id] = std::vector<uint8_t>(payload, payload + length);
+            }
+            offset += length;
+        }
+
+        return true;
+    }
+
+    std::vector<uint8_t> SaveContainer::BuildImage() const {
+        std::vector<uint8_t> image;
+
+        AppendLE32(image, MAGIC);
+        AppendLE16(image, VERSION);
+        AppendLE16(image, (uint16_t)sections.size());
+
+        for (const auto& section : sections) {
+            AppendLE16(image, section.first);
+            AppendLE16(image, 0);
+            AppendLE32(image, (uint32_t)section.second.size());
+            AppendLE32(image, Crc32(section.second.data(), section.second.size()));
+            image.insert(image.end(), section.second.begin(), section.second.end());
+        }
+
+        return image;
+    }
+
+    bool SaveContainer::WriteImage(const std::vector<uint8_t>& image, uint64_t sequence) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+
+        // Ein neueres Abbild liegt bereits auf der Platte
+        if (sequence <= writtenSequence) return true;
+
+        std::string journalPath = filePath + ".tmp";
+        if (!WriteDurable(journalPath, image)) {
+            Logger::Error("Save-Journal konnte nicht geschrieben werden!");
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(journalPath, filePath, ec);
+        if (ec) {
+            Logger::Error("Save-Commit fehlgeschlagen: %s", ec.message().c_str());
+            return false;
+        }
+
+        writtenSequence = sequence;
+        commitCount++;
+        return true;
+    }
+
+    void SaveContainer::StartWriter() {
+        if (!writer.joinable()) {
+            writer = std::thread(&SaveContainer::WriterLoop, this);
+        }
+    }
+
+    void SaveContainer::WriterLoop() {
+        Tracer::GetInstance().SetThreadName("SaveWriter");
+
+        std::unique_lock<std::mutex> lock(queueMutex);
+        while (true) {
+            queueChanged.wait(lock, [this]() { return queuedSequence != 0 || !queuedTasks.empty() || stopWriter; });
+            if (queuedSequence == 0 && queuedTasks.empty()) break; // beendet und nichts mehr eingereiht
+
+            std::vector<uint8_t> image = std::move(queuedImage);
+            uint64_t sequence = queuedSequence;
+            std::vector<std::function<void()>> tasks;
+            tasks.swap(queuedTasks);
+            queuedSequence = 0;
+            writing = true;
+            lock.unlock();
+
+            if (sequence != 0) {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                FinishIO(FlightRecorder::SAVE_COMMIT, start, WriteImage(image, sequence));
+            }
+            for (auto& task : tasks) {
+                task();
+            }
+
+            lock.lock();
+            writing = false;
+            queueChanged.notify_all();
+        }
+    }
+
+    bool SaveContainer::FinishIO(uint8_t operation, std::chrono::steady_clock::time_point start, bool success) {
+        float durationMs = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        if (operation == FlightRecorder::SAVE_COMMIT) {
+            MetricsServer::GetInstance().RecordSaveWrite(durationMs, success);
+        }
+
+        // Der Flight Recorder nimmt nur Eintraege vom Haupt-Thread an, ReportPendingIO() reicht sie weiter
+        std::lock_guard<std::mutex> lock(ioMutex);
+        pendingIO.push_back({ operation, success, durationMs });
+        return success;
+    }
+
+    int SaveContainer::SyncFile(FILE* file) {
+#ifdef _WIN32
+        return _commit(_fileno(file));
+#else
+        return fsync(fileno(file));
+#endif
+    }
+
+    bool SaveContainer::WriteDurable(const std::string& path, const std::vector<uint8_t>& image) {
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) return false;
+
+        bool ok = std::fwrite(image.data(), 1, image.size(), file) == image.size();
+        ok = ok && std::fflush(file) == 0;
+        ok = ok && SyncFile(file) == 0; // Erst auf Platte, dann umbenennen
+        ok = (std::fclose(file) == 0) && ok;
+
+        return ok;
+    }
+
+    // === SaveWriter ===
+    void SaveWriter::WriteU8(uint8_t value) {
+        data.push_back(value);
+    }
+
+    void SaveWriter::WriteU16(uint16_t value) {
+        AppendLE16(data, value);
+    }
+
+    void SaveWriter::WriteU32(uint32_t value) {
+        AppendLE32(data, value);
+    }
+
+    void SaveWriter::WriteI32(int32_t value) {
+        AppendLE32(data, (uint32_t)value);
+    }
+
+    void SaveWriter::WriteFloat(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        AppendLE32(data, bits);
+    }
+
+    void SaveWriter::WriteString(const std::string& value) {
+        size_t length = value.size() > 255 ? 255 : value.size();
+        data.push_back((uint8_t)length);
+        data.insert(data.end(), value.begin(), value.begin() + length);
+    }
+
+    const std::vector<uint8_t>& SaveWriter::GetData() const {
+        return data;
+    }
+
+    // === SaveReader ===
+    SaveReader::SaveReader(const std::vector<uint8_t>* data)
+        : data(data)
+        , offset(0)
+        , valid(data != nullptr)
+    {
+    }
+
+    bool SaveReader::Require(size_t bytes) {
+        if (!valid || offset + bytes > data->size()) {
+            valid = false;
+            return false;
+        }
+        return true;
+    }
+
+    uint8_t SaveReader::ReadU8() {
+        if (!Require(1)) return 0;
+        return (*data)[offset++];
+    }
+
+    uint16_t SaveReader::ReadU16() {
+        if (!Require(2)) return 0;
+        uint16_t value = ReadLE16(data->data() + offset);
+        offset += 2;
+        return value;
+    }
+
+    uint32_t SaveReader::ReadU32() {
+        if (!Require(4)) return 0;
+        uint32_t value = ReadLE32(data->data() + offset);
+        offset += 4;
+        return value;
+    }
+
+    int32_t SaveReader::ReadI32() {
+        return (int32_t)ReadU32();
+    }
+
+    float SaveReader::ReadFloat() {
+        uint32_t bits = ReadU32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string SaveReader::ReadString() {
+        uint8_t length = ReadU8();
+        if (!Require(length)) return "";
+        std::string value((const char*)data->data() + offset, length);
+        offset += length;
+        return value;
+    }
+
+    bool SaveReader::IsValid() const {
+        return valid;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
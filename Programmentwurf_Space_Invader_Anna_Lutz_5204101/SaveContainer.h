@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Versionierter binaerer Save-Container
+     *
+     * Alle Spielstaende liegen in einer Datei mit Sektionen:
+     *   Header:  "SISV" | Version (u16) | Sektionsanzahl (u16)
+     *   Sektion: ID (u16) | reserviert (u16) | Laenge (u32) | CRC32 (u32) | Daten
+     *
+     * Geladen wird mit einem einzigen Lesezugriff, danach arbeitet das Spiel
+     * auf der Kopie im Speicher. Commit() schreibt das komplette Abbild in eine
+     * Journal-Datei (.tmp), synchronisiert sie per fsync und ersetzt die Haupt-
+     * datei danach atomar per rename. Ein Stromausfall hinterlaesst also entweder
+     * den alten oder den neuen Stand, nie einen halb geschriebenen.
+     *
+     * CommitInBackground() baut das Abbild auf dem aufrufenden Thread und
+     * ueberlaesst Schreiben, fsync und rename einem Writer-Thread (z.B. fuer
+     * Autosaves mitten in der Simulation). Jedes Abbild bekommt eine laufende
+     * Nummer; ein aelteres Abbild ueberschreibt nie ein neueres, auch wenn ein
+     * synchroner Commit den Writer ueberholt.
+     *
+     * QueueBackgroundTask() reiht weitere Schreibarbeit neben dem Container
+     * (z.B. die Run-Historie) auf demselben Writer ein; Aufgaben laufen in
+     * Reihenfolge nach dem jeweils eingereihten Abbild.
+     */
+    class SaveContainer {
+    public:
+        // === Sektions-IDs ===
+        enum SectionId : uint16_t {
+            SECTION_COINS = 1,
+            SECTION_HIGHSCORES = 2,
+            SECTION_STATISTICS = 3,
+            SECTION_AVATAR_UNLOCKS = 4,
+            SECTION_MOD_UNLOCKS = 5,
+            SECTION_MULTIPLAYER_BEST = 6,
+            SECTION_RUN_SNAPSHOT = 7    // laufende Partie (GameSnapshot), leer = keine
+        };
+
+        // === Konstruktor & Destruktor ===
+        SaveContainer() = default;
+        ~SaveContainer();
+
+        // === Datei-Operationen ===
+        bool Open(const std::string& path);
+        bool Commit();
+        void CommitInBackground();
+        void QueueBackgroundTask(std::function<void()> task);
+        void WaitForBackgroundWrites();
+        void ReportPendingIO();  // gesammelte Save-I/O an den Flight Recorder (nur Haupt-Thread)
+
+        // === Sektionen ===
+        const std::vector<uint8_t>* GetSection(uint16_t id) const;
+        bool SetSection(uint16_t id, const std::vector<uint8_t>& data);
+        bool HasSection(uint16_t id) const;
+
+        // === Statistiken ===
+        int GetCommitCount() const;
+
+        // === Constants ===
+        static const uint32_t MAGIC = 0x56535349; // "SISV" little endian
+        static const uint16_t VERSION = 1;
+
+        // === CRC32 (IEEE 802.3) ===
+        static uint32_t Crc32(const uint8_t* data, size_t length);
+
+        // === Dauerhaftes Schreiben (auch fuer Dateien neben dem Container) ===
+        static bool WriteDurable(const std::string& path, const std::vector<uint8_t>& image);
+        static int SyncFile(FILE* file);  // 0 = Daten liegen auf der Platte
+
+    private:
+        std::string filePath;
+        std::map<uint16_t, std::vector<uint8_t>> sections;
+        std::atomic<int> commitCount{ 0 };
+
+        // === Save-I/O fuer den Flight Recorder (Open/Commit laufen auch auf Workern) ===
+        struct IOResult {
+            uint8_t operation;      // FlightRecorder::SaveOperation
+            bool success;
+            float durationMs;
+        };
+        std::mutex ioMutex;
+        std::vector<IOResult> pendingIO;
+
+        // === Writer-Thread ===
+        std::thread writer;
+        std::mutex writeMutex;                   // Journal + rename, immer nur ein Schreiber
+        std::mutex queueMutex;
+        std::condition_variable queueChanged;
+        std::vector<uint8_t> queuedImage;
+        uint64_t queuedSequence = 0;             // 0 = nichts eingereiht
+        std::vector<std::function<void()>> queuedTasks;
+        uint64_t nextSequence = 0;               // nur Haupt-Thread
+        uint64_t writtenSequence = 0;            // unter writeMutex
+        bool writing = false;
+        bool stopWriter = false;
+
+        // === Private Hilfsfunktionen ===
+        bool ReadImage(const std::string& path,
+            std::map<uint16_t, std::vector<uint8_t>>& outSections, bool strict) const;
+        std::vector<uint8_t> BuildImage() const;
+
+        bool WriteImage(const std::vector<uint8_t>& image, uint64_t sequence);
+        void StartWriter();  // unter queueMutex
+        void WriterLoop();
+        bool FinishIO(uint8_t operation, std::chrono::steady_clock::time_point start, bool success);
+    };
+
+    /**
+     * @brief Schreibt Werte little-endian in einen Sektions-Puffer
+     */
+    class SaveWriter {
+    public:
+        void WriteU8(uint8_t value);
+        void WriteU16(uint16_t value);
+        void WriteU32(uint32_t value);
+        void WriteI32(int32_t value);
+        void WriteFloat(float value);
+        void WriteString(const std::string& value);
+
+        const std::vector<uint8_t>& GetData() const;
+
+    private:
+        std::vector<uint8_t> data;
+    };
+
+    /**
+     * @brief Liest Werte aus einem Sektions-Puffer (liefert 0 bei Ueberlauf)
+     */
+    class SaveReader {
+    public:
+        explicit SaveReader(const std::vector<uint8_t>* data);
+
+        uint8_t ReadU8();
+        uint16_t ReadU16();
+        uint32_t ReadU32();
+        int32_t ReadI32();
+        float ReadFloat();
+        std::string ReadString();
+
+        bool IsValid() const;
+
+    private:
+        const std::vector<uint8_t>* data;
+        size_t offset;
+        bool valid;
+
+        bool Require(size_t bytes);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "SaveSystem.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
 #include <fstream>
-#include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <filesystem>
@@ -8,19 +9,33 @@
 namespace SpaceInvaders {
 
     // === Konstruktor ===
-    SaveSystem::SaveSystem() {
+    SaveSystem::SaveSystem()
+        : transactionDepth(0)
+        , pendingCommit(false)
+        , runHistory(GameConfig::RUN_HISTORY_FOLDER)
+    {
+    }
+
+    SaveSystem::~SaveSystem() {
+        // Eingereihte Historien-Zeilen brauchen runHistory, das vor dem Container zerstoert wird
+        container.WaitForBackgroundWrites();
     }
 
     // === Initialisierung ===
     bool SaveSystem::Initialize() {
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
         CreateSaveDirectoryIfNeeded();
 
-        // Alle bentigten Dateien erstellen falls sie nicht existieren
-        EnsureFileExists(GameConfig::COINS_FILE);
-        EnsureFileExists(GameConfig::HIGHSCORE_FILE);
-        EnsureFileExists(GameConfig::STATISTICS_FILE);
-        EnsureFileExists(GameConfig::AVATAR_UNLOCKS_FILE);
-        EnsureFileExists(GameConfig::MOD_UNLOCKS_FILE);
+        // Ein einziger Lesezugriff - danach liegen alle Spielstaende im Speicher
+        if (!container.Open(GameConfig::SAVE_CONTAINER_FILE)) {
+            MigrateLegacyFiles();
+        }
+
+        // Ohne Historie laeuft das Spiel weiter, es fehlen nur die Auswertungen
+        if (!runHistory.Open()) {
+            Logger::Warning("Run-Historie nicht verfuegbar");
+        }
 
         return true;
     }
@@ -32,50 +47,42 @@ namespace SpaceInvaders {
             }
         }
         catch (const std::exception& e) {
-            std::cerr << "[FEHLER] Konnte Save-Ordner nicht erstellen: " << e.what() << std::endl;
+            Logger::Error("Konnte Save-Ordner nicht erstellen: %s", e.what());
         }
     }
 
     // === Coins System ===
     int SaveSystem::LoadCoins() {
-        std::ifstream file(GameConfig::COINS_FILE);
-        int coins = 0;
-
-        if (file.is_open()) {
-            file >> coins;
-            file.close();
-        }
-
-        return coins;
+        SaveReader reader(container.GetSection(SaveContainer::SECTION_COINS));
+        int coins = reader.ReadI32();
+        return reader.IsValid() ? coins : 0;
     }
 
     void SaveSystem::SaveCoins(int coins) {
-        std::ofstream file(GameConfig::COINS_FILE);
-        if (file.is_open()) {
-            file << coins << std::endl;
-            file.close();
-        }
-        else {
-            std::cerr << "[FEHLER] Konnte Coins nicht speichern!" << std::endl;
-        }
+        SaveWriter writer;
+        writer.WriteI32(coins);
+        StoreSection(SaveContainer::SECTION_COINS, writer.GetData());
     }
 
     // === Highscore System ===
     std::vector<HighscoreEntry> SaveSystem::LoadHighscores() {
-        std::vector<HighscoreEntry> scores;
-        std::ifstream file(GameConfig::HIGHSCORE_FILE);
+        MemoryTagScope memoryTag(MEMORY_SAVE);
 
-        if (file.is_open()) {
-            std::string line;
-            while (std::getline(file, line)) {
-                if (!line.empty()) {
-                    HighscoreEntry entry = ParseHighscoreEntry(line);
-                    if (!entry.playerName.empty()) {
-                        scores.push_back(entry);
-                    }
-                }
+        std::vector<HighscoreEntry> scores;
+        SaveReader reader(container.GetSection(SaveContainer::SECTION_HIGHSCORES));
+
+        int count = reader.ReadU16();
+        for (int i = 0; i < count && reader.IsValid(); i++) {
+            HighscoreEntry entry;
+            entry.playerName = reader.ReadString();
+            entry.score = reader.ReadI32();
+            entry.avatarUsed = (AvatarType)reader.ReadU8();
+            entry.modUsed = (ModType)reader.ReadU8();
+            entry.difficulty = (Difficulty)reader.ReadU8();
+
+            if (reader.IsValid() && !entry.playerName.empty()) {
+                scores.push_back(entry);
             }
-            file.close();
         }
 
         SortHighscores(scores);
@@ -84,6 +91,8 @@ namespace SpaceInvaders {
 
     void SaveSystem::SaveHighscore(const std::string& playerName, int score,
         AvatarType avatar, ModType mod, Difficulty difficulty) {
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
         // Bestehende Highscores laden
         std::vector<HighscoreEntry> scores = LoadHighscores();
 
@@ -106,122 +115,85 @@ namespace SpaceInvaders {
     }
 
     void SaveSystem::SaveHighscores(const std::vector<HighscoreEntry>& scores) {
-        std::ofstream file(GameConfig::HIGHSCORE_FILE);
-        if (file.is_open()) {
-            for (const auto& entry : scores) {
-                file << FormatHighscoreEntry(entry) << std::endl;
-            }
-            file.close();
-        }
-        else {
-            std::cerr << "[FEHLER] Konnte Highscores nicht speichern!" << std::endl;
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
+        SaveWriter writer;
+        writer.WriteU16((uint16_t)scores.size());
+        for (const auto& entry : scores) {
+            writer.WriteString(entry.playerName);
+            writer.WriteI32(entry.score);
+            writer.WriteU8((uint8_t)entry.avatarUsed);
+            writer.WriteU8((uint8_t)entry.modUsed);
+            writer.WriteU8((uint8_t)entry.difficulty);
         }
+        StoreSection(SaveContainer::SECTION_HIGHSCORES, writer.GetData());
     }
 
     // === Multiplayer Bestscore ===
     int SaveSystem::LoadBestMultiplayerScore() {
-        std::ifstream file("save/bestscore_multiplayer.txt");
-        int score = 0;
-
-        if (file.is_open()) {
-            file >> score;
-            file.close();
-        }
-
-        return score;
+        SaveReader reader(container.GetSection(SaveContainer::SECTION_MULTIPLAYER_BEST));
+        int score = reader.ReadI32();
+        return reader.IsValid() ? score : 0;
     }
 
     void SaveSystem::SaveBestMultiplayerScore(int score) {
-        std::ofstream file("save/bestscore_multiplayer.txt");
-        if (file.is_open()) {
-            file << score << std::endl;
-            file.close();
-        }
-        else {
-            std::cerr << "[FEHLER] Konnte Multiplayer-Bestscore nicht speichern!" << std::endl;
-        }
+        SaveWriter writer;
+        writer.WriteI32(score);
+        StoreSection(SaveContainer::SECTION_MULTIPLAYER_BEST, writer.GetData());
     }
 
     // === Statistiken ===
     GameStatistics SaveSystem::LoadStatistics() {
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
         GameStatistics stats = {}; // Alles auf 0 initialisieren
 
-        std::ifstream file(GameConfig::STATISTICS_FILE);
-        if (file.is_open()) {
-            std::string line;
-            while (std::getline(file, line)) {
-                std::istringstream iss(line);
-                std::string key;
-                if (std::getline(iss, key, '=')) {
-                    std::string value;
-                    if (std::getline(iss, value)) {
-                        // Verschiedene Statistik-Werte parsen
-                        if (key == "totalGamesPlayed") stats.totalGamesPlayed = std::stoi(value);
-                        else if (key == "totalScore") stats.totalScore = std::stoi(value);
-                        else if (key == "totalCoinsEarned") stats.totalCoinsEarned = std::stoi(value);
-                        else if (key == "totalEnemiesKilled") stats.totalEnemiesKilled = std::stoi(value);
-                        else if (key == "totalBossesDefeated") stats.totalBossesDefeated = std::stoi(value);
-                        else if (key == "totalPlayTime") stats.totalPlayTime = std::stof(value);
-                        // Avatar-Nutzung
-                        else if (key.substr(0, 11) == "avatarUsage") {
-                            int index = std::stoi(key.substr(11));
-                            if (index >= 0 && index < 5) {
-                                stats.avatarUsageCount[index] = std::stoi(value);
-                            }
-                        }
-                        // Schwierigkeits-Statistiken
-                        else if (key.substr(0, 13) == "difficultyWin") {
-                            int index = std::stoi(key.substr(13));
-                            if (index >= 0 && index < 3) {
-                                stats.difficultyWins[index] = std::stoi(value);
-                            }
-                        }
-                        else if (key.substr(0, 14) == "difficultyPlay") {
-                            int index = std::stoi(key.substr(14));
-                            if (index >= 0 && index < 3) {
-                                stats.difficultyPlays[index] = std::stoi(value);
-                            }
-                        }
-                    }
-                }
-            }
-            file.close();
+        SaveReader reader(container.GetSection(SaveContainer::SECTION_STATISTICS));
+        stats.totalGamesPlayed = reader.ReadI32();
+        stats.totalScore = reader.ReadI32();
+        stats.totalCoinsEarned = reader.ReadI32();
+        stats.totalEnemiesKilled = reader.ReadI32();
+        stats.totalBossesDefeated = reader.ReadI32();
+        stats.totalPlayTime = reader.ReadFloat();
+        for (int i = 0; i < 5; i++) {
+            stats.avatarUsageCount[i] = reader.ReadI32();
+        }
+        for (int i = 0; i < 3; i++) {
+            stats.difficultyWins[i] = reader.ReadI32();
+            stats.difficultyPlays[i] = reader.ReadI32();
         }
 
+        if (!reader.IsValid()) {
+            stats = {};
+        }
         return stats;
     }
 
     void SaveSystem::SaveStatistics(const GameStatistics& stats) {
-        std::ofstream file(GameConfig::STATISTICS_FILE);
-        if (file.is_open()) {
-            file << "totalGamesPlayed=" << stats.totalGamesPlayed << std::endl;
-            file << "totalScore=" << stats.totalScore << std::endl;
-            file << "totalCoinsEarned=" << stats.totalCoinsEarned << std::endl;
-            file << "totalEnemiesKilled=" << stats.totalEnemiesKilled << std::endl;
-            file << "totalBossesDefeated=" << stats.totalBossesDefeated << std::endl;
-            file << "totalPlayTime=" << stats.totalPlayTime << std::endl;
-
-            // Avatar-Nutzung
-            for (int i = 0; i < 5; i++) {
-                file << "avatarUsage" << i << "=" << stats.avatarUsageCount[i] << std::endl;
-            }
-
-            // Schwierigkeits-Statistiken
-            for (int i = 0; i < 3; i++) {
-                file << "difficultyWin" << i << "=" << stats.difficultyWins[i] << std::endl;
-                file << "difficultyPlay" << i << "=" << stats.difficultyPlays[i] << std::endl;
-            }
-
-            file.close();
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
+        SaveWriter writer;
+        writer.WriteI32(stats.totalGamesPlayed);
+        writer.WriteI32(stats.totalScore);
+        writer.WriteI32(stats.totalCoinsEarned);
+        writer.WriteI32(stats.totalEnemiesKilled);
+        writer.WriteI32(stats.totalBossesDefeated);
+        writer.WriteFloat(stats.totalPlayTime);
+        for (int i = 0; i < 5; i++) {
+            writer.WriteI32(stats.avatarUsageCount[i]);
         }
-        else {
-            std::cerr << "[FEHLER] Konnte Statistiken nicht speichern!" << std::endl;
+        for (int i = 0; i < 3; i++) {
+            writer.WriteI32(stats.difficultyWins[i]);
+            writer.WriteI32(stats.difficultyPlays[i]);
         }
+        StoreSection(SaveContainer::SECTION_STATISTICS, writer.GetData());
     }
 
     void SaveSystem::UpdateGameStatistics(int score, int coinsEarned, int enemiesKilled,
         bool bossDefeated, float playTime,
         AvatarType avatar, Difficulty difficulty) {
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
         GameStatistics stats = LoadStatistics();
 
         // Statistiken aktualisieren
@@ -249,6 +221,76 @@ namespace SpaceInvaders {
         SaveStatistics(stats);
     }
 
+    // === Freischaltungen (Bitmaske, ein Wort pro Katalog) ===
+    unsigned int SaveSystem::LoadUnlocks(uint16_t section) {
+        SaveReader reader(container.GetSection(section));
+        unsigned int mask = reader.ReadU32();
+        return reader.IsValid() ? mask : 0;
+    }
+
+    void SaveSystem::SaveUnlocks(uint16_t section, unsigned int unlockMask) {
+        SaveWriter writer;
+        writer.WriteU32(unlockMask);
+        StoreSection(section, writer.GetData());
+    }
+
+    // === Run-Historie ===
+    RunHistory& SaveSystem::GetRunHistory() {
+        return runHistory;
+    }
+
+    void SaveSystem::AppendRunRecord(const RunRecord& record) {
+        // Neun Spalten plus Index, jeweils mit fsync: nicht im Game-Over-Frame
+        container.QueueBackgroundTask([this, record]() {
+            runHistory.Append(record);
+        });
+    }
+
+    // === Laufende Partie ===
+    bool SaveSystem::LoadRunSnapshot(std::vector<uint8_t>& snapshot) const {
+        const std::vector<uint8_t>* data = container.GetSection(SaveContainer::SECTION_RUN_SNAPSHOT);
+        if (!data || data->empty()) return false;
+
+        snapshot = *data;
+        return true;
+    }
+
+    void SaveSystem::SaveRunSnapshot(const std::vector<uint8_t>& snapshot) {
+        // Der Snapshot ist bereits ein fertiger Byte-Puffer; Autosaves kommen
+        // aus der Simulation, fsync und rename laufen deshalb im Writer-Thread
+        StoreSection(SaveContainer::SECTION_RUN_SNAPSHOT, snapshot, true);
+    }
+
+    void SaveSystem::ClearRunSnapshot() {
+        if (HasRunSnapshot()) {
+            StoreSection(SaveContainer::SECTION_RUN_SNAPSHOT, {});
+        }
+    }
+
+    bool SaveSystem::HasRunSnapshot() const {
+        const std::vector<uint8_t>* data = container.GetSection(SaveContainer::SECTION_RUN_SNAPSHOT);
+        return data && !data->empty();
+    }
+
+    // === Transaktionen ===
+    void SaveSystem::BeginTransaction() {
+        transactionDepth++;
+    }
+
+    void SaveSystem::CommitTransaction() {
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
+        if (transactionDepth > 0) {
+            transactionDepth--;
+        }
+
+        // Alle Aenderungen der Transaktion mit einem fsync festschreiben
+        if (transactionDepth == 0 && pendingCommit) {
+            pendingCommit = false;
+            container.Commit();
+        }
+    }
+
     // === Hilfsfunktionen ===
     bool SaveSystem::FileExists(const std::string& filename) {
         std::ifstream file(filename);
@@ -279,6 +321,139 @@ namespace SpaceInvaders {
         }
     }
 
+    void SaveSystem::WaitForPendingWrites() {
+        container.WaitForBackgroundWrites();
+    }
+
+    void SaveSystem::ReportPendingIO() {
+        container.ReportPendingIO();
+    }
+
+    void SaveSystem::StoreSection(uint16_t id, const std::vector<uint8_t>& data, bool background) {
+        MemoryTagScope memoryTag(MEMORY_SAVE);
+
+        if (!container.SetSection(id, data)) {
+            return; // Unveraendert - kein Schreibzugriff
+        }
+
+        if (transactionDepth > 0) {
+            pendingCommit = true;
+        }
+        else if (background) {
+            container.CommitInBackground();
+        }
+        else {
+            container.Commit();
+        }
+    }
+
+    // === Migration der alten Textdateien ===
+    void SaveSystem::MigrateLegacyFiles() {
+        BeginTransaction();
+
+        if (FileExists(GameConfig::COINS_FILE)) {
+            std::ifstream file(GameConfig::COINS_FILE);
+            int coins = 0;
+            if (file >> coins) SaveCoins(coins);
+        }
+
+        if (FileExists(GameConfig::HIGHSCORE_FILE)) {
+            std::vector<HighscoreEntry> scores;
+            std::ifstream file(GameConfig::HIGHSCORE_FILE);
+            std::string line;
+            while (std::getline(file, line)) {
+                if (!line.empty()) {
+                    HighscoreEntry entry = ParseHighscoreEntry(line);
+                    if (!entry.playerName.empty()) {
+                        scores.push_back(entry);
+                    }
+                }
+            }
+            SortHighscores(scores);
+            TrimHighscores(scores);
+            SaveHighscores(scores);
+        }
+
+        if (FileExists(GameConfig::STATISTICS_FILE)) {
+            SaveStatistics(LoadLegacyStatistics());
+        }
+
+        if (FileExists(GameConfig::MULTIPLAYER_BESTSCORE_FILE)) {
+            std::ifstream file(GameConfig::MULTIPLAYER_BESTSCORE_FILE);
+            int score = 0;
+            if (file >> score) SaveBestMultiplayerScore(score);
+        }
+
+        SaveUnlocks(SaveContainer::SECTION_AVATAR_UNLOCKS, LoadLegacyUnlockMask(GameConfig::AVATAR_UNLOCKS_FILE));
+        SaveUnlocks(SaveContainer::SECTION_MOD_UNLOCKS, LoadLegacyUnlockMask(GameConfig::MOD_UNLOCKS_FILE));
+
+        // Auch ohne Altdaten einen gueltigen Container anlegen
+        pendingCommit = true;
+        CommitTransaction();
+        Logger::Info("Save-Container angelegt: %s", GameConfig::SAVE_CONTAINER_FILE);
+    }
+
+    GameStatistics SaveSystem::LoadLegacyStatistics() {
+        GameStatistics stats = {}; // Alles auf 0 initialisieren
+
+        std::ifstream file(GameConfig::STATISTICS_FILE);
+        if (file.is_open()) {
+            std::string line;
+            while (std::getline(file, line)) {
+                std::istringstream iss(line);
+                std::string key;
+                if (std::getline(iss, key, '=')) {
+                    std::string value;
+                    if (std::getline(iss, value)) {
+                        // Verschiedene Statistik-Werte parsen
+                        if (key == "totalGamesPlayed") stats.totalGamesPlayed = std::stoi(value);
+                        else if (key == "totalScore") stats.totalScore = std::stoi(value);
+                        else if (key == "totalCoinsEarned") stats.totalCoinsEarned = std::stoi(value);
+                        else if (key == "totalEnemiesKilled") stats.totalEnemiesKilled = std::stoi(value);
+                        else if (key == "totalBossesDefeated") stats.totalBossesDefeated = std::stoi(value);
+                        else if (key == "totalPlayTime") stats.totalPlayTime = std::stof(value);
+                        // Avatar-Nutzung
+                        else if (key.substr(0, 11) == "avatarUsage") {
+                            int index = std::stoi(key.substr(11));
+                            if (index >= 0 && index < 5) {
+                                stats.avatarUsageCount[index] = std::stoi(value);
+                            }
+                        }
+                        // Schwierigkeits-Statistiken
+                        else if (key.substr(0, 13) == "difficultyWin") {
+                            int index = std::stoi(key.substr(13));
+                            if (index >= 0 && index < 3) {
+                                stats.difficultyWins[index] = std::stoi(value);
+                            }
+                        }
+                        else if (key.substr(0, 14) == "difficultyPlay") {
+                            int index = std::stoi(key.substr(14));
+                            if (index >= 0 && index < 3) {
+                                stats.difficultyPlays[index] = std::stoi(value);
+                            }
+                        }
+                    }
+                }
+            }
+            file.close();
+        }
+
+        return stats;
+    }
+
+    unsigned int SaveSystem::LoadLegacyUnlockMask(const std::string& filename) {
+        unsigned int mask = 0;
+        std::ifstream file(filename);
+
+        int index;
+        while (file >> index) {
+            if (index >= 0 && index < 32) {
+                mask |= 1u << index;
+            }
+        }
+        return mask;
+    }
+
     // === Parsing Hilfsfunktionen ===
     HighscoreEntry SaveSystem::ParseHighscoreEntry(const std::string& line) {
         HighscoreEntry entry;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "GameConfig.h"
+#include "SaveContainer.h"
+#include "RunHistory.h"
 #include <vector>
 #include <string>
 
@@ -44,12 +46,16 @@ namespace SpaceInvaders {
      * - Highscores verwalten
      * - Statistiken sammeln und speichern
      * - Avatar/Mod-Freischaltungen
+     *
+     * Alle Daten liegen in einem binaeren SaveContainer (eine Datei,
+     * CRC pro Sektion). Mehrere Aenderungen koennen per Transaktion
+     * zu einem einzigen atomaren Commit zusammengefasst werden.
      */
     class SaveSystem {
     public:
         // === Konstruktor & Destruktor ===
         SaveSystem();
-        ~SaveSystem() = default;
+        ~SaveSystem();
 
         // === Initialisierung ===
         bool Initialize();
@@ -76,6 +82,26 @@ namespace SpaceInvaders {
             bool bossDefeated, float playTime,
             AvatarType avatar, Difficulty difficulty);
 
+        // === Freischaltungen (Bitmaske, eine Section pro Katalog) ===
+        unsigned int LoadUnlocks(uint16_t section);
+        void SaveUnlocks(uint16_t section, unsigned int unlockMask);
+
+        // === Run-Historie (eine Zeile pro beendeter Singleplayer-Runde) ===
+        RunHistory& GetRunHistory();
+        void AppendRunRecord(const RunRecord& record);  // fsyncs laufen auf dem Writer-Thread
+
+        // === Laufende Partie (GameSnapshot fuer Autosave/Fortsetzen) ===
+        bool LoadRunSnapshot(std::vector<uint8_t>& snapshot) const;
+        void SaveRunSnapshot(const std::vector<uint8_t>& snapshot);
+        void ClearRunSnapshot();
+        bool HasRunSnapshot() const;
+        void WaitForPendingWrites();
+        void ReportPendingIO();
+
+        // === Transaktionen (ein Commit fuer mehrere Aenderungen) ===
+        void BeginTransaction();
+        void CommitTransaction();
+
         // === Hilfsfunktionen ===
         bool FileExists(const std::string& filename);
         void EnsureFileExists(const std::string& filename);
@@ -84,6 +110,21 @@ namespace SpaceInvaders {
         static const int MAX_HIGHSCORE_ENTRIES = 10;
 
     private:
+        // === Save-Container ===
+        SaveContainer container;
+        int transactionDepth;
+        bool pendingCommit;
+
+        // === Run-Historie (eigene Dateien neben dem Container) ===
+        RunHistory runHistory;
+
+        void StoreSection(uint16_t id, const std::vector<uint8_t>& data, bool background = false);
+
+        // === Migration der alten Textdateien ===
+        void MigrateLegacyFiles();
+        GameStatistics LoadLegacyStatistics();
+        unsigned int LoadLegacyUnlockMask(const std::string& filename);
+
         // === Private Hilfsfunktionen ===
         std::string GetSaveFilePath(const std::string& filename);
         void SortHighscores(std::vector<HighscoreEntry>& scores);
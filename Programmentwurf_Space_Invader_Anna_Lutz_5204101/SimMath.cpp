@@ -0,0 +1,81 @@
+#include "SimMath.h"
+#include <array>
+#include <cmath>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        constexpr int SINE_TABLE_SIZE = 1 << SimMath::SINE_TABLE_BITS;
+        constexpr double HALF_TURN = 3.14159265358979323846;  // pi, PI ist ein raylib-Makro
+
+        // Taylor-Reihe in double, nur zur Compile-Zeit ausgewertet
+        constexpr double CompileTimeSin(double x) {
+            if (x > HALF_TURN) x -= 2.0 * HALF_TURN;
+            double term = x;
+            double sum = x;
+            for (int n = 1; n < 16; n++) {
+                term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+                sum += term;
+            }
+            return sum;
+        }
+
+        // Ein Eintrag mehr, damit die Interpolation nie umbrechen muss
+        constexpr std::array<int32_t, SINE_TABLE_SIZE + 1> BuildSineTable() {
+            std::array<int32_t, SINE_TABLE_SIZE + 1> table = {};
+            for (int i = 0; i <= SINE_TABLE_SIZE; i++) {
+                double value = CompileTimeSin(2.0 * HALF_TURN * i / SINE_TABLE_SIZE) * Fixed::ONE;
+                table[i] = (int32_t)(value < 0.0 ? value - 0.5 : value + 0.5);
+            }
+            return table;
+        }
+
+        constexpr std::array<int32_t, SINE_TABLE_SIZE + 1> SINE_TABLE = BuildSineTable();
+
+        static_assert(SINE_TABLE[0] == 0 && SINE_TABLE[SINE_TABLE_SIZE / 4] == Fixed::ONE,
+            "Sinus-Tabelle fehlerhaft");
+
+        // Winkel als Bruchteil einer Umdrehung (volle 32 Bit = 1 Umdrehung)
+        int32_t SineOfTurns(uint32_t turns) {
+            const int indexShift = 32 - SimMath::SINE_TABLE_BITS;
+            uint32_t index = turns >> indexShift;
+            int32_t weight = (int32_t)((turns >> (indexShift - 16)) & 0xFFFF);
+
+            int32_t low = SINE_TABLE[index];
+            int32_t high = SINE_TABLE[index + 1];
+            return low + (int32_t)(((int64_t)(high - low) * weight) >> 16);
+        }
+
+        uint32_t AngleToTurns(Fixed angle) {
+            // round(2^32 / 2pi): Bogenmass -> Umdrehungen ohne Division,
+            // ganze Umdrehungen fallen beim Abschneiden auf 32 Bit weg
+            const int64_t INV_TWO_PI_Q32 = 683565276;
+            return (uint32_t)(((int64_t)angle.GetRaw() * INV_TWO_PI_Q32) >> Fixed::FRACTION_BITS);
+        }
+
+        // Ueberladungen je nach SimScalar
+        Fixed Sine(Fixed angle) {
+            return Fixed::FromRaw(SineOfTurns(AngleToTurns(angle)));
+        }
+
+        Fixed Cosine(Fixed angle) {
+            // Viertelumdrehung voraus
+            return Fixed::FromRaw(SineOfTurns(AngleToTurns(angle) + 0x40000000u));
+        }
+
+        float Sine(float angle) { return sinf(angle); }
+        float Cosine(float angle) { return cosf(angle); }
+
+    } // namespace
+
+    // === Trigonometrie ===
+    SimScalar SimMath::Sin(SimScalar angle) {
+        return Sine(angle);
+    }
+
+    SimScalar SimMath::Cos(SimScalar angle) {
+        return Cosine(angle);
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "raylib.h"
+#include "GameConfig.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Festkomma-Zahl im Format Q16.16 fuer die Simulation
+     *
+     * Addition, Multiplikation und Division sind reine Ganzzahl-Operationen
+     * und liefern auf jedem Compiler, mit jeder Optimierungsstufe und ohne
+     * Einfluss von FMA-Kontraktion dieselben Bits. Wertebereich ca. +-32767
+     * bei einer Aufloesung von 1/65536 - fuer Bildschirmkoordinaten,
+     * Geschwindigkeiten und Spielzeit einer Partie mehr als genug.
+     *
+     * Ganzzahlen wandeln implizit, Gleitkommawerte nur explizit: so faellt
+     * jede Stelle auf, an der ein Float in die Simulation gelangt.
+     */
+    class Fixed {
+    public:
+        // === Konstruktoren ===
+        constexpr Fixed() : raw(0) {}
+
+        template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
+        constexpr Fixed(T value) : raw((int32_t)value * ONE) {}
+
+        // Skalierung mit 2^16 ist exakt, gerundet wird einmal kaufmaennisch
+        constexpr explicit Fixed(float value)
+            : raw((int32_t)(value * (float)ONE + (value < 0.0f ? -0.5f : 0.5f))) {}
+
+        static constexpr Fixed FromRaw(int32_t raw) {
+            Fixed result;
+            result.raw = raw;
+            return result;
+        }
+
+        // === Umwandlung ===
+        constexpr int32_t GetRaw() const { return raw; }
+        constexpr float ToFloat() const { return (float)raw / (float)ONE; }
+        constexpr int32_t ToInt() const { return raw / ONE; }  // Richtung 0
+
+        // === Arithmetik ===
+        constexpr Fixed operator-() const { return FromRaw(-raw); }
+        constexpr Fixed operator+(Fixed other) const { return FromRaw(raw + other.raw); }
+        constexpr Fixed operator-(Fixed other) const { return FromRaw(raw - other.raw); }
+        constexpr Fixed operator*(Fixed other) const {
+            return FromRaw((int32_t)(((int64_t)raw * other.raw) >> FRACTION_BITS));
+        }
+        constexpr Fixed operator/(Fixed other) const {
+            return FromRaw((int32_t)(((int64_t)raw * ONE) / other.raw));
+        }
+
+        constexpr Fixed& operator+=(Fixed other) { raw += other.raw; return *this; }
+        constexpr Fixed& operator-=(Fixed other) { raw -= other.raw; return *this; }
+        constexpr Fixed& operator*=(Fixed other) { return *this = *this * other; }
+        constexpr Fixed& operator/=(Fixed other) { return *this = *this / other; }
+
+        // === Vergleiche ===
+        constexpr bool operator==(Fixed other) const { return raw == other.raw; }
+        constexpr bool operator!=(Fixed other) const { return raw != other.raw; }
+        constexpr bool operator<(Fixed other) const { return raw < other.raw; }
+        constexpr bool operator<=(Fixed other) const { return raw <= other.raw; }
+        constexpr bool operator>(Fixed other) const { return raw > other.raw; }
+        constexpr bool operator>=(Fixed other) const { return raw >= other.raw; }
+
+        // === Constants ===
+        static constexpr int FRACTION_BITS = 16;
+        static constexpr int32_t ONE = 1 << FRACTION_BITS;
+
+    private:
+        int32_t raw;
+    };
+
+    // Ganzzahl links vom Operator (z.B. 2 * x) ohne Umweg ueber Float
+    template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
+    constexpr Fixed operator*(T left, Fixed right) { return Fixed(left) * right; }
+    template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
+    constexpr Fixed operator+(T left, Fixed right) { return Fixed(left) + right; }
+    template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
+    constexpr Fixed operator-(T left, Fixed right) { return Fixed(left) - right; }
+
+    static_assert(sizeof(Fixed) == sizeof(float), "Fixed ersetzt float in den Snapshot-States 1:1");
+    static_assert(std::is_trivially_copyable<Fixed>::value, "Fixed muss in POD-States stehen koennen");
+
+    /**
+     * @brief Zahlentyp aller Simulationswerte (Positionen, Geschwindigkeiten, Groessen)
+     *
+     * Umschaltbar ueber GameConfig::FIXED_POINT_SIMULATION. Mit float
+     * verhaelt sich die Simulation wie bisher, Ergebnisse koennen dann aber
+     * zwischen Compilern und Build-Einstellungen abweichen. Rendering und
+     * Bot-KI arbeiten immer mit float und wandeln ueber ToVector2/ToRectangle.
+     */
+    using SimScalar = std::conditional_t<GameConfig::FIXED_POINT_SIMULATION, Fixed, float>;
+
+    constexpr float ToFloat(float value) { return value; }
+    constexpr float ToFloat(Fixed value) { return value.ToFloat(); }
+
+    // Ganzzahlanteil, schneidet wie ein Cast Richtung 0 ab
+    constexpr int32_t ToInt(float value) { return (int32_t)value; }
+    constexpr int32_t ToInt(Fixed value) { return value.ToInt(); }
+
+    /**
+     * @brief Breiter Typ fuer quadrierte Abstaende
+     *
+     * Quadrate von Bildschirmkoordinaten sprengen den Q16.16-Bereich, im
+     * Festkomma-Modus wird daher auf den Rohwerten in 64 Bit (Q32.32)
+     * verglichen. Nur fuer Vergleiche gedacht, nicht zum Zurueckwandeln.
+     */
+    using SimWideScalar = std::conditional_t<GameConfig::FIXED_POINT_SIMULATION, int64_t, double>;
+
+    constexpr double WideSquare(float value) { return (double)value * value; }
+    constexpr int64_t WideSquare(Fixed value) { return (int64_t)value.GetRaw() * value.GetRaw(); }
+
+    struct SimVector2 {
+        SimScalar x;
+        SimScalar y;
+    };
+
+    /**
+     * @brief Achsenparalleles Rechteck der Simulation (Kollisionen)
+     */
+    struct SimRect {
+        SimScalar x;
+        SimScalar y;
+        SimScalar width;
+        SimScalar height;
+
+        // Gleiche Semantik wie raylib CheckCollisionRecs
+        constexpr bool Overlaps(const SimRect& other) const {
+            return x < other.x + other.width && x + width > other.x &&
+                y < other.y + other.height && y + height > other.y;
+        }
+
+        constexpr SimVector2 GetCenter() const {
+            return { x + width / SimScalar(2), y + height / SimScalar(2) };
+        }
+    };
+
+    // === Umwandlung fuer Rendering, Events und Bot-KI ===
+    inline Vector2 ToVector2(const SimVector2& value) {
+        return { ToFloat(value.x), ToFloat(value.y) };
+    }
+
+    inline Rectangle ToRectangle(const SimRect& value) {
+        return { ToFloat(value.x), ToFloat(value.y), ToFloat(value.width), ToFloat(value.height) };
+    }
+
+    inline SimVector2 ToSimVector2(const Vector2& value) {
+        return { SimScalar(value.x), SimScalar(value.y) };
+    }
+
+    /**
+     * @brief Trigonometrie der Simulation
+     *
+     * Im Festkomma-Modus aus einer zur Compile-Zeit erzeugten Tabelle
+     * (linear interpoliert, Fehler < 1e-4), sonst sinf/cosf.
+     */
+    class SimMath {
+    public:
+        static SimScalar Sin(SimScalar angle);  // Bogenmass
+        static SimScalar Cos(SimScalar angle);
+
+        // === Constants ===
+        static constexpr int SINE_TABLE_BITS = 10;  // 1024 Stuetzstellen pro Umdrehung
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
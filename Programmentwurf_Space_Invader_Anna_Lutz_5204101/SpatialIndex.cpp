@@ -0,0 +1,238 @@
+#include "SpatialIndex.h"
+#include <algorithm>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // Bruchteile ausserhalb von [-2, 2] sind fuer die Strecke [0, 1] egal,
+        // im Festkomma-Modus wuerde der Quotient dort aber ueberlaufen
+        Fixed Ratio(Fixed numerator, Fixed denominator) {
+            int64_t raw = ((int64_t)numerator.GetRaw() * Fixed::ONE) / denominator.GetRaw();
+            return Fixed::FromRaw((int32_t)std::clamp<int64_t>(raw, -2 * Fixed::ONE, 2 * Fixed::ONE));
+        }
+
+        float Ratio(float numerator, float denominator) {
+            return numerator / denominator;
+        }
+
+        // Schraenkt [enter, exit] auf den Teil ein, in dem die Strecke zwischen low und high liegt
+        bool ClipAxis(SimScalar start, SimScalar delta, SimScalar low, SimScalar high,
+            SimScalar& enter, SimScalar& exit) {
+
+            if (delta == SimScalar(0)) {
+                return !(start < low) && !(high < start);
+            }
+
+            SimScalar lowFraction = Ratio(low - start, delta);
+            SimScalar highFraction = Ratio(high - start, delta);
+            if (highFraction < lowFraction) std::swap(lowFraction, highFraction);
+
+            if (enter < lowFraction) enter = lowFraction;
+            if (highFraction < exit) exit = highFraction;
+            return !(exit < enter);
+        }
+
+        SimWideScalar DistanceSquared(SimVector2 point, const SimRect& bounds) {
+            SimScalar zero = SimScalar(0);
+            SimScalar dx = std::max({ bounds.x - point.x, zero, point.x - (bounds.x + bounds.width) });
+            SimScalar dy = std::max({ bounds.y - point.y, zero, point.y - (bounds.y + bounds.height) });
+            return WideSquare(dx) + WideSquare(dy);
+        }
+
+    } // namespace
+
+    // === Konstruktor ===
+    SpatialIndex::SpatialIndex()
+        : cellStart(CELL_COUNT + 1, 0)
+        , cellFill(CELL_COUNT, 0)
+        , queryStamp(0)
+    {
+    }
+
+    // === Aufbau ===
+    void SpatialIndex::Clear() {
+        entries.clear();
+        cellEntries.clear();
+        std::fill(cellStart.begin(), cellStart.end(), 0u);
+    }
+
+    int32_t SpatialIndex::Insert(const SimRect& bounds) {
+        entries.push_back({ bounds, 0, false });
+        return (int32_t)entries.size() - 1;
+    }
+
+    void SpatialIndex::Build() {
+        std::fill(cellStart.begin(), cellStart.end(), 0u);
+
+        // Zaehlen, Praefixsumme, dann verteilen (Counting-Sort ueber die Zellen)
+        for (const Entry& entry : entries) {
+            int lastColumn = ColumnOf(entry.bounds.x + entry.bounds.width);
+            int lastRow = RowOf(entry.bounds.y + entry.bounds.height);
+            for (int row = RowOf(entry.bounds.y); row <= lastRow; row++) {
+                for (int column = ColumnOf(entry.bounds.x); column <= lastColumn; column++) {
+                    cellStart[row * COLUMNS + column + 1]++;
+                }
+            }
+        }
+
+        for (int cell = 0; cell < CELL_COUNT; cell++) {
+            cellStart[cell + 1] += cellStart[cell];
+            cellFill[cell] = cellStart[cell];
+        }
+        cellEntries.resize(cellStart[CELL_COUNT]);
+
+        for (size_t id = 0; id < entries.size(); id++) {
+            const SimRect& bounds = entries[id].bounds;
+            int lastColumn = ColumnOf(bounds.x + bounds.width);
+            int lastRow = RowOf(bounds.y + bounds.height);
+            for (int row = RowOf(bounds.y); row <= lastRow; row++) {
+                for (int column = ColumnOf(bounds.x); column <= lastColumn; column++) {
+                    cellEntries[cellFill[row * COLUMNS + column]++] = (int32_t)id;
+                }
+            }
+        }
+    }
+
+    void SpatialIndex::Remove(int32_t id) {
+        if (id >= 0 && id < (int32_t)entries.size()) {
+            entries[id].removed = true;
+        }
+    }
+
+    // === Abfragen ===
+    void SpatialIndex::FindNearest(SimVector2 point, size_t count, std::vector<Neighbor>& out) {
+        out.clear();
+        if (count == 0 || entries.empty()) return;
+
+        NextQueryStamp();
+        int centerColumn = ColumnOf(point.x);
+        int centerRow = RowOf(point.y);
+        int maxRing = std::max({ centerColumn, COLUMNS - 1 - centerColumn, centerRow, ROWS - 1 - centerRow });
+
+        for (int ring = 0; ring <= maxRing; ring++) {
+            // Zellen im Ring liegen mindestens (ring - 1) Zellbreiten entfernt
+            if (out.size() == count && ring > 0 &&
+                out.back().distanceSquared <= WideSquare(SimScalar((ring - 1) * CELL_SIZE))) {
+                break;
+            }
+
+            for (int row = centerRow - ring; row <= centerRow + ring; row++) {
+                if (row < 0 || row >= ROWS) continue;
+
+                // Oberste und unterste Zeile ganz, dazwischen nur die beiden Randspalten
+                bool fullRow = row == centerRow - ring || row == centerRow + ring;
+                int step = fullRow ? 1 : std::max(1, 2 * ring);
+
+                for (int column = centerColumn - ring; column <= centerColumn + ring; column += step) {
+                    if (column < 0 || column >= COLUMNS) continue;
+
+                    int cell = row * COLUMNS + column;
+                    for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                        int32_t id = cellEntries[i];
+                        if (!Visit(id)) continue;
+
+                        SimWideScalar distance = DistanceSquared(point, entries[id].bounds);
+                        if (out.size() == count && !(distance < out.back().distanceSquared)) continue;
+
+                        // Sortiert einfuegen, Gleichstand bleibt in Besuchsreihenfolge
+                        auto position = std::upper_bound(out.begin(), out.end(), distance,
+                            [](SimWideScalar value, const Neighbor& neighbor) { return value < neighbor.distanceSquared; });
+                        out.insert(position, { id, distance });
+                        if (out.size() > count) out.pop_back();
+                    }
+                }
+            }
+        }
+    }
+
+    bool SpatialIndex::Raycast(SimVector2 from, SimVector2 to, RayHit& hit) {
+        if (entries.empty()) return false;
+
+        NextQueryStamp();
+        SimVector2 delta = { to.x - from.x, to.y - from.y };
+        int startRow = RowOf(from.y);
+        int endRow = RowOf(to.y);
+        int rowStep = endRow < startRow ? -1 : 1;
+        bool found = false;
+
+        for (int row = startRow;; row += rowStep) {
+            // Abschnitt der Strecke in dieser Zeile; innere Zeilengrenzen liegen
+            // immer zwischen from.y und to.y, delta.y ist dort also nicht 0
+            SimScalar enter = SimScalar(0);
+            SimScalar exit = SimScalar(1);
+            if (row != startRow) {
+                SimScalar edge = SimScalar((rowStep > 0 ? row : row + 1) * CELL_SIZE);
+                enter = Ratio(edge - from.y, delta.y);
+            }
+            if (row != endRow) {
+                SimScalar edge = SimScalar((rowStep > 0 ? row + 1 : row) * CELL_SIZE);
+                exit = Ratio(edge - from.y, delta.y);
+            }
+
+            int enterColumn = ColumnOf(from.x + delta.x * enter);
+            int exitColumn = ColumnOf(from.x + delta.x * exit);
+            int firstColumn = std::min(enterColumn, exitColumn);
+            int lastColumn = std::max(enterColumn, exitColumn);
+
+            for (int column = firstColumn; column <= lastColumn; column++) {
+                int cell = row * COLUMNS + column;
+                for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                    int32_t id = cellEntries[i];
+                    if (!Visit(id)) continue;
+
+                    const SimRect& bounds = entries[id].bounds;
+                    SimScalar entryFraction = SimScalar(0);
+                    SimScalar exitFraction = SimScalar(1);
+                    if (!ClipAxis(from.x, delta.x, bounds.x, bounds.x + bounds.width, entryFraction, exitFraction)) continue;
+                    if (!ClipAxis(from.y, delta.y, bounds.y, bounds.y + bounds.height, entryFraction, exitFraction)) continue;
+
+                    if (!found || entryFraction < hit.fraction) {
+                        hit = { id, entryFraction };
+                        found = true;
+                    }
+                }
+            }
+
+            // Spaetere Zeilen beginnen erst hinter exit, naeher geht es nicht mehr
+            if ((found && !(exit < hit.fraction)) || row == endRow) break;
+        }
+
+        return found;
+    }
+
+    // === Getters ===
+    size_t SpatialIndex::GetSize() const {
+        return entries.size();
+    }
+
+    const SimRect& SpatialIndex::GetBounds(int32_t id) const {
+        return entries[id].bounds;
+    }
+
+    // === Private Hilfsfunktionen ===
+    int SpatialIndex::ColumnOf(SimScalar x) {
+        return std::clamp(ToInt(x) / CELL_SIZE, 0, COLUMNS - 1);
+    }
+
+    int SpatialIndex::RowOf(SimScalar y) {
+        return std::clamp(ToInt(y) / CELL_SIZE, 0, ROWS - 1);
+    }
+
+    uint32_t SpatialIndex::NextQueryStamp() {
+        // Nach dem Ueberlauf koennten alte Stempel zufaellig passen
+        if (++queryStamp == 0) {
+            for (Entry& entry : entries) entry.visitStamp = 0;
+            queryStamp = 1;
+        }
+        return queryStamp;
+    }
+
+    bool SpatialIndex::Visit(int32_t id) {
+        Entry& entry = entries[id];
+        if (entry.removed || entry.visitStamp == queryStamp) return false;
+        entry.visitStamp = queryStamp;
+        return true;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "GameConfig.h"
+#include "SimMath.h"
+#include <cstdint>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Gleichmaessiges Gitter ueber dem Spielfeld fuer Nachbar- und Strahlabfragen
+     *
+     * Wird pro Tick einmal aus den lebenden Gegnern (und dem Boss) neu
+     * aufgebaut: Insert sammelt die Rechtecke, Build verteilt sie per
+     * Counting-Sort auf die Zellen. Ein Rechteck steht in jeder Zelle, die es
+     * beruehrt, Rechtecke ausserhalb des Spielfelds in den Randzellen.
+     *
+     * Abfragen lesen nur Zellen in der Naehe statt aller Eintraege:
+     * - FindNearest sucht ringweise um die Startzelle und hoert auf, sobald
+     *   kein weiterer Ring naeher liegen kann als der k-te Treffer.
+     * - Raycast laeuft die Strecke Zeile fuer Zeile ab und hoert nach der
+     *   ersten Zeile mit einem Treffer auf.
+     *
+     * Remove blendet einen Eintrag fuer alle weiteren Abfragen aus, ohne das
+     * Gitter neu aufzubauen. Gerechnet wird in SimScalar, die Ergebnisse
+     * sind also so deterministisch wie die Simulation selbst.
+     */
+    class SpatialIndex {
+    public:
+        struct Neighbor {
+            int32_t id;
+            SimWideScalar distanceSquared;  // zum naechsten Punkt des Rechtecks
+        };
+
+        struct RayHit {
+            int32_t id;
+            SimScalar fraction;  // 0 = Startpunkt, 1 = Endpunkt der Strecke
+        };
+
+        // === Konstruktor ===
+        SpatialIndex();
+
+        // === Aufbau (einmal pro Tick) ===
+        void Clear();
+        int32_t Insert(const SimRect& bounds);  // Ids fortlaufend ab 0
+        void Build();
+        void Remove(int32_t id);
+
+        // === Abfragen (out nach Abstand sortiert, Kapazitaet bleibt erhalten) ===
+        void FindNearest(SimVector2 point, size_t count, std::vector<Neighbor>& out);
+        bool Raycast(SimVector2 from, SimVector2 to, RayHit& hit);
+
+        // === Getters ===
+        size_t GetSize() const;
+        const SimRect& GetBounds(int32_t id) const;
+
+        // === Constants ===
+        static const int CELL_SIZE = 128;
+        static const int COLUMNS = (GameConfig::SCREEN_WIDTH + CELL_SIZE - 1) / CELL_SIZE;
+        static const int ROWS = (GameConfig::SCREEN_HEIGHT + CELL_SIZE - 1) / CELL_SIZE;
+        static const int CELL_COUNT = COLUMNS * ROWS;
+
+    private:
+        struct Entry {
+            SimRect bounds;
+            uint32_t visitStamp;  // letzte Abfrage, die den Eintrag schon geprueft hat
+            bool removed;
+        };
+
+        // === Zellen im CSR-Format: Eintraege von Zelle c in [cellStart[c], cellStart[c + 1]) ===
+        std::vector<Entry> entries;
+        std::vector<uint32_t> cellStart;
+        std::vector<uint32_t> cellFill;
+        std::vector<int32_t> cellEntries;
+        uint32_t queryStamp;
+
+        // === Private Hilfsfunktionen ===
+        static int ColumnOf(SimScalar x);
+        static int RowOf(SimScalar y);
+        uint32_t NextQueryStamp();
+        bool Visit(int32_t id);  // false = entfernt oder in dieser Abfrage schon geprueft
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "StatisticsCollector.h"
+#include "Tracer.h"
+#include <chrono>
+
+namespace SpaceInvaders {
+
+    // === Konstruktor & Destruktor ===
+    StatisticsCollector::StatisticsCollector()
+        : running(false)
+        , appliedCount(0)
+        , droppedAtRunStart(0)
+    {
+    }
+
+    StatisticsCollector::~StatisticsCollector() {
+        Stop();
+    }
+
+    // === Thread-Steuerung ===
+    void StatisticsCollector::Start() {
+        if (running.exchange(true)) return;
+        worker = std::thread(&StatisticsCollector::Run, this);
+    }
+
+    void StatisticsCollector::Stop() {
+        if (!running.exchange(false)) return;
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    // === Kanal & Ergebnisse ===
+    GameEventChannel& StatisticsCollector::GetChannel() {
+        return channel;
+    }
+
+    RunTotals StatisticsCollector::WaitForTotals() {
+        std::unique_lock<std::mutex> lock(totalsMutex);
+
+        // Warten bis alle bisher geschriebenen Ereignisse verarbeitet sind (der Worker meldet jeden Schub)
+        if (running.load()) {
+            size_t target = channel.GetPushedCount();
+            totalsChanged.wait_for(lock, std::chrono::milliseconds(MAX_WAIT_MS),
+                [this, target]() { return appliedCount >= target; });
+        }
+
+        RunTotals result = totals;
+        result.droppedEvents = (int)(channel.GetDroppedCount() - droppedAtRunStart);
+        return result;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void StatisticsCollector::Run() {
+        Tracer::GetInstance().SetThreadName("StatisticsCollector");
+
+        GameEvent event;
+        while (running.load(std::memory_order_relaxed)) {
+            if (channel.IsEmpty()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                continue;
+            }
+
+            TraceScope trace("StatisticsCollector::Drain");
+            while (channel.TryPop(event)) {
+                Apply(event);
+            }
+            totalsChanged.notify_all();
+        }
+    }
+
+    void StatisticsCollector::Apply(const GameEvent& event) {
+        std::lock_guard<std::mutex> lock(totalsMutex);
+        appliedCount++;
+
+        switch (event.type) {
+        case EVENT_RUN_STARTED:
+            totals = RunTotals();
+            droppedAtRunStart = channel.GetDroppedCount();
+            break;
+        case EVENT_ENEMY_KILLED:      totals.enemiesKilled++; break;
+        case EVENT_BOSS_DEFEATED:     totals.bossesDefeated++; break;
+        case EVENT_POWERUP_COLLECTED: totals.powerUpsCollected++; break;
+        case EVENT_PLAYER_HIT:
+            totals.playerHits++;
+            totals.lastHitCause = (HitCause)event.subtype;
+            break;
+        case EVENT_SHIELD_HIT:        totals.shieldHits++; break;
+        case EVENT_BULLET_CANCELLED:  totals.bulletsCancelled++; break;
+        default: break;
+        }
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "EventBus.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Zaehlerstaende einer Spielrunde
+     */
+    struct RunTotals {
+        int enemiesKilled = 0;
+        int bossesDefeated = 0;
+        int powerUpsCollected = 0;
+        int playerHits = 0;
+        int shieldHits = 0;
+        int bulletsCancelled = 0;
+        HitCause lastHitCause = HIT_NONE;  // Ursache des letzten Lebensverlusts
+        int droppedEvents = 0;             // Kanal war voll, Zaehler sind entsprechend zu niedrig
+    };
+
+    /**
+     * @brief Hintergrund-Konsument fuer Gameplay-Ereignisse
+     *
+     * Liest die Ereignisse ueber einen SPSC-Kanal auf einem eigenen Thread
+     * und zaehlt die Werte der laufenden Runde mit. Die Simulation schreibt
+     * nur in den Kanal und wartet erst beim Game Over auf die Summen.
+     */
+    class StatisticsCollector {
+    public:
+        // === Konstruktor & Destruktor ===
+        StatisticsCollector();
+        ~StatisticsCollector();
+
+        // === Thread-Steuerung ===
+        void Start();
+        void Stop();
+
+        // === Kanal & Ergebnisse ===
+        GameEventChannel& GetChannel();
+        RunTotals WaitForTotals();
+
+        // === Constants ===
+        static const int MAX_WAIT_MS = 500;  // laenger wartet das Game Over nicht auf den Worker
+
+    private:
+        GameEventChannel channel;
+        std::thread worker;
+        std::atomic<bool> running;
+
+        std::mutex totalsMutex;
+        std::condition_variable totalsChanged;
+        size_t appliedCount;                 // unter totalsMutex
+        size_t droppedAtRunStart;            // unter totalsMutex
+        RunTotals totals;
+
+        // === Private Hilfsfunktionen ===
+        void Run();
+        void Apply(const GameEvent& event);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
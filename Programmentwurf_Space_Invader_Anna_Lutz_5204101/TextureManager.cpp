@@ -1,5 +1,14 @@
 #include "TextureManager.h"
-#include <iostream>
+#include "Player.h"
+#include "Enemy.h"
+#include "Boss.h"
+#include "Tracer.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace SpaceInvaders {
 
@@ -16,49 +25,109 @@ namespace SpaceInvaders {
 
     // === Alle Texturen laden ===
     bool TextureManager::LoadAllTextures() {
-        bool allLoaded = true;
+        TraceScope trace("TextureManager::LoadAllTextures");
+
+        bool decoded = DecodeAllTextures();
+        bool uploaded = UploadDecodedTextures();
+        return decoded && uploaded;
+    }
+
+    // === Dekodieren (CPU, ohne raylib-Fenster) ===
+    bool TextureManager::DecodeAllTextures() {
+        TraceScope trace("TextureManager::DecodeAllTextures");
+
+        // Maximale Bildschirmgren der Sprites (Texturen werden darauf heruntergerechnet)
+        const int avatarSize = (int)Player::AVATAR_WIDTH;
+        const int enemySize = (int)Enemy::DEFAULT_SIZE + 16;   // inkl. Grenvariation
+        const int modIconSize = 80;                             // Mod-Karte, PowerUp-Puls, Indikatoren
+        const int iconSize = 64;                                // Leben- und Coin-Symbole
+        const int explosionSize = 128;
+
+        pendingImages = {
+            // === Avatar Texturen ===
+            { "avatar_blue", "grafiken/avatar_blue.png", avatarSize, avatarSize },
+            { "avatar_green", "grafiken/avatar_green.png", avatarSize, avatarSize },
+            { "avatar_red", "grafiken/avatar_red.png", avatarSize, avatarSize },
+            { "avatar_yellow", "grafiken/avatar_yellow.png", avatarSize, avatarSize },
+            { "avatar_purple", "grafiken/avatar_purple.png", avatarSize, avatarSize },
+
+            // === Enemy Texturen ===
+            { "enemy1", "grafiken/enemy1.png", enemySize, enemySize },
+            { "enemy2", "grafiken/enemy2.png", enemySize, enemySize },
+            { "enemy3", "grafiken/enemy3.png", enemySize, enemySize },
+            { "enemy4", "grafiken/enemy4.png", enemySize, enemySize },
+            { "enemy5", "grafiken/enemy5.png", enemySize, enemySize },
 
-        // === Avatar Texturen ===
-        allLoaded &= LoadTexture("avatar_blue", "grafiken/avatar_blue.png");
-        allLoaded &= LoadTexture("avatar_green", "grafiken/avatar_green.png");
-        allLoaded &= LoadTexture("avatar_red", "grafiken/avatar_red.png");
-        allLoaded &= LoadTexture("avatar_yellow", "grafiken/avatar_yellow.png");
-        allLoaded &= LoadTexture("avatar_purple", "grafiken/avatar_purple.png");
-
-        // === Enemy Texturen ===
-        allLoaded &= LoadTexture("enemy1", "grafiken/enemy1.png");
-        allLoaded &= LoadTexture("enemy2", "grafiken/enemy2.png");
-        allLoaded &= LoadTexture("enemy3", "grafiken/enemy3.png");
-        allLoaded &= LoadTexture("enemy4", "grafiken/enemy4.png");
-        allLoaded &= LoadTexture("enemy5", "grafiken/enemy5.png");
-
-        // === Mod Icon Texturen ===
-        allLoaded &= LoadTexture("mod_none", "grafiken/none.png");
-        allLoaded &= LoadTexture("mod_fastfire", "grafiken/fastfire.png");
-        allLoaded &= LoadTexture("mod_shield", "grafiken/shield.png");
-        allLoaded &= LoadTexture("mod_tripleshot", "grafiken/triple_shot.png");
-        allLoaded &= LoadTexture("mod_slowmo", "grafiken/slowmotion.png");
-
-        // === UI Texturen ===
-        allLoaded &= LoadTexture("life", "grafiken/life.png");
-        allLoaded &= LoadTexture("coin", "grafiken/coin.png");
-        allLoaded &= LoadTexture("explosion", "grafiken/explosion.png");
-
-        // === Background & Boss ===
-        allLoaded &= LoadTexture("background", "grafiken/background.png");
-        allLoaded &= LoadTexture("boss", "grafiken/boss.png");
+            // === Mod Icon Texturen ===
+            { "mod_none", "grafiken/none.png", modIconSize, modIconSize },
+            { "mod_fastfire", "grafiken/fastfire.png", modIconSize, modIconSize },
+            { "mod_shield", "grafiken/shield.png", modIconSize, modIconSize },
+            { "mod_tripleshot", "grafiken/triple_shot.png", modIconSize, modIconSize },
+            { "mod_slowmo", "grafiken/slowmotion.png", modIconSize, modIconSize },
+
+            // === UI Texturen ===
+            { "life", "grafiken/life.png", iconSize, iconSize },
+            { "coin", "grafiken/coin.png", iconSize, iconSize },
+            { "explosion", "grafiken/explosion.png", explosionSize, explosionSize },
+
+            // === Background & Boss ===
+            // Hintergrund wird in Originalhhe gescrollt und nie verkleinert: keine Mipmaps
+            { "background", "grafiken/background.png", 0, 0, false },
+            { "boss", "grafiken/boss.png", (int)Boss::DEFAULT_WIDTH, (int)Boss::DEFAULT_HEIGHT },
+        };
+
+        // PNG-Dekodierung und Skalierung sind reine CPU-Arbeit: Bilder auf mehrere Threads verteilen
+        std::atomic<size_t> nextImage(0);
+        std::atomic<bool> allDecoded(true);
+        auto decodeWorker = [this, &nextImage, &allDecoded]() {
+            MemoryTagScope memoryTag(MEMORY_TEXTURES);
+            for (size_t i = nextImage++; i < pendingImages.size(); i = nextImage++) {
+                if (!DecodeImage(pendingImages[i])) {
+                    allDecoded = false;
+                }
+            }
+        };
+
+        size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), DECODE_THREADS);
+        std::vector<std::thread> decodeThreads;
+        for (size_t t = 1; t < threadCount; t++) {
+            decodeThreads.emplace_back([&decodeWorker]() {
+                Tracer::GetInstance().SetThreadName("TextureDecode");
+                decodeWorker();
+            });
+        }
+        decodeWorker();
+        for (std::thread& thread : decodeThreads) {
+            thread.join();
+        }
+
+        return allDecoded;
+    }
+
+    // === Hochladen (Haupt-Thread, OpenGL-Kontext ntig) ===
+    bool TextureManager::UploadDecodedTextures() {
+        TraceScope trace("TextureManager::UploadDecodedTextures");
+        MemoryTagScope memoryTag(MEMORY_TEXTURES);
+
+        bool allLoaded = true;
+        for (PendingImage& pending : pendingImages) {
+            allLoaded &= UploadImage(pending);
+        }
+        pendingImages.clear();
 
         if (!allLoaded) {
-            std::cerr << "[FEHLER] Nicht alle Texturen konnten geladen werden!" << std::endl;
+            Logger::Error("Nicht alle Texturen konnten geladen werden!");
         }
 
+        PrintVideoMemoryReport();
+
         return allLoaded;
     }
 
     // === Alle Texturen entladen ===
     void TextureManager::UnloadAllTextures() {
         for (auto& pair : textures) {
-            UnloadTexture(pair.second);
+            UnloadTexture(pair.second.texture);
         }
         textures.clear();
     }
@@ -108,28 +177,113 @@ namespace SpaceInvaders {
         DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
     }
 
+    // === Grafikspeicher ===
+    size_t TextureManager::GetTotalVideoMemory() const {
+        size_t total = 0;
+        for (const auto& pair : textures) {
+            total += pair.second.videoMemory;
+        }
+        return total;
+    }
+
+    void TextureManager::PrintVideoMemoryReport() const {
+        // Sortiert nach Schlssel fr eine stabile Ausgabe
+        std::vector<std::string> keys;
+        for (const auto& pair : textures) {
+            keys.push_back(pair.first);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        Logger::Info("Textur-Speicher:");
+        for (const auto& key : keys) {
+            const TextureEntry& entry = textures.at(key);
+            Logger::Info("  %s: %dx%d -> %dx%d (%d Mip) %zu KiB", key.c_str(),
+                entry.sourceWidth, entry.sourceHeight, entry.texture.width, entry.texture.height,
+                entry.texture.mipmaps, (entry.videoMemory + 1023) / 1024);
+        }
+        Logger::Info("Textur-Speicher gesamt: %zu KiB", (GetTotalVideoMemory() + 1023) / 1024);
+    }
+
     // === Private Hilfsfunktionen ===
-    bool TextureManager::LoadTexture(const std::string& key, const std::string& filename) {
-        Texture2D texture = ::LoadTexture(filename.c_str());
+    bool TextureManager::DecodeImage(PendingImage& pending) {
+        TraceScope trace("TextureManager::DecodeImage", pending.filename);
+
+        Image image = LoadImage(pending.filename);
+
+        if (image.width == 0 || image.height == 0) {
+            Logger::Error("Textur konnte nicht geladen werden: %s", pending.filename);
+            return false;
+        }
+
+        pending.sourceWidth = image.width;
+        pending.sourceHeight = image.height;
+
+        // Auf maximale Zeichengre herunterrechnen (Seitenverhltnis bleibt erhalten)
+        if (pending.maxWidth > 0 && pending.maxHeight > 0) {
+            float scale = std::max((float)pending.maxWidth / image.width, (float)pending.maxHeight / image.height);
+            if (scale < 1.0f) {
+                ImageResize(&image, std::max(1, (int)(image.width * scale + 0.5f)),
+                    std::max(1, (int)(image.height * scale + 0.5f)));
+            }
+        }
+
+        // Optional: 16-Bit Formate (RGBA8 -> R4G4B4A4, RGB8 -> R5G6B5)
+        if (GameConfig::TEXTURE_COMPACT_FORMATS) {
+            bool hasAlpha = image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+            ImageFormat(&image, hasAlpha ? PIXELFORMAT_UNCOMPRESSED_R4G4B4A4 : PIXELFORMAT_UNCOMPRESSED_R5G6B5);
+        }
 
-        if (texture.width == 0 || texture.height == 0) {
-            std::cerr << "[FEHLER] Textur konnte nicht geladen werden: " << filename << std::endl;
+        pending.image = image;
+        return true;
+    }
+
+    bool TextureManager::UploadImage(PendingImage& pending) {
+        // Dekodieren fehlgeschlagen, Fehler wurde schon gemeldet
+        if (pending.image.data == nullptr) return false;
+
+        Texture2D texture = LoadTextureFromImage(pending.image);
+        UnloadImage(pending.image);
+        pending.image = {};
+
+        if (texture.id == 0) {
+            Logger::Error("Textur konnte nicht hochgeladen werden: %s", pending.filename);
             return false;
         }
 
-        textures[key] = texture;
+        if (pending.mipmaps) {
+            GenTextureMipmaps(&texture);
+            SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+        }
+        else {
+            SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+        }
+
+        textures[pending.key] = { texture, pending.sourceWidth, pending.sourceHeight, CalculateVideoMemory(texture) };
         return true;
     }
 
     Texture2D TextureManager::GetTexture(const std::string& key) const {
         auto it = textures.find(key);
         if (it != textures.end()) {
-            return it->second;
+            return it->second.texture;
         }
 
         // Fallback: Leere Textur zurckgeben
-        std::cerr << "[WARNUNG] Textur nicht gefunden: " << key << std::endl;
-        return { 0 };
+        Logger::Warning("Textur nicht gefunden: %s", key.c_str());
+        return {};
+    }
+
+    size_t TextureManager::CalculateVideoMemory(const Texture2D& texture) {
+        size_t bytes = 0;
+        int width = texture.width;
+        int height = texture.height;
+
+        for (int level = 0; level < std::max(1, texture.mipmaps); level++) {
+            bytes += GetPixelDataSize(width, height, texture.format);
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+        return bytes;
     }
 
     // === Avatar Dateinamen ===
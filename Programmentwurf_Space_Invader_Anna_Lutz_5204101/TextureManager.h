@@ -4,6 +4,8 @@
 #include "GameConfig.h"
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <cstddef>
 
 namespace SpaceInvaders {
 
@@ -12,6 +14,16 @@ namespace SpaceInvaders {
      *
      * Der TextureManager stellt sicher, dass alle Texturen nur einmal geladen werden
      * und einheitlich ber das gesamte Spiel verwendet werden knnen.
+     *
+     * Jede Textur wird beim Laden auf ihre maximale Bildschirmgre
+     * heruntergerechnet und mit Mipmaps hochgeladen (trilinear gefiltert),
+     * damit verkleinert gezeichnete Sprites nicht flimmern und weniger
+     * Grafikspeicher belegen.
+     *
+     * Das Laden ist zweigeteilt: DecodeAllTextures liest und skaliert die
+     * Bilder auf mehreren Threads und braucht kein Fenster, damit es beim
+     * Start parallel zum Fensteraufbau laufen kann. UploadDecodedTextures
+     * muss danach auf dem Haupt-Thread laufen (OpenGL-Kontext).
      */
     class TextureManager {
     public:
@@ -22,7 +34,9 @@ namespace SpaceInvaders {
         ~TextureManager();
 
         // === Haupt-Funktionen ===
-        bool LoadAllTextures();
+        bool LoadAllTextures();         // Dekodieren + Hochladen
+        bool DecodeAllTextures();       // beliebiger Thread, vor dem Hochladen
+        bool UploadDecodedTextures();   // Haupt-Thread, nach InitWindow
         void UnloadAllTextures();
 
         // === Avatar Texturen ===
@@ -41,21 +55,57 @@ namespace SpaceInvaders {
         Texture2D GetBackgroundTexture() const;
         Texture2D GetBossTexture() const;
 
+        // === Direkt ber den Schlssel (z.B. aus Katalog-Tabellen) ===
+        Texture2D GetTexture(const std::string& key) const;
+
         // === Hilfsfunktion fr skaliertes Zeichnen ===
         static void DrawTextureScaled(const Texture2D& texture, float x, float y, float w, float h, Color tint = WHITE);
 
+        // === Grafikspeicher ===
+        size_t GetTotalVideoMemory() const;
+        void PrintVideoMemoryReport() const;
+
     private:
         // === Singleton - Private Konstruktor ===
         TextureManager() = default;
         TextureManager(const TextureManager&) = delete;
         TextureManager& operator=(const TextureManager&) = delete;
 
+        /**
+         * @brief Geladene Textur mit Originalgre und VRAM-Belegung
+         */
+        struct TextureEntry {
+            Texture2D texture;
+            int sourceWidth;
+            int sourceHeight;
+            size_t videoMemory;
+        };
+
+        /**
+         * @brief Dekodiertes, noch nicht hochgeladenes Bild
+         */
+        struct PendingImage {
+            const char* key;
+            const char* filename;
+            int maxWidth;
+            int maxHeight;
+            bool mipmaps = true;
+            Image image = {};
+            int sourceWidth = 0;
+            int sourceHeight = 0;
+        };
+
         // === Textur-Container ===
-        std::unordered_map<std::string, Texture2D> textures;
+        std::unordered_map<std::string, TextureEntry> textures;
+        std::vector<PendingImage> pendingImages;
+
+        // === Constants ===
+        static constexpr size_t DECODE_THREADS = 4;
 
         // === Private Hilfsfunktionen ===
-        bool LoadTexture(const std::string& key, const std::string& filename);
-        Texture2D GetTexture(const std::string& key) const;
+        bool DecodeImage(PendingImage& pending);
+        bool UploadImage(PendingImage& pending);
+        static size_t CalculateVideoMemory(const Texture2D& texture);
 
         // === Avatar Dateinamen ===
         std::string GetAvatarFilename(AvatarType type) const;
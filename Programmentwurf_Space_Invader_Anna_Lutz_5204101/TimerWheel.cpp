@@ -0,0 +1,254 @@
+#include "TimerWheel.h"
+#include "GameConfig.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+    // === Globale Raeder (pro Thread, damit kopflose Simulationen parallel laufen) ===
+    TimerWheel& TimerWheel::GetGameTimers() {
+        thread_local TimerWheel instance;
+        return instance;
+    }
+
+    TimerWheel& TimerWheel::GetWorldTimers() {
+        thread_local TimerWheel instance;
+        return instance;
+    }
+
+    // === Konstruktor ===
+    TimerWheel::TimerWheel()
+        : currentTick(0)
+        , tickAccumulator(0.0f)
+        , pendingCount(0)
+    {
+        // Knoten vorab anlegen, damit spaetere Schedule-Aufrufe nicht allokieren
+        nodes.reserve(INITIAL_NODES);
+        freeNodes.reserve(INITIAL_NODES);
+
+        for (int level = 0; level < LEVEL_COUNT; level++) {
+            for (int slot = 0; slot < SLOT_COUNT; slot++) {
+                slots[level][slot] = -1;
+            }
+        }
+    }
+
+    // === Zeitfortschritt ===
+    void TimerWheel::Advance(float deltaTime) {
+        const float tickLength = 1.0f / GameConfig::SIMULATION_TICK_RATE;
+
+        tickAccumulator += deltaTime;
+        while (tickAccumulator >= tickLength) {
+            tickAccumulator -= tickLength;
+            Tick();
+        }
+    }
+
+    void TimerWheel::Tick() {
+        currentTick++;
+
+        // Ueberlauf einer Ebene: naechsthoeheren Slot nach unten verteilen
+        for (int level = 1; level < LEVEL_COUNT; level++) {
+            uint64_t mask = (1ULL << (level * SLOT_BITS)) - 1;
+            if ((currentTick & mask) != 0) break;
+            Cascade(level);
+        }
+
+        // Alle Knoten im aktuellen Slot sind jetzt faellig
+        int slot = (int)(currentTick & (SLOT_COUNT - 1));
+        while (slots[0][slot] != -1) {
+            int32_t index = slots[0][slot];
+            Unlink(index);
+
+            // Callback vor dem Aufruf herausloesen - er darf neu einplanen
+            std::function<void()> callback = std::move(nodes[index].callback);
+            Release(index);
+
+            if (callback) {
+                callback();
+            }
+        }
+    }
+
+    uint64_t TimerWheel::GetCurrentTick() const {
+        return currentTick;
+    }
+
+    uint64_t TimerWheel::GetTicksSince(uint64_t tick) const {
+        // Modulo 2^64: wiederhergestellte Zeitpunkte duerfen vor dem Start der Uhr liegen
+        return currentTick - tick;
+    }
+
+    float TimerWheel::GetTickAccumulator() const {
+        return tickAccumulator;
+    }
+
+    void TimerWheel::SetTickAccumulator(float accumulator) {
+        tickAccumulator = accumulator;
+    }
+
+    // === Einplanen & Abbrechen ===
+    TimerWheel::Handle TimerWheel::Schedule(float delaySeconds, std::function<void()> callback) {
+        return ScheduleTicks(SecondsToTicks(delaySeconds), std::move(callback));
+    }
+
+    TimerWheel::Handle TimerWheel::ScheduleTicks(uint32_t delayTicks, std::function<void()> callback) {
+        int32_t index;
+        if (!freeNodes.empty()) {
+            index = freeNodes.back();
+            freeNodes.pop_back();
+        }
+        else {
+            index = (int32_t)nodes.size();
+            nodes.emplace_back();
+        }
+
+        // Maximale Reichweite des Rads begrenzen
+        const uint64_t maxDelay = (1ULL << (LEVEL_COUNT * SLOT_BITS)) - 1;
+        uint64_t delay = delayTicks < 1 ? 1 : delayTicks;
+        if (delay > maxDelay) delay = maxDelay;
+
+        Node& node = nodes[index];
+        node.expiryTick = currentTick + delay;
+        node.callback = std::move(callback);
+        Insert(index);
+
+        pendingCount++;
+        return MakeHandle(index, node.generation);
+    }
+
+    bool TimerWheel::Cancel(Handle handle) {
+        int32_t index = Resolve(handle);
+        if (index < 0) return false;
+
+        Unlink(index);
+        nodes[index].callback = nullptr;
+        Release(index);
+        return true;
+    }
+
+    bool TimerWheel::IsPending(Handle handle) const {
+        return Resolve(handle) >= 0;
+    }
+
+    float TimerWheel::GetRemainingSeconds(Handle handle) const {
+        int32_t index = Resolve(handle);
+        if (index < 0) return 0.0f;
+
+        uint64_t remaining = nodes[index].expiryTick - currentTick;
+        float seconds = TicksToSeconds(remaining) - tickAccumulator;
+        return seconds > 0.0f ? seconds : 0.0f;
+    }
+
+    uint32_t TimerWheel::GetRemainingTicks(Handle handle) const {
+        int32_t index = Resolve(handle);
+        if (index < 0) return 0;
+
+        // Ohne Abzug des angebrochenen Ticks: der wird separat gesichert
+        uint64_t remaining = nodes[index].expiryTick - currentTick;
+        return (uint32_t)std::min<uint64_t>(remaining, UINT32_MAX);
+    }
+
+    void TimerWheel::Clear() {
+        for (int32_t index = 0; index < (int32_t)nodes.size(); index++) {
+            if (nodes[index].level >= 0) {
+                Unlink(index);
+                nodes[index].callback = nullptr;
+                Release(index);
+            }
+        }
+        tickAccumulator = 0.0f;
+    }
+
+    // === Statistiken ===
+    size_t TimerWheel::GetPendingCount() const {
+        return pendingCount;
+    }
+
+    // === Umrechnung ===
+    uint32_t TimerWheel::SecondsToTicks(float seconds) {
+        if (seconds <= 0.0f) return 0;
+        return (uint32_t)std::lround(seconds * GameConfig::SIMULATION_TICK_RATE);
+    }
+
+    float TimerWheel::TicksToSeconds(uint64_t ticks) {
+        return (float)ticks / GameConfig::SIMULATION_TICK_RATE;
+    }
+
+    // === Private Hilfsfunktionen ===
+    void TimerWheel::Insert(int32_t index) {
+        Node& node = nodes[index];
+        uint64_t delta = node.expiryTick > currentTick ? node.expiryTick - currentTick : 0;
+
+        // Ebene nach Abstand waehlen, Slot nach Ablaufzeitpunkt
+        int level = 0;
+        while (level < LEVEL_COUNT - 1 && delta >= (1ULL << ((level + 1) * SLOT_BITS))) {
+            level++;
+        }
+        int slot = (int)((node.expiryTick >> (level * SLOT_BITS)) & (SLOT_COUNT - 1));
+
+        node.level = (int16_t)level;
+        node.slot = (int16_t)slot;
+        node.prev = -1;
+        node.next = slots[level][slot];
+        if (node.next != -1) {
+            nodes[node.next].prev = index;
+        }
+        slots[level][slot] = index;
+    }
+
+    void TimerWheel::Unlink(int32_t index) {
+        Node& node = nodes[index];
+        if (node.prev != -1) {
+            nodes[node.prev].next = node.next;
+        }
+        else {
+            slots[node.level][node.slot] = node.next;
+        }
+        if (node.next != -1) {
+            nodes[node.next].prev = node.prev;
+        }
+
+        node.prev = -1;
+        node.next = -1;
+        node.level = -1;
+        node.slot = -1;
+    }
+
+    void TimerWheel::Release(int32_t index) {
+        nodes[index].generation++;   // alte Handles werden ungueltig
+        freeNodes.push_back(index);
+        pendingCount--;
+    }
+
+    void TimerWheel::Cascade(int level) {
+        int slot = (int)((currentTick >> (level * SLOT_BITS)) & (SLOT_COUNT - 1));
+
+        int32_t index = slots[level][slot];
+        slots[level][slot] = -1;
+
+        while (index != -1) {
+            int32_t next = nodes[index].next;
+            Insert(index);
+            index = next;
+        }
+    }
+
+    int32_t TimerWheel::Resolve(Handle handle) const {
+        if (handle == INVALID_HANDLE) return -1;
+
+        int32_t index = (int32_t)(handle & 0xFFFFFFFFu);
+        uint32_t generation = (uint32_t)(handle >> 32);
+
+        if (index < 0 || index >= (int32_t)nodes.size()) return -1;
+        const Node& node = nodes[index];
+        if (node.generation != generation || node.level < 0) return -1;
+        return index;
+    }
+
+    TimerWheel::Handle TimerWheel::MakeHandle(int32_t index, uint32_t generation) {
+        return ((Handle)generation << 32) | (uint32_t)index;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
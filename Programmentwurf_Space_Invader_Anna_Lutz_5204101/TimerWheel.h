@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Hierarchisches Timer-Rad auf Basis von Simulations-Ticks
+     *
+     * Statt dass jedes Objekt pro Frame eigene float-Timer hochzaehlt,
+     * wird ein Ablauf einmal eingeplant und das Rad feuert pro Tick nur
+     * die faelligen Eintraege. Einplanen, Abbrechen und Ausloesen sind O(1).
+     *
+     * Aufbau: 4 Ebenen mit je 64 Slots. Ebene 0 deckt die naechsten 64 Ticks
+     * ab, jede hoehere Ebene das 64-fache. Laeuft eine Ebene ueber, wird der
+     * passende Slot der naechsten Ebene nach unten einsortiert.
+     *
+     * Fuer reine Cooldowns reicht ein Vergleich mit GetCurrentTick(), dafuer
+     * muss nichts eingeplant werden.
+     */
+    class TimerWheel {
+    public:
+        // === Handle fuer eingeplante Timer (0 = ungueltig) ===
+        using Handle = uint64_t;
+        static const Handle INVALID_HANDLE = 0;
+
+        // === Globale Raeder (eine Instanz pro Thread) ===
+        static TimerWheel& GetGameTimers();   // Echtzeit (Spieler, Spawns, SlowMotion)
+        static TimerWheel& GetWorldTimers();  // Spielwelt-Zeit (folgt SlowMotion)
+
+        // === Konstruktor ===
+        TimerWheel();
+
+        // === Zeitfortschritt ===
+        void Advance(float deltaTime);
+        void Tick();
+        uint64_t GetCurrentTick() const;
+        uint64_t GetTicksSince(uint64_t tick) const;
+        float GetTickAccumulator() const;  // angebrochener Tick (fuer Snapshots)
+        void SetTickAccumulator(float accumulator);
+
+        // === Einplanen & Abbrechen ===
+        Handle Schedule(float delaySeconds, std::function<void()> callback);
+        Handle ScheduleTicks(uint32_t delayTicks, std::function<void()> callback);
+        bool Cancel(Handle handle);
+        bool IsPending(Handle handle) const;
+        float GetRemainingSeconds(Handle handle) const;
+        uint32_t GetRemainingTicks(Handle handle) const;  // ganze Ticks, fuer Snapshots
+        void Clear();
+
+        // === Statistiken ===
+        size_t GetPendingCount() const;
+
+        // === Umrechnung ===
+        static uint32_t SecondsToTicks(float seconds);
+        static float TicksToSeconds(uint64_t ticks);
+
+        // === Constants ===
+        static const int LEVEL_COUNT = 4;
+        static const int SLOT_BITS = 6;
+        static const int SLOT_COUNT = 1 << SLOT_BITS;
+        static const size_t INITIAL_NODES = 64;  // reicht fuer alle gleichzeitig laufenden Timer einer Partie
+
+    private:
+        // === Timer-Knoten (doppelt verkettet innerhalb eines Slots) ===
+        struct Node {
+            uint64_t expiryTick = 0;
+            uint32_t generation = 1;
+            int32_t prev = -1;
+            int32_t next = -1;
+            int16_t level = -1;
+            int16_t slot = -1;
+            std::function<void()> callback;
+        };
+
+        std::vector<Node> nodes;
+        std::vector<int32_t> freeNodes;
+        int32_t slots[LEVEL_COUNT][SLOT_COUNT];
+        uint64_t currentTick;
+        float tickAccumulator;
+        size_t pendingCount;
+
+        // === Private Hilfsfunktionen ===
+        void Insert(int32_t index);
+        void Unlink(int32_t index);
+        void Release(int32_t index);
+        void Cascade(int level);
+        int32_t Resolve(Handle handle) const;
+        static Handle MakeHandle(int32_t index, uint32_t generation);
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include "Tracer.h"
+#include "Logger.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace SpaceInvaders {
+
+    namespace {
+
+        // Puffer des aktuellen Threads (bleibt bis Programmende gueltig)
+        thread_local void* currentThreadBuffer = nullptr;
+
+        void WriteEscaped(std::ofstream& file, const char* text) {
+            for (const char* c = text; *c; c++) {
+                if (*c == '"' || *c == '\\') file << '\\';
+                if ((unsigned char)*c >= 0x20) file << *c;
+            }
+        }
+
+    } // namespace
+
+    // === Singleton ===
+    Tracer& Tracer::GetInstance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    Tracer::Tracer()
+        : enabled(false)
+        , startTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    Tracer::~Tracer() {
+        // Aufzeichnung spaetestens beim Programmende schreiben
+        Stop();
+    }
+
+    // === Steuerung ===
+    void Tracer::Start(const std::string& path) {
+        if (enabled.load()) return;
+
+        outputPath = path;
+        startTime = std::chrono::steady_clock::now();
+        SetThreadName("Main");
+        enabled.store(true);
+
+        Logger::Info("Tracing aktiv, Ausgabe: %s", outputPath.c_str());
+    }
+
+    bool Tracer::Stop() {
+        if (!enabled.exchange(false)) return false;
+        return WriteFile();
+    }
+
+    // === Aufzeichnung ===
+    void Tracer::SetThreadName(const char* name) {
+        ThreadBuffer* buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        buffer->threadName = name;
+    }
+
+    void Tracer::Record(const char* name, int64_t start, int64_t duration, const char* detail) {
+        ThreadBuffer* buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+
+        // Unter der Sperre erneut pruefen: Stop() kann seit TraceScope umgeschaltet haben
+        if (!enabled.load(std::memory_order_relaxed)) return;
+
+        if (buffer->chunks.empty() || buffer->chunks.back()->count == EVENTS_PER_CHUNK) {
+            buffer->chunks.push_back(std::make_unique<Chunk>());
+        }
+
+        Chunk& chunk = *buffer->chunks.back();
+        TraceEvent& event = chunk.events[chunk.count++];
+        event.name = name;
+        event.start = start;
+        event.duration = duration;
+        event.detail[0] = '\0';
+        if (detail) {
+            std::strncpy(event.detail, detail, sizeof(event.detail) - 1);
+            event.detail[sizeof(event.detail) - 1] = '\0';
+        }
+    }
+
+    int64_t Tracer::Now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    // === Private Hilfsfunktionen ===
+    Tracer::ThreadBuffer* Tracer::GetThreadBuffer() {
+        if (currentThreadBuffer) {
+            return static_cast<ThreadBuffer*>(currentThreadBuffer);
+        }
+
+        // Erste Aufzeichnung dieses Threads: einmalig anmelden
+        std::lock_guard<std::mutex> lock(registryMutex);
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->threadId = (uint32_t)threadBuffers.size() + 1;
+        buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+
+        currentThreadBuffer = buffer.get();
+        threadBuffers.push_back(std::move(buffer));
+        return threadBuffers.back().get();
+    }
+
+    bool Tracer::WriteFile() {
+        std::ofstream file(outputPath);
+        if (!file.is_open()) {
+            Logger::Error("Trace-Datei konnte nicht geschrieben werden: %s", outputPath.c_str());
+            return false;
+        }
+
+        size_t eventCount = 0;
+        char number[32];
+        bool first = true;
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+        // Pro Puffer warten, bis ein laufendes Record() fertig ist; danach
+        // sieht jeder weitere Aufruf enabled == false
+        std::lock_guard<std::mutex> registryLock(registryMutex);
+        for (const auto& buffer : threadBuffers) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            if (!first) file << ",\n";
+            first = false;
+
+            file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                << ",\"args\":{\"name\":\"";
+            WriteEscaped(file, buffer->threadName.c_str());
+            file << "\"}}";
+
+            for (const auto& chunk : buffer->chunks) {
+                for (size_t i = 0; i < chunk->count; i++) {
+                    const TraceEvent& event = chunk->events[i];
+
+                    // Zeitangaben in Mikrosekunden mit ns-Aufloesung
+                    file << ",\n{\"name\":\"";
+                    WriteEscaped(file, event.name);
+                    std::snprintf(number, sizeof(number), "%.3f", event.start / 1000.0);
+                    file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"ts\":" << number;
+                    std::snprintf(number, sizeof(number), "%.3f", event.duration / 1000.0);
+                    file << ",\"dur\":" << number;
+
+                    if (event.detail[0] != '\0') {
+                        file << ",\"args\":{\"detail\":\"";
+                        WriteEscaped(file, event.detail);
+                        file << "\"}";
+                    }
+                    file << '}';
+                    eventCount++;
+                }
+            }
+        }
+
+        file << "\n]}\n";
+
+        Logger::Info("Trace gespeichert: %s (%zu Abschnitte)", outputPath.c_str(), eventCount);
+        return true;
+    }
+
+    // === TraceScope ===
+    TraceScope::TraceScope(const char* name, const char* detail)
+        : name(name)
+        , detail(detail)
+        , start(-1)
+    {
+        Tracer& tracer = Tracer::GetInstance();
+        if (tracer.IsEnabled()) {
+            start = tracer.Now();
+        }
+    }
+
+    TraceScope::~TraceScope() {
+        if (start < 0) return;
+
+        Tracer& tracer = Tracer::GetInstance();
+        if (tracer.IsEnabled()) {
+            tracer.Record(name, start, tracer.Now() - start, detail);
+        }
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
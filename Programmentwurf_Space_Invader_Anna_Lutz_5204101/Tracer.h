@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Ein abgeschlossener Zeitabschnitt (Chrome "complete event")
+     */
+    struct TraceEvent {
+        const char* name;       // String-Literal, wird nicht kopiert
+        int64_t start;          // ns seit Trace-Start
+        int64_t duration;       // ns
+        char detail[40];        // optional, z.B. Dateiname (gekuerzt)
+    };
+
+    /**
+     * @brief Zeichnet benannte Abschnitte fuer den Chrome/Perfetto Trace-Viewer auf
+     *
+     * Jeder Thread schreibt in eigene Puffer-Bloecke, die nur er selbst
+     * fuellt. Die Sperre pro Puffer ist im Normalfall unbestritten, nur
+     * Stop nimmt sie zusaetzlich, um laufende Aufzeichnungen abzuwarten.
+     * Beim Beenden (Stop oder Programmende) wird alles als Trace-Event-JSON
+     * geschrieben und kann in chrome://tracing oder ui.perfetto.dev
+     * geoeffnet werden.
+     */
+    class Tracer {
+    public:
+        // === Singleton Pattern ===
+        static Tracer& GetInstance();
+
+        // === Steuerung ===
+        void Start(const std::string& outputPath);
+        bool Stop();
+        bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+        // === Aufzeichnung ===
+        void SetThreadName(const char* name);
+        void Record(const char* name, int64_t start, int64_t duration, const char* detail);
+        int64_t Now() const;
+
+        // === Constants ===
+        static const size_t EVENTS_PER_CHUNK = 4096;
+
+    private:
+        // === Singleton - Private Konstruktor ===
+        Tracer();
+        ~Tracer();
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        struct Chunk {
+            std::array<TraceEvent, EVENTS_PER_CHUNK> events;
+            size_t count = 0;
+        };
+
+        struct ThreadBuffer {
+            std::mutex mutex;       // besitzender Thread beim Schreiben, Stop beim Ausgeben
+            uint32_t threadId;
+            std::string threadName;
+            std::vector<std::unique_ptr<Chunk>> chunks;
+        };
+
+        // === Private Hilfsfunktionen ===
+        ThreadBuffer* GetThreadBuffer();
+        bool WriteFile();
+
+        std::atomic<bool> enabled;
+        std::string outputPath;
+        std::chrono::steady_clock::time_point startTime;
+
+        std::mutex registryMutex;   // Anmeldung neuer Threads, Ausgabe
+        std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+    };
+
+    /**
+     * @brief RAII-Messung eines Abschnitts (kostet nur einen Flag-Test, wenn Tracing aus ist)
+     */
+    class TraceScope {
+    public:
+        explicit TraceScope(const char* name, const char* detail = nullptr);
+        ~TraceScope();
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+    private:
+        const char* name;
+        const char* detail;
+        int64_t start;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
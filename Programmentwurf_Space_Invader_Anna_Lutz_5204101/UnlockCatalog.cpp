@@ -0,0 +1,247 @@
+#include "UnlockCatalog.h"
+#include "TextureManager.h"
+#include "GameConfig.h"
+
+namespace SpaceInvaders {
+
+    // === Konstruktor ===
+    UnlockCatalogBase::UnlockCatalogBase(const CatalogEntry* entries, int count, uint16_t saveSection, const CatalogLayout& layout)
+        : entries(entries)
+        , count(count)
+        , saveSection(saveSection)
+        , layout(layout)
+        , buttonStates{}
+        , saveSystem(nullptr)
+    {
+        LoadUnlocks();
+    }
+
+    // === Persistenz ===
+    void UnlockCatalogBase::SetSaveSystem(SaveSystem* system) {
+        saveSystem = system;
+    }
+
+    void UnlockCatalogBase::LoadUnlocks() {
+        unlocked = saveSystem ? saveSystem->LoadUnlocks(saveSection) : 0;
+
+        // Kostenlose Eintraege sind immer freigeschaltet
+        for (int i = 0; i < count; i++) {
+            if (entries[i].cost == 0) {
+                unlocked.set(i);
+            }
+        }
+    }
+
+    void UnlockCatalogBase::SaveUnlocks() {
+        if (saveSystem) {
+            saveSystem->SaveUnlocks(saveSection, GetUnlockMask());
+        }
+    }
+
+    // === Eintraege & Freischaltung ===
+    int UnlockCatalogBase::GetCount() const {
+        return count;
+    }
+
+    const CatalogEntry& UnlockCatalogBase::GetEntry(int index) const {
+        return entries[index];
+    }
+
+    bool UnlockCatalogBase::IsUnlocked(int index) const {
+        return unlocked.test(index);
+    }
+
+    bool UnlockCatalogBase::CanAfford(int index, int coins) const {
+        return coins >= entries[index].cost;
+    }
+
+    bool UnlockCatalogBase::Purchase(int index, int& coins) {
+        if (IsUnlocked(index)) return true;
+        if (!CanAfford(index, coins)) return false;
+
+        coins -= entries[index].cost;
+        unlocked.set(index);
+
+        // Coins und Freischaltung gemeinsam in einem Commit sichern
+        if (saveSystem) {
+            saveSystem->BeginTransaction();
+            saveSystem->SaveCoins(coins);
+            SaveUnlocks();
+            saveSystem->CommitTransaction();
+        }
+        return true;
+    }
+
+    uint32_t UnlockCatalogBase::GetUnlockMask() const {
+        return (uint32_t)unlocked.to_ulong();
+    }
+
+    // === Eingabe ===
+    UnlockCatalogBase::ChooseResult UnlockCatalogBase::HandleShopInput(const InputManager& input, int& selection, int& coins) {
+        ChooseResult result = CHOOSE_NONE;
+
+        switch (input.GetNavigationInput()) {
+        case InputManager::NAV_LEFT:
+            selection = (selection - 1 + count) % count;
+            break;
+        case InputManager::NAV_RIGHT:
+            selection = (selection + 1) % count;
+            break;
+        case InputManager::NAV_CONFIRM:
+            result = Choose(selection, coins);
+            break;
+        default:
+            break;
+        }
+
+        // Maus-Input fuer die Karten (Animation laeuft fuer alle Karten weiter)
+        for (int i = 0; i < count; i++) {
+            if (UpdateAnimatedButton(input, GetCardRect(i), buttonStates[i], WHITE, YELLOW, ORANGE)) {
+                selection = i;
+                result = Choose(i, coins);
+            }
+        }
+
+        return result;
+    }
+
+    int UnlockCatalogBase::GetHoveredIndex(const InputManager& input) const {
+        for (int i = 0; i < count; i++) {
+            if (input.IsMouseOverRectangle(GetCardRect(i))) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    Rectangle UnlockCatalogBase::GetCardRect(int index) const {
+        float startX = (GameConfig::SCREEN_WIDTH - (count * layout.spacing - (layout.spacing - layout.cardSize))) / 2;
+        return { startX + index * layout.spacing, layout.startY, layout.cardSize, layout.cardSize };
+    }
+
+    // === Darstellung ===
+    void UnlockCatalogBase::RenderGrid(int selectedIndex, int hoveredIndex, Color selectionColor) {
+        // Karten nur neu zeichnen wenn sich Auswahl, Hover oder Unlocks aendern
+        uint64_t stateKey = RenderCache::MakeKey({
+            selectedIndex, hoveredIndex, (int)GetUnlockMask(), ColorToInt(selectionColor)
+        });
+        Rectangle gridArea = { 0, layout.startY - 10, (float)GameConfig::SCREEN_WIDTH, layout.cardSize + 40 };
+
+        if (gridCache.BeginUpdate(gridArea, stateKey)) {
+            auto& textureManager = TextureManager::GetInstance();
+            Texture2D coinTexture = textureManager.GetCoinTexture();
+
+            // Karten ueberlappen nicht, also nach Zeichenart statt nach Karte sortieren:
+            // Flaechen, Rahmen, Coin-Symbole und Texte bleiben je Durchgang in einem Batch.
+            // Die Bilder (Durchgang 2) binden pro Karte eine eigene Textur und brechen
+            // den Batch weiterhin pro Karte; dafuer wird das Grid nur bei Aenderungen neu gezeichnet.
+
+            // Durchgang 1: Flaechen
+            for (int i = 0; i < count; i++) {
+                Rectangle rect = GetCardRect(i);
+                if (layout.glowWhenSelected && i == selectedIndex && IsUnlocked(i)) {
+                    DrawRectangleRec({ rect.x - 5, rect.y - 5, rect.width + 10, rect.height + 10 }, Fade(selectionColor, 0.3f));
+                }
+                DrawRectangleRec(rect, Fade(BLACK, 0.8f));
+            }
+
+            // Durchgang 2: Bilder (gesperrte abgedunkelt)
+            for (int i = 0; i < count; i++) {
+                Rectangle rect = GetCardRect(i);
+                Color tint = IsUnlocked(i) ? WHITE : Fade(GRAY, 0.5f);
+                TextureManager::DrawTextureScaled(textureManager.GetTexture(entries[i].textureKey),
+                    rect.x + 10, rect.y + 10, rect.width - 20, rect.height - 20, tint);
+            }
+
+            // Durchgang 3: Rahmen
+            for (int i = 0; i < count; i++) {
+                Color frameColor = DARKGRAY;
+                float frameThickness = 2.0f;
+
+                if (IsUnlocked(i)) {
+                    frameColor = WHITE;
+                    if (i == selectedIndex) {
+                        frameColor = selectionColor;
+                        frameThickness = 4.0f;
+                    }
+                    else if (i == hoveredIndex) {
+                        frameColor = LIGHTGRAY;
+                        frameThickness = 3.0f;
+                    }
+                }
+                DrawRectangleLinesEx(GetCardRect(i), frameThickness, frameColor);
+            }
+
+            // Durchgang 4: Coin-Symbol gesperrter Eintraege
+            for (int i = 0; i < count; i++) {
+                if (!IsUnlocked(i)) {
+                    Rectangle rect = GetCardRect(i);
+                    TextureManager::DrawTextureScaled(coinTexture, rect.x + 5, rect.y + 5, 20, 20);
+                }
+            }
+
+            // Durchgang 5: Texte (Font-Textur)
+            int lockWidth = MeasureText("LOCKED", layout.lockFontSize);
+            for (int i = 0; i < count; i++) {
+                Rectangle rect = GetCardRect(i);
+
+                if (!IsUnlocked(i)) {
+                    DrawText("LOCKED", rect.x + (rect.width - lockWidth) / 2,
+                        rect.y + rect.height - layout.lockFontSize - 10, layout.lockFontSize, RED);
+                    DrawText(TextFormat("%d", entries[i].cost), rect.x + 30, rect.y + 5, layout.lockFontSize, YELLOW);
+                }
+
+                // Name unter der Karte
+                int nameWidth = MeasureText(entries[i].name, layout.nameFontSize);
+                DrawText(entries[i].name, rect.x + (rect.width - nameWidth) / 2,
+                    rect.y + rect.height + 5, layout.nameFontSize, WHITE);
+            }
+
+            gridCache.EndUpdate();
+        }
+        gridCache.Draw();
+    }
+
+    void UnlockCatalogBase::RenderDescription(int index) const {
+        const CatalogEntry& entry = entries[index];
+
+        // Beschreibungs-Box
+        Rectangle descBox = { 50, 350, GameConfig::SCREEN_WIDTH - 100, 100 };
+        DrawRectangleRec(descBox, Fade(DARKGRAY, 0.8f));
+        DrawRectangleLinesEx(descBox, 2, WHITE);
+
+        // Titel und Beschreibung
+        DrawText(entry.name, descBox.x + 20, descBox.y + 20, 24, YELLOW);
+        DrawText(entry.description, descBox.x + 20, descBox.y + 50, 18, WHITE);
+
+        // Status
+        if (IsUnlocked(index)) {
+            DrawText("FREIGESCHALTET", descBox.x + 20, descBox.y + 75, 16, GREEN);
+        }
+        else {
+            DrawText(TextFormat("Kosten: %d Coins", entry.cost), descBox.x + 20, descBox.y + 75, 16, ORANGE);
+        }
+    }
+
+    void UnlockCatalogBase::RenderCoinDisplay(int coins) {
+        Texture2D coinTexture = TextureManager::GetInstance().GetCoinTexture();
+
+        int x = GameConfig::SCREEN_WIDTH - 150;
+        int y = 20;
+        int fontSize = 30;
+
+        // Coins-Text
+        const char* coinText = TextFormat("%d", coins);
+        int textWidth = MeasureText(coinText, fontSize);
+        DrawText(coinText, x, y, fontSize, YELLOW);
+
+        // Coin-Icon
+        TextureManager::DrawTextureScaled(coinTexture, x + textWidth + 10, y - 3, fontSize + 6, fontSize + 6);
+    }
+
+    // === Private Hilfsfunktionen ===
+    UnlockCatalogBase::ChooseResult UnlockCatalogBase::Choose(int index, int& coins) {
+        return Purchase(index, coins) ? CHOOSE_CONFIRMED : CHOOSE_NOT_ENOUGH_COINS;
+    }
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "raylib.h"
+#include "InputManager.h"
+#include "RenderCache.h"
+#include "SaveSystem.h"
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+    /**
+     * @brief Ein Eintrag im Katalog (Index in der Tabelle = Enum-Wert)
+     */
+    struct CatalogEntry {
+        const char* name;
+        const char* description;
+        const char* textureKey;   // Schluessel im TextureManager
+        int cost;                 // 0 = von Anfang an freigeschaltet
+    };
+
+    /**
+     * @brief Aussehen des Kauf-Grids
+     */
+    struct CatalogLayout {
+        float cardSize;
+        float spacing;
+        float startY;
+        int nameFontSize;
+        int lockFontSize;
+        bool glowWhenSelected;
+    };
+
+    /**
+     * @brief Freischaltbare Inhalte: Tabelle, Kauf, Persistenz und Grid
+     *
+     * Die Eintraege kommen aus einer constexpr-Tabelle, der Katalog
+     * selbst haelt nur den Freischalt-Zustand als Bitset, der als ein
+     * 32-Bit-Wort in der angegebenen Section des Save-Containers liegt.
+     * Neue Kosmetik (Schuss-Skins, Hintergruende, ...) braucht damit nur
+     * eine Tabelle, eine Section und eine UnlockCatalog-Instanz.
+     *
+     * Das Grid wird ueber RenderCache nur bei Aenderungen neu gezeichnet,
+     * und dann nach Zeichenart sortiert (Flaechen, Bilder, Rahmen, Text).
+     * Flaechen, Rahmen und Text landen so je in einem Batch; die Bilder
+     * haben pro Karte eine eigene Textur und kosten weiterhin einen Batch je Karte.
+     */
+    class UnlockCatalogBase {
+    public:
+        // === Auswahl-Ergebnis ===
+        enum ChooseResult {
+            CHOOSE_NONE,
+            CHOOSE_CONFIRMED,          // freigeschaltet oder gerade gekauft
+            CHOOSE_NOT_ENOUGH_COINS
+        };
+
+        // === Persistenz ===
+        void SetSaveSystem(SaveSystem* system);
+        void LoadUnlocks();
+        void SaveUnlocks();
+
+        // === Eintraege & Freischaltung ===
+        int GetCount() const;
+        const CatalogEntry& GetEntry(int index) const;
+        bool IsUnlocked(int index) const;
+        bool CanAfford(int index, int coins) const;
+        bool Purchase(int index, int& coins);
+        uint32_t GetUnlockMask() const;
+
+        // === Eingabe (Pfeiltasten links/rechts, ENTER, Mausklick) ===
+        ChooseResult HandleShopInput(const InputManager& input, int& selection, int& coins);
+        int GetHoveredIndex(const InputManager& input) const;
+        Rectangle GetCardRect(int index) const;
+
+        // === Darstellung ===
+        void RenderGrid(int selectedIndex, int hoveredIndex, Color selectionColor);
+        void RenderDescription(int index) const;
+        static void RenderCoinDisplay(int coins);
+
+        // === Constants ===
+        static const int MAX_ITEMS = 32;  // ein Wort im Save-Container
+
+    protected:
+        UnlockCatalogBase(const CatalogEntry* entries, int count, uint16_t saveSection, const CatalogLayout& layout);
+
+    private:
+        const CatalogEntry* entries;
+        int count;
+        uint16_t saveSection;
+        CatalogLayout layout;
+
+        std::bitset<MAX_ITEMS> unlocked;
+        std::array<ButtonState, MAX_ITEMS> buttonStates;
+
+        SaveSystem* saveSystem;
+        RenderCache gridCache;
+
+        // === Private Hilfsfunktionen ===
+        ChooseResult Choose(int index, int& coins);
+    };
+
+    /**
+     * @brief Typisierter Katalog ueber einer Enum-Tabelle mit Count Eintraegen
+     */
+    template <typename ItemType, int Count>
+    class UnlockCatalog : public UnlockCatalogBase {
+        static_assert(Count > 0 && Count <= MAX_ITEMS, "Freischaltungen werden als ein 32-Bit-Wort gespeichert");
+
+    public:
+        UnlockCatalog(const CatalogEntry (&table)[Count], uint16_t saveSection, const CatalogLayout& layout)
+            : UnlockCatalogBase(table, Count, saveSection, layout)
+        {
+        }
+
+        using UnlockCatalogBase::GetEntry;
+        using UnlockCatalogBase::IsUnlocked;
+        using UnlockCatalogBase::Purchase;
+
+        const CatalogEntry& GetEntry(ItemType type) const { return GetEntry((int)type); }
+        bool IsUnlocked(ItemType type) const { return IsUnlocked((int)type); }
+        bool Purchase(ItemType type, int& coins) { return Purchase((int)type, coins); }
+
+        static ItemType GetType(int index) { return (ItemType)index; }
+
+        static constexpr int COUNT = Count;
+    };
+
+} // namespace SpaceInvaders
\ No newline at end of file
@@ -1,6 +1,19 @@
 #include "Game.h"
+#include "BalanceSweep.h"
+#include "RunHistory.h"
+#include "Tracer.h"
+#include "FlightRecorder.h"
+#include "Logger.h"
+#include "NetSession.h"
+#include "RollbackSession.h"
 #include <iostream>
+#include <fstream>
 #include <exception>
+#include <string>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <algorithm>
 
 /**
  * Space Invaders - Hauptprogramm
@@ -14,19 +27,108 @@
  * - Coin-System und Freischaltungen
  * - Boss-Kämpfe und PowerUps
  * - Vollständiges Save-System
+ *
+ * Balancing-Werkzeug (ohne Fenster):
+ *   SpaceInvaders --balance-sweep [Partien pro Konfiguration] [Ausgabe.csv]
+ *
+ * Auswertung der gespielten Runden (CSV, Schwierigkeit x Avatar, 0 Tage = alle):
+ *   SpaceInvaders --run-report [Tage] [Ausgabe.csv]
+ *
+ * Trace-Aufzeichnung (Chrome/Perfetto JSON, wird beim Beenden geschrieben):
+ *   SpaceInvaders --trace [Ausgabe.json]
+ *
+ * Zwei-Spieler-Partie über UDP mit Rollback (auch als zwei Prozesse auf einem Rechner):
+ *   SpaceInvaders --net-host [Port] [Eingabe-Verzögerung in Frames]
+ *   SpaceInvaders --net-join [Adresse] [Port]
  */
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
+        // Kopfloser Balance-Sweep statt des Spiels
+        if (argc > 1 && std::string(argv[1]) == "--balance-sweep") {
+            SpaceInvaders::SweepOptions options;
+            if (argc > 2) options.gamesPerConfiguration = std::max(1, std::atoi(argv[2]));
+            if (argc > 3) options.outputFile = argv[3];
+
+            SpaceInvaders::BalanceSweep sweep(options);
+            return sweep.Run() ? 0 : -1;
+        }
+
+        // Run-Historie auswerten statt des Spiels (nur lesen, das Spiel darf parallel laufen)
+        if (argc > 1 && std::string(argv[1]) == "--run-report") {
+            SpaceInvaders::RunHistory history(SpaceInvaders::GameConfig::RUN_HISTORY_FOLDER);
+            if (!history.OpenReadOnly()) {
+                SpaceInvaders::Logger::Error("Run-Historie konnte nicht geoeffnet werden!");
+                return -1;
+            }
+
+            SpaceInvaders::RunFilter filter;
+            int days = argc > 2 ? std::max(0, std::atoi(argv[2])) : 0;
+            if (days > 0) {
+                filter.since = (int64_t)std::time(nullptr) - (int64_t)days * 24 * 60 * 60;
+            }
+
+            bool written = false;
+            if (argc > 3) {
+                std::ofstream file(argv[3]);
+                written = file && history.WriteReport(file, filter);
+            }
+            else {
+                written = history.WriteReport(std::cout, filter);
+            }
+            SpaceInvaders::Logger::GetInstance().Flush();
+            return written ? 0 : -1;
+        }
+
+        // Abschnitte fuer den Trace-Viewer aufzeichnen
+        if (argc > 1 && std::string(argv[1]) == "--trace") {
+            SpaceInvaders::Tracer::GetInstance().Start(argc > 2 ? argv[2] : "trace.json");
+        }
+
+        // Netzwerk-Partie: Handshake vor dem Öffnen des Fensters
+        std::unique_ptr<SpaceInvaders::NetSession> netSession;
+        std::string mode = argc > 1 ? argv[1] : "";
+        if (mode == "--net-host" || mode == "--net-join") {
+            netSession = std::make_unique<SpaceInvaders::NetSession>();
+            bool opened = false;
+
+            if (mode == "--net-host") {
+                SpaceInvaders::NetMatchSettings settings;
+                settings.seed = (uint64_t)std::time(nullptr);
+                if (argc > 3) {
+                    settings.inputDelay = std::clamp(std::atoi(argv[3]), 0, SpaceInvaders::RollbackSession::MAX_INPUT_DELAY);
+                }
+                int port = argc > 2 ? std::atoi(argv[2]) : SpaceInvaders::GameConfig::NET_DEFAULT_PORT;
+                opened = netSession->Host((uint16_t)port, settings);
+            }
+            else {
+                std::string address = argc > 2 ? argv[2] : "127.0.0.1";
+                int port = argc > 3 ? std::atoi(argv[3]) : SpaceInvaders::GameConfig::NET_DEFAULT_PORT;
+                opened = netSession->Join(address, (uint16_t)port);
+            }
+
+            if (!opened || !netSession->WaitForPeer(SpaceInvaders::GameConfig::NET_CONNECT_TIMEOUT)) {
+                SpaceInvaders::Logger::Error("Netzwerk-Partie konnte nicht gestartet werden!");
+                return -1;
+            }
+        }
+
         // Spiel-Instanz erstellen
         SpaceInvaders::Game game;
 
         // Spiel initialisieren
         if (!game.Initialize()) {
-            std::cerr << "[KRITISCHER FEHLER] Spiel konnte nicht initialisiert werden!" << std::endl;
+            SpaceInvaders::Logger::Error("Spiel konnte nicht initialisiert werden!");
             return -1;
         }
 
+        if (netSession) {
+            game.StartNetworkMatch(std::move(netSession));
+        }
+
+        // Start-Meldungen vor dem Banner ausgeben
+        SpaceInvaders::Logger::GetInstance().Flush();
+
         std::cout << "=== SPACE INVADERS ===" << std::endl;
         std::cout << "Spiel gestartet. Viel Spass!" << std::endl;
         std::cout << "" << std::endl;
@@ -44,22 +146,27 @@ int main() {
         std::cout << "- Player 1: A/D bewegen, W schiessen" << std::endl;
         std::cout << "- Player 2: Pfeiltasten bewegen, Pfeil Hoch schiessen" << std::endl;
         std::cout << "- P: Pause" << std::endl;
+        std::cout << "" << std::endl;
+        std::cout << "NETZWERK (--net-host / --net-join):" << std::endl;
+        std::cout << "- Beide Spieler: Pfeiltasten bewegen, Pfeil Hoch schiessen" << std::endl;
         std::cout << "======================" << std::endl;
 
         // Hauptschleife starten
         game.Run();
 
-        std::cout << "[INFO] Spiel ordnungsgemäß beendet." << std::endl;
+        SpaceInvaders::Logger::Info("Spiel ordnungsgemäß beendet.");
         return 0;
 
     }
     catch (const std::exception& e) {
-        std::cerr << "[AUSNAHME] Unerwarteter Fehler: " << e.what() << std::endl;
+        SpaceInvaders::Logger::Error("Unerwarteter Fehler: %s", e.what());
+        SpaceInvaders::FlightRecorder::GetInstance().Dump(e.what());
         return -2;
 
     }
     catch (...) {
-        std::cerr << "[KRITISCHER FEHLER] Unbekannter Fehler aufgetreten!" << std::endl;
+        SpaceInvaders::Logger::Error("Unbekannter Fehler aufgetreten!");
+        SpaceInvaders::FlightRecorder::GetInstance().Dump("Unbekannte Ausnahme");
         return -3;
     }
 }
\ No newline at end of file